@@ -53,7 +53,7 @@ static char *get_aos(ti57_t *ti57, char *str)
 
 static char *get_op_str(ti57_t *ti57, int step, char *str)
 {
-    op57_t *instruction = ti57_get_program_op(ti57, step);
+    const op57_t *instruction = ti57_get_program_op(ti57, step);
 
     sprintf(str, "%s %s %c",
             instruction->inv ? "-" : " ",
@@ -0,0 +1,408 @@
+/**
+ * Differential fuzzing harness for TI-57 engines.
+ *
+ * Runs the reference engine ('ti57_next') and a candidate engine in lockstep,
+ * on random and corpus-derived key sequences, starting from random register
+ * contents. The full state of both engines is compared every 'interval' cycles
+ * and at the end of every key press and release. A diverging input is minimized
+ * and printed as a short reproducer.
+ *
+ * Any accelerated engine must pass this harness before replacing 'ti57_next'.
+ * To test one, point 'CANDIDATE_NEXT' to its 'next' function.
+ *
+ * Usage:
+ *   fuzz57 [seed [cases [interval]]]  fuzz the candidate engine
+ *   fuzz57 mutant [seed]              fuzz a deliberately broken engine, to
+ *                                     check the harness itself
+ *
+ * Build with the engine and the log, which appends to the journal:
+ *   gcc -std=gnu11 -O2 -o fuzz57 fuzz57.c ti57.c state57.c key57.c utils57.c ops57.c rom57.c \
+ *       log57.c logger57.c journal57.c
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ti57.h"
+#include "utils57.h"
+
+/** The candidate engine. */
+#define CANDIDATE_NEXT ti57_next
+
+#define FUZZ57_MAX_KEYS 64
+#define FUZZ57_PRESS_CYCLES 2000
+#define FUZZ57_RELEASE_CYCLES 2000
+#define FUZZ57_INIT_CYCLES 2000
+
+/** A 'next' function, as implemented by an engine. */
+typedef int (*fuzz57_next_t)(ti57_t *ti57);
+
+/** How the registers are initialized, before the keys are pressed. */
+typedef enum fuzz57_init_e {
+    FUZZ57_INIT_NONE,  // Registers as set by the ROM after power on.
+    FUZZ57_INIT_USER,  // Random numbers in user registers and a random program.
+    FUZZ57_INIT_RAW,   // Random digits in all internal registers.
+} fuzz57_init_t;
+
+/** A fuzzing input. */
+typedef struct fuzz57_case_s {
+    unsigned long seed;                    // Seed for the register initialization.
+    fuzz57_init_t init;                    // How to initialize the registers.
+    int key_count;                         // Number of keys in 'keys'.
+    unsigned char keys[FUZZ57_MAX_KEYS];   // Keys, as (row << 4) | col.
+} fuzz57_case_t;
+
+/** Where the reference and candidate engines first disagreed. */
+typedef struct fuzz57_result_s {
+    const char *field;  // Name of the first differing field, 0 if none.
+    int key_index;      // Index of the key being processed, -1 during init.
+    long cycle;         // Reference cycle count at the time of the comparison.
+} fuzz57_result_t;
+
+/** Keys sequences used as seeds for mutation. */
+static const unsigned char *CORPUS[] = {
+    (unsigned char []) {0x72, 0x75, 0x73, 0x55, 0x74, 0x35, 0x62, 0x85, 0},  // 1 + 2 x 3 ^ 4 =
+    (unsigned char []) {0x21, 0x63, 0x24, 0x81, 0x21, 0x71, 0x81, 0},        // program: sqrt(5)
+    (unsigned char []) {0x13, 0x13, 0x13, 0x13, 0x14, 0},                    // ln(ln(...(ln(0))...))
+    (unsigned char []) {0x63, 0x32, 0x63, 0x33, 0x63, 0},                    // 5 STO 5 RCL 5
+    (unsigned char []) {0x72, 0x25, 0x11, 0x13, 0x11, 0x23, 0x12, 0x11, 0x23, 0},  // 1 1/x log sin inv sin
+    (unsigned char []) {0x21, 0x11, 0x81, 0x11, 0x31, 0x21, 0x81, 0x81, 0},  // program with pause
+    (unsigned char []) {0x82, 0x25, 0x15, 0x72, 0x42, 0x73, 0x84, 0x85, 0},  // error, clear, 1 EE 2 +/-
+};
+
+#define CORPUS_COUNT ((int)(sizeof(CORPUS) / sizeof(CORPUS[0])))
+
+/**
+ * RANDOM NUMBERS
+ *
+ * A small local generator so that reproducers do not depend on the C library.
+ */
+
+static unsigned long rng_next(unsigned long *state)
+{
+    unsigned long x = *state ? *state : 0x57575757UL;
+
+    x ^= (x << 13) & 0xffffffffUL;
+    x ^= x >> 17;
+    x ^= (x << 5) & 0xffffffffUL;
+    *state = x & 0xffffffffUL;
+    return *state;
+}
+
+static int rng_below(unsigned long *state, int n)
+{
+    return (int)(rng_next(state) % (unsigned long)n);
+}
+
+static unsigned char random_key(unsigned long *state)
+{
+    int row = 1 + rng_below(state, 8);
+    int col = 1 + rng_below(state, 5);
+
+    return (unsigned char)(row << 4 | col);
+}
+
+/**
+ * STATE
+ */
+
+/** Returns the name of the first field that differs between 2 states, 0 if none. */
+static const char *compare_state(ti57_t *a, ti57_t *b)
+{
+#define CMP_ARRAY(f) if (memcmp(a->f, b->f, sizeof(a->f))) return #f
+#define CMP_FIELD(f) if (a->f != b->f) return #f
+
+    CMP_FIELD(pc);
+    CMP_FIELD(COND);
+    CMP_FIELD(R5);
+    CMP_FIELD(RAB);
+    CMP_FIELD(is_hex);
+    CMP_ARRAY(stack);
+    CMP_ARRAY(A);
+    CMP_ARRAY(B);
+    CMP_ARRAY(C);
+    CMP_ARRAY(D);
+    CMP_ARRAY(X);
+    CMP_ARRAY(Y);
+    CMP_ARRAY(dA);
+    CMP_ARRAY(dB);
+    CMP_FIELD(row);
+    CMP_FIELD(col);
+    CMP_FIELD(is_key_pressed);
+    CMP_FIELD(current_cycle);
+    CMP_FIELD(last_disp_cycle);
+    CMP_FIELD(last_pause_cycle);
+    CMP_FIELD(last_eval_cycle);
+    CMP_FIELD(mode);
+    CMP_FIELD(activity);
+    return 0;
+
+#undef CMP_ARRAY
+#undef CMP_FIELD
+}
+
+/** Sets the registers of both engines to the same random contents. */
+static void init_registers(ti57_t *ref, ti57_t *cand, fuzz57_case_t *c)
+{
+    unsigned long rng = c->seed;
+
+    if (c->init == FUZZ57_INIT_USER) {
+        // Valid numbers (13 BCD digits and an exponent sign) in user registers.
+        for (int i = 0; i < 8; i++) {
+            ti57_reg_t *reg = ti57_get_user_reg(ref, i);
+            for (int j = 0; j < 13; j++) {
+                (*reg)[j] = rng_below(&rng, 10);
+            }
+            (*reg)[13] = rng_below(&rng, 2) ? 0x2 : 0x0;
+        }
+        // Any byte is a valid program step.
+        for (int i = 0; i < 6; i++) {
+            for (int j = 0; j < 16; j++) {
+                ref->Y[i][j] = rng_below(&rng, 16);
+            }
+        }
+    } else if (c->init == FUZZ57_INIT_RAW) {
+        ti57_reg_t *regs[] = {&ref->A, &ref->B, &ref->C, &ref->D};
+        for (int i = 0; i < 4; i++) {
+            for (int j = 0; j < 16; j++) {
+                (*regs[i])[j] = rng_below(&rng, 16);
+            }
+        }
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 16; j++) {
+                ref->X[i][j] = rng_below(&rng, 16);
+                ref->Y[i][j] = rng_below(&rng, 16);
+            }
+        }
+        ref->R5 = rng_below(&rng, 256);
+        ref->RAB = rng_below(&rng, 8);
+    }
+
+    // The candidate starts from exactly the same state.
+    memcpy(cand, ref, sizeof(ti57_t));
+}
+
+/**
+ * LOCKSTEP EXECUTION
+ */
+
+/** Runs both engines for 'cycles' cycles, comparing states every 'interval' cycles. */
+static bool run_lockstep(ti57_t *ref, ti57_t *cand, fuzz57_next_t next, long cycles,
+                         long interval, fuzz57_result_t *result)
+{
+    long since_compare = 0;
+
+    while (cycles > 0) {
+        int n = ti57_next(ref);
+        int m = next(cand);
+
+        if (n != m) {
+            result->field = "cost";
+            result->cycle = ref->current_cycle;
+            return false;
+        }
+        cycles -= n;
+        since_compare += n;
+        if (since_compare >= interval) {
+            since_compare = 0;
+            if ((result->field = compare_state(ref, cand)) != 0) {
+                result->cycle = ref->current_cycle;
+                return false;
+            }
+        }
+    }
+
+    if ((result->field = compare_state(ref, cand)) != 0) {
+        result->cycle = ref->current_cycle;
+        return false;
+    }
+    return true;
+}
+
+/** Runs a case and returns true if both engines agree all along. */
+static bool run_case(fuzz57_case_t *c, fuzz57_next_t next, long interval, fuzz57_result_t *result)
+{
+    static ti57_t ref, cand;
+
+    memset(result, 0, sizeof(fuzz57_result_t));
+    result->key_index = -1;
+
+    ti57_init(&ref);
+    ti57_init(&cand);
+    if (!run_lockstep(&ref, &cand, next, FUZZ57_INIT_CYCLES, interval, result)) {
+        return false;
+    }
+    init_registers(&ref, &cand, c);
+
+    for (int i = 0; i < c->key_count; i++) {
+        int row = c->keys[i] >> 4;
+        int col = c->keys[i] & 0x0f;
+
+        result->key_index = i;
+        ti57_key_press(&ref, row, col);
+        ti57_key_press(&cand, row, col);
+        if (!run_lockstep(&ref, &cand, next, FUZZ57_PRESS_CYCLES, interval, result)) {
+            return false;
+        }
+        ti57_key_release(&ref);
+        ti57_key_release(&cand);
+        if (!run_lockstep(&ref, &cand, next, FUZZ57_RELEASE_CYCLES, interval, result)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * CASE GENERATION AND MINIMIZATION
+ */
+
+static void generate_case(fuzz57_case_t *c, unsigned long *rng)
+{
+    c->seed = rng_next(rng);
+    c->init = (fuzz57_init_t)rng_below(rng, 3);
+    c->key_count = 0;
+
+    if (rng_below(rng, 2)) {
+        // Corpus-derived: a corpus sequence with a few random mutations.
+        const unsigned char *keys = CORPUS[rng_below(rng, CORPUS_COUNT)];
+        while (keys[c->key_count]) {
+            c->keys[c->key_count] = keys[c->key_count];
+            c->key_count++;
+        }
+        for (int n = rng_below(rng, 4); n > 0 && c->key_count < FUZZ57_MAX_KEYS; n--) {
+            int i = rng_below(rng, c->key_count + 1);
+            if (i < c->key_count && rng_below(rng, 2)) {
+                c->keys[i] = random_key(rng);
+            } else {
+                memmove(c->keys + i + 1, c->keys + i, c->key_count - i);
+                c->keys[i] = random_key(rng);
+                c->key_count++;
+            }
+        }
+    } else {
+        // Purely random.
+        c->key_count = 1 + rng_below(rng, 24);
+        for (int i = 0; i < c->key_count; i++) {
+            c->keys[i] = random_key(rng);
+        }
+    }
+}
+
+/** Removes keys from a failing case, as long as the case keeps failing. */
+static void minimize_case(fuzz57_case_t *c, fuzz57_next_t next, long interval)
+{
+    fuzz57_result_t result;
+    fuzz57_case_t trial;
+
+    // Keys after the divergence are not needed.
+    run_case(c, next, interval, &result);
+    if (result.key_index >= 0) {
+        c->key_count = result.key_index + 1;
+    }
+
+    // Try removing chunks of decreasing size.
+    for (int chunk = c->key_count / 2; chunk >= 1; chunk /= 2) {
+        int i = 0;
+        while (i + chunk <= c->key_count) {
+            trial = *c;
+            memmove(trial.keys + i, trial.keys + i + chunk, trial.key_count - i - chunk);
+            trial.key_count -= chunk;
+            if (!run_case(&trial, next, interval, &result)) {
+                *c = trial;
+            } else {
+                i += chunk;
+            }
+        }
+    }
+
+    // Try a simpler register initialization.
+    if (c->init != FUZZ57_INIT_NONE) {
+        trial = *c;
+        trial.init = FUZZ57_INIT_NONE;
+        if (!run_case(&trial, next, interval, &result)) {
+            *c = trial;
+        }
+    }
+}
+
+static void print_case(fuzz57_case_t *c, fuzz57_result_t *result)
+{
+    static char *INITS[] = {"none", "user", "raw"};
+
+    printf("  init=%s seed=%lu\n", INITS[c->init], c->seed);
+    printf("  keys (%d):", c->key_count);
+    for (int i = 0; i < c->key_count; i++) {
+        printf(" %02x", c->keys[i]);
+    }
+    printf("\n");
+    printf("  first difference: '%s' at cycle %ld, ", result->field, result->cycle);
+    if (result->key_index < 0) {
+        printf("during init\n");
+    } else {
+        printf("after key #%d (%s)\n", result->key_index,
+               key57_get_ascii_name(key57_get_key(c->keys[result->key_index] >> 4,
+                                                  c->keys[result->key_index] & 0x0f,
+                                                  false)));
+    }
+}
+
+/**
+ * A broken engine: x^2 corrupts register R7 (X4). Used to check that the
+ * harness finds and minimizes a divergence.
+ */
+static int mutant_next(ti57_t *ti57)
+{
+    int cost = ti57_next(ti57);
+
+    if (ti57->is_key_pressed && ti57->row == 2 && ti57->col == 3 && cost > 1) {
+        ti57->X[4][0] ^= 1;
+    }
+    return cost;
+}
+
+int main(int argc, char **argv)
+{
+    fuzz57_next_t next = CANDIDATE_NEXT;
+    unsigned long rng;
+    long cases = 1000;
+    long interval = 64;
+    int arg = 1;
+    fuzz57_case_t c;
+    fuzz57_result_t result;
+
+#if PLATFORM57_TRACE
+    // Mute the tracing in 'ti57_next'.
+    in_register_dump = 1;
+#endif
+
+    if (argc > arg && strcmp(argv[arg], "mutant") == 0) {
+        next = mutant_next;
+        arg++;
+    }
+    rng = (argc > arg) ? strtoul(argv[arg++], 0, 0) : 57;
+    if (argc > arg) cases = strtol(argv[arg++], 0, 0);
+    if (argc > arg) interval = strtol(argv[arg++], 0, 0);
+    if (interval < 1) interval = 1;
+
+    printf("Fuzzing %ld cases (seed %lu, compare every %ld cycles)\n", cases, rng, interval);
+
+    for (long i = 0; i < cases; i++) {
+        generate_case(&c, &rng);
+        if (!run_case(&c, next, interval, &result)) {
+            printf("DIVERGENCE in case %ld\n", i);
+            print_case(&c, &result);
+            minimize_case(&c, next, interval);
+            run_case(&c, next, interval, &result);
+            printf("REPRODUCER\n");
+            print_case(&c, &result);
+            return 1;
+        }
+        if ((i + 1) % 100 == 0) {
+            printf("  %ld cases OK\n", i + 1);
+        }
+    }
+    printf("PASS\n");
+    return 0;
+}
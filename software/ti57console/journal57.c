@@ -0,0 +1,235 @@
+#include "journal57.h"
+
+#include <assert.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define HEADER_SIZE 16
+#define VERSION 1
+
+static const char MAGIC[8] = {'J', 'R', 'N', 'L', '5', '7', 0, 0};
+
+/** Fills the 16-byte header: magic, version and record size. */
+static void make_header(unsigned char *header)
+{
+    memset(header, 0, HEADER_SIZE);
+    memcpy(header, MAGIC, sizeof(MAGIC));
+    header[8] = VERSION;
+    header[9] = sizeof(log57_record_t);
+}
+
+static bool is_valid_header(const unsigned char *header)
+{
+    unsigned char expected[HEADER_SIZE];
+
+    make_header(expected);
+    return memcmp(header, expected, HEADER_SIZE) == 0;
+}
+
+/** Cuts an open file to 'size' bytes. Returns 0 on success. */
+static int truncate_file(FILE *file, long size)
+{
+    fflush(file);
+#ifdef _WIN32
+    return _chsize(_fileno(file), size);
+#else
+    return ftruncate(fileno(file), size);
+#endif
+}
+
+/**
+ * WRITING
+ */
+
+bool journal57_open(journal57_t *journal, const char *path)
+{
+    unsigned char header[HEADER_SIZE];
+    long size;
+
+    memset(journal, 0, sizeof(journal57_t));
+    journal->file = fopen(path, "ab+");
+    if (!journal->file) return false;
+
+    fseek(journal->file, 0, SEEK_END);
+    size = ftell(journal->file);
+    if (size == 0) {
+        make_header(header);
+        fwrite(header, 1, HEADER_SIZE, journal->file);
+        journal57_sync(journal);
+        return true;
+    }
+
+    // Check the header of an existing journal.
+    fseek(journal->file, 0, SEEK_SET);
+    if (size < HEADER_SIZE ||
+        fread(header, 1, HEADER_SIZE, journal->file) != HEADER_SIZE ||
+        !is_valid_header(header)) {
+        fclose(journal->file);
+        journal->file = 0;
+        return false;
+    }
+
+    // A partial record at the end, left by a crash, is cut off so that the records appended next
+    // stay at their expected offsets. Padding it would add a record that was never logged.
+    journal->record_count = (size - HEADER_SIZE) / sizeof(log57_record_t);
+    long full_size = HEADER_SIZE + journal->record_count * (long)sizeof(log57_record_t);
+    if (full_size != size && truncate_file(journal->file, full_size) != 0) {
+        fclose(journal->file);
+        journal->file = 0;
+        return false;
+    }
+    fseek(journal->file, 0, SEEK_END);
+    return true;
+}
+
+void journal57_append(journal57_t *journal, log57_record_t *record)
+{
+    assert(journal->file);
+
+    fwrite(record, sizeof(log57_record_t), 1, journal->file);
+    journal->record_count += 1;
+    if (++journal->unsynced_count >= JOURNAL57_SYNC_INTERVAL) {
+        journal57_sync(journal);
+    }
+}
+
+void journal57_sync(journal57_t *journal)
+{
+    fflush(journal->file);
+#ifdef _WIN32
+    _commit(_fileno(journal->file));
+#else
+    fsync(fileno(journal->file));
+#endif
+    journal->unsynced_count = 0;
+}
+
+void journal57_close(journal57_t *journal, log57_t *log)
+{
+    if (!journal->file) return;
+
+    if (log && log57_get_logged_count(log) > 0) {
+        journal57_append(journal, log57_get_record(log, log57_get_logged_count(log)));
+    }
+    journal57_sync(journal);
+    fclose(journal->file);
+    journal->file = 0;
+}
+
+/**
+ * READING
+ */
+
+#ifdef _WIN32
+
+static const unsigned char *map_file(const char *path, size_t *size, void **handle)
+{
+    HANDLE file, mapping;
+    LARGE_INTEGER file_size;
+    const unsigned char *data = 0;
+
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return 0;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart < HEADER_SIZE) {
+        CloseHandle(file);
+        return 0;
+    }
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) return 0;
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return 0;
+    }
+    *size = (size_t)file_size.QuadPart;
+    *handle = mapping;
+    return data;
+}
+
+static void unmap_file(const unsigned char *data, size_t size, void *handle)
+{
+    UnmapViewOfFile(data);
+    CloseHandle((HANDLE)handle);
+}
+
+#else
+
+static const unsigned char *map_file(const char *path, size_t *size, void **handle)
+{
+    struct stat st;
+    void *data;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) return 0;
+    if (fstat(fd, &st) < 0 || st.st_size < HEADER_SIZE) {
+        close(fd);
+        return 0;
+    }
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return 0;
+    *size = st.st_size;
+    *handle = 0;
+    return data;
+}
+
+static void unmap_file(const unsigned char *data, size_t size, void *handle)
+{
+    (void)handle;
+    munmap((void *)data, size);
+}
+
+#endif
+
+bool journal57_reader_open(journal57_reader_t *reader, const char *path)
+{
+    memset(reader, 0, sizeof(journal57_reader_t));
+    reader->data = map_file(path, &reader->size, &reader->handle);
+    if (!reader->data) return false;
+
+    if (!is_valid_header(reader->data)) {
+        journal57_reader_close(reader);
+        return false;
+    }
+    reader->record_count = (reader->size - HEADER_SIZE) / sizeof(log57_record_t);
+    return true;
+}
+
+long journal57_reader_get_count(journal57_reader_t *reader)
+{
+    return reader->record_count;
+}
+
+const log57_record_t *journal57_reader_get_record(journal57_reader_t *reader, long index)
+{
+    assert(index >= 1 && index <= reader->record_count);
+
+    return (const log57_record_t *)
+        (reader->data + HEADER_SIZE + (size_t)(index - 1) * sizeof(log57_record_t));
+}
+
+void journal57_reader_get_entry(journal57_reader_t *reader, long index, log57_entry_t *entry)
+{
+    log57_record_t record = *journal57_reader_get_record(reader, index);
+
+    log57_format_record(&record, entry);
+}
+
+void journal57_reader_close(journal57_reader_t *reader)
+{
+    if (reader->data) {
+        unmap_file(reader->data, reader->size, reader->handle);
+    }
+    memset(reader, 0, sizeof(journal57_reader_t));
+}
@@ -0,0 +1,94 @@
+/**
+ * Append-only on-disk journal of log records, and a memory-mapped reader.
+ *
+ * The in-memory log (log57.h) is a ring that keeps the last LOG57_MAX_ENTRY_COUNT entries. When a
+ * journal is attached to it, every record is also appended to a file once it is final (that is
+ * once the log moves on to the next record), so that the whole history of a session is kept.
+ *
+ * File format: a 16-byte header followed by records of 'sizeof(log57_record_t)' bytes, in the
+ * order they were logged. Record 'i' is at offset 16 + (i - 1) * size. Indices are 1-based and
+ * relative to the start of the journal: they match the indices of log57.h only if the journal
+ * was attached to a fresh log, and not for the records appended by a later session.
+ *
+ * Sample usage:
+ *   journal57_t journal;
+ *   journal57_open(&journal, "session.j57");
+ *   log57_set_journal(&log, &journal);
+ *   ...
+ *   log57_set_journal(&log, 0);
+ *   journal57_close(&journal, &log);
+ */
+
+#ifndef journal57_h
+#define journal57_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "log57.h"
+
+/** Number of appended records between two syncs of the file to disk. */
+#define JOURNAL57_SYNC_INTERVAL 64
+
+/** A journal being written. */
+typedef struct journal57_s {
+    FILE *file;
+    long record_count;  // Number of records in the file.
+    int unsynced_count; // Number of records appended since the last sync.
+} journal57_t;
+
+/** A journal being read. */
+typedef struct journal57_reader_s {
+    const unsigned char *data;  // The mapped file.
+    size_t size;                // The size of the mapped file.
+    long record_count;          // Number of complete records in the file.
+    void *handle;               // Platform specific handle of the mapping.
+} journal57_reader_t;
+
+/**
+ * WRITING
+ */
+
+/**
+ * Opens a journal for appending, creating the file if needed.
+ *
+ * A partial record at the end of the file, left by a crash, is dropped.
+ *
+ * Returns false if the file cannot be opened or is not a journal.
+ */
+bool journal57_open(journal57_t *journal, const char *path);
+
+/** Appends a record. */
+void journal57_append(journal57_t *journal, log57_record_t *record);
+
+/** Flushes the journal and syncs it to disk. */
+void journal57_sync(journal57_t *journal);
+
+/**
+ * Closes a journal.
+ *
+ * If 'log' is not 0, its last record, which is not final yet, is appended first.
+ */
+void journal57_close(journal57_t *journal, log57_t *log);
+
+/**
+ * READING
+ */
+
+/** Maps a journal in memory. Returns false if the file cannot be mapped or is not a journal. */
+bool journal57_reader_open(journal57_reader_t *reader, const char *path);
+
+/** Returns the number of records in the journal. */
+long journal57_reader_get_count(journal57_reader_t *reader);
+
+/** Returns the record at a given index, in 1..count. */
+const log57_record_t *journal57_reader_get_record(journal57_reader_t *reader, long index);
+
+/** Formats the record at a given index, in 1..count, into 'entry'. */
+void journal57_reader_get_entry(journal57_reader_t *reader, long index, log57_entry_t *entry);
+
+/** Unmaps a journal. */
+void journal57_reader_close(journal57_reader_t *reader);
+
+#endif /* journal57_h */
@@ -1,7 +1,7 @@
 #include "key57.h"
+#include "platform57.h"
 
-#include <assert.h>
-
+#if PLATFORM57_STRINGS
 static char *DIGIT_KEYS[]  = {
     "0", "1", "2", "3", "4", "5", "6", "7",
     "8", "9", "A", "B", "C", "D", "E", "F",
@@ -74,6 +74,7 @@ static char *get_name(key57_t key, bool unicode)
     return sec ? secondary_keys[row * 5 + col - 5]
                : primary_keys[row * 5 + col];
 }
+#endif
 
 /**
  * API FUNCTIONS
@@ -83,8 +84,8 @@ key57_t key57_get_key(int row, int col, bool is_secondary)
 {
     if (row == 0 && col == 0) return KEY57_NONE;
 
-    assert(1 <= row && row <= 8);
-    assert(1 <= col && col <= 5);
+    ASSERT57(1 <= row && row <= 8);
+    ASSERT57(1 <= col && col <= 5);
 
     key57_t key = (row << 4) | col;
 
@@ -105,6 +106,7 @@ key57_t key57_get_key(int row, int col, bool is_secondary)
     }
 }
 
+#if PLATFORM57_STRINGS
 char *key57_get_ascii_name(key57_t key)
 {
     return get_name(key, false);
@@ -114,3 +116,4 @@ char *key57_get_unicode_name(key57_t key)
 {
     return get_name(key, true);
 }
+#endif
@@ -7,6 +7,8 @@
 
 #include <stdbool.h>
 
+#include "platform57.h"
+
 #define KEY57_2ND  0x11
 #define KEY57_INV  0x12
 #define KEY57_CLR  0x15
@@ -27,6 +29,7 @@ typedef unsigned char key57_t;
 /** Returns the primary or secondary key at a given row (1..8) and column (1..5). */
 key57_t key57_get_key(int row, int col, bool is_secondary);
 
+#if PLATFORM57_STRINGS
 /**
  * Returns the ASCII name of a given key.
  *
@@ -45,5 +48,6 @@ char *key57_get_ascii_name(key57_t key);
  * For example: "SUM" or "x\u0305" (average).
  */
 char *key57_get_unicode_name(key57_t key);
+#endif
 
 #endif /* key57_h */
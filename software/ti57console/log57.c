@@ -4,44 +4,39 @@
 #include <stdio.h>
 #include <string.h>
 
-// Returns the entry at a given index.
-static log57_entry_t *get_entry(log57_t *log, long index)
+#include "journal57.h"
+#include "ops57.h"
+#include "utils57.h"
+
+// Returns the record at a given index.
+static log57_record_t *get_record(log57_t *log, long index)
 {
     assert(index >= 1 && index >= log->logged_count - LOG57_MAX_ENTRY_COUNT + 1);
     assert(index <= log->logged_count);
 
-    return &log->entries[index % LOG57_MAX_ENTRY_COUNT];
+    return &log->records[index % LOG57_MAX_ENTRY_COUNT];
 }
 
-static log57_entry_t LOG57_BLANK_ENTRY_2 = {"", LOG57_NUMBER_IN, 0};
-
-log57_entry_t *LOG57_BLANK_ENTRY = &LOG57_BLANK_ENTRY_2;
-
-void log57_reset(log57_t *log)
+// Starts a new record, the current one being final.
+static log57_record_t *next_record(log57_t *log)
 {
-    memset(log, 0, sizeof(log57_t));
+    if (log->journal && log->logged_count > 0) {
+        journal57_append(log->journal, get_record(log, log->logged_count));
+    }
+    log->logged_count += 1;
+    return get_record(log, log->logged_count);
 }
 
-/**
- * ACTUAL LOGGING
- */
-
-void log57_log_op(log57_t *log, op57_t *op, bool is_pending)
+// Formats an operation such as "INV STO 2" or "STO _".
+static void format_op(op57_t *op, bool is_pending, char *str)
 {
-    log57_entry_t *entry = NULL;
-
-    log->timestamp += 1;
-
-    // Decide whether to override the last entry.
-    if (log->logged_count > 0) {
-        entry = get_entry(log, log->logged_count);
-        if (entry->type != LOG57_PENDING_OP) {
-            log->logged_count += 1;
-            entry = get_entry(log, log->logged_count);
+    // Programmable operations, that is nearly all of them, have precomputed names.
+    if (op->key < OPS57_MAX_KEY && op->d <= 9) {
+        int opcode = OPS57_OPCODES[op->inv][op->key][is_pending ? 1 : op->d + 1];
+        if (opcode >= 0) {
+            strcpy(str, is_pending ? OPS57_UNICODE_PENDING[opcode] : OPS57_UNICODE[opcode]);
+            return;
         }
-    } else {
-        log->logged_count = 1;
-        entry = get_entry(log, 1);
     }
 
     // Compute optional parameter.
@@ -56,33 +51,73 @@ void log57_log_op(log57_t *log, op57_t *op, bool is_pending)
         param[0] = 0;
     }
 
-    // Set entry.
-    sprintf(entry->message, "%s%s%s",
+    sprintf(str, "%s%s%s",
             op->inv ? "INV " : "",
             key57_get_unicode_name(op->key),
             param);
-    entry->type = is_pending ? LOG57_PENDING_OP : LOG57_OP;
+}
+
+static log57_entry_t LOG57_BLANK_ENTRY_2 = {"", LOG57_NUMBER_IN, 0};
+
+log57_entry_t *LOG57_BLANK_ENTRY = &LOG57_BLANK_ENTRY_2;
+
+void log57_reset(log57_t *log)
+{
+    memset(log, 0, sizeof(log57_t));
+}
+
+void log57_set_journal(log57_t *log, struct journal57_s *journal)
+{
+    log->journal = journal;
+}
+
+/**
+ * ACTUAL LOGGING
+ */
+
+void log57_log_op(log57_t *log, op57_t *op, bool is_pending)
+{
+    log57_record_t *record = NULL;
+
+    log->timestamp += 1;
+
+    // Decide whether to override the last record.
+    if (log->logged_count > 0 && get_record(log, log->logged_count)->type == LOG57_PENDING_OP) {
+        record = get_record(log, log->logged_count);
+    } else {
+        record = next_record(log);
+    }
+
+    // Set record.
+    record->type = is_pending ? LOG57_PENDING_OP : LOG57_OP;
+    record->flags = 0;
+    record->op = *op;
 
     // Update current op.
-    strcpy(log->current_op, entry->message);
+    log->current_op = *op;
+    log->has_current_op = true;
+    log->is_current_op_pending = is_pending;
 }
 
-void log57_log_display(log57_t *log, char *display, log57_type_t type, bool is_error)
+void log57_log_display(log57_t *log, unsigned char *digits, unsigned char *mask,
+                       log57_type_t type, bool is_error)
 {
     log->timestamp += 1;
 
-    // Decide whether to override the last entry.
+    // Decide whether to override the last record.
     if (! (type == LOG57_NUMBER_IN &&
            log->logged_count > 0 &&
-           get_entry(log, log->logged_count)->type == LOG57_NUMBER_IN) ) {
-        log->logged_count++;
+           get_record(log, log->logged_count)->type == LOG57_NUMBER_IN) ) {
+        next_record(log);
     }
 
-    // Set entry.
-    log57_entry_t *entry = get_entry(log, log->logged_count);
-    strcpy(entry->message, display);
-    entry->type = type;
-    entry->flags = is_error ? LOG57_ERROR_FLAG : 0;
+    // Set record.
+    log57_record_t *record = get_record(log, log->logged_count);
+    for (int i = 0; i < 12; i++) {
+        record->display[i] = (digits[i] & 0xf) | (mask[i] << 4);
+    }
+    record->type = type;
+    record->flags = is_error ? LOG57_ERROR_FLAG : 0;
 }
 
 /**
@@ -94,9 +129,34 @@ long log57_get_logged_count(log57_t *log)
     return log->logged_count;
 }
 
+log57_record_t *log57_get_record(log57_t *log, long index)
+{
+    return get_record(log, index);
+}
+
 log57_entry_t *log57_get_entry(log57_t *log, long index)
 {
-    return get_entry(log, index);
+    log57_format_record(get_record(log, index), &log->formatted_entry);
+    return &log->formatted_entry;
+}
+
+void log57_format_record(log57_record_t *record, log57_entry_t *entry)
+{
+    entry->type = record->type;
+    entry->flags = record->flags;
+
+    if (record->type == LOG57_OP || record->type == LOG57_PENDING_OP) {
+        format_op(&record->op, record->type == LOG57_PENDING_OP, entry->message);
+        return;
+    }
+
+    // Unpack the display, only the first 12 digits are used.
+    ti57_reg_t digits, mask;
+    for (int i = 0; i < 12; i++) {
+        digits[i] = record->display[i] & 0xf;
+        mask[i] = record->display[i] >> 4;
+    }
+    strcpy(entry->message, utils57_trim(utils57_display_to_str(&digits, &mask)));
 }
 
 /**
@@ -105,10 +165,15 @@ log57_entry_t *log57_get_entry(log57_t *log, long index)
 
 char *log57_get_current_op(log57_t *log)
 {
-    return log->current_op;
+    if (!log->has_current_op) {
+        log->formatted_op[0] = 0;
+    } else {
+        format_op(&log->current_op, log->is_current_op_pending, log->formatted_op);
+    }
+    return log->formatted_op;
 }
 
 void log57_clear_current_op(log57_t *log)
 {
-    log->current_op[0] = 0;
+    log->has_current_op = false;
 }
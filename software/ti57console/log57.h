@@ -12,6 +12,8 @@
 
 #define LOG57_MAX_ENTRY_COUNT 1000
 
+struct journal57_s;
+
 #define LOG57_ERROR_FLAG 0x01
 
 /** The different types of log entries. */
@@ -24,9 +26,22 @@ typedef enum log57_type_e {
     LOG57_PAUSE,       // The number on the display, while on Pause.
 } log57_type_t;
 
-/** A log entry. */
+/**
+ * A log record, as stored in the log.
+ *
+ * Records are compact and binary so that logging does no string formatting. They are only
+ * formatted, into a log57_entry_t, when retrieved.
+ */
+typedef struct log57_record_s {
+    unsigned char type;         // A log57_type_t.
+    unsigned char flags;        // LOG57_ERROR_FLAG.
+    op57_t op;                  // The operation, for LOG57_PENDING_OP and LOG57_OP.
+    unsigned char display[12];  // The display, for other types: digit (low nibble) and mask (high nibble) of each LED.
+} log57_record_t;
+
+/** A formatted log entry. */
 typedef struct log57_entry_s {
-    char message[16];
+    char message[26];  // 26 = 2 * 12 + 1 ('?') + 1 (end of string).
     log57_type_t type;
     int flags;
 } log57_entry_t;
@@ -34,9 +49,11 @@ typedef struct log57_entry_s {
 /** All the log data. */
 typedef struct log57_s {
     // The log data. */
-    log57_entry_t entries[LOG57_MAX_ENTRY_COUNT];
-    long logged_count;    // Number of logged entries since reset, can be > LOG57_MAX_ENTRY_COUNT.
-    char current_op[16];  // The current operation such as "+", "STO _" or "STO 2".
+    log57_record_t records[LOG57_MAX_ENTRY_COUNT];
+    long logged_count;          // Number of logged entries since reset, can be > LOG57_MAX_ENTRY_COUNT.
+    op57_t current_op;          // The current operation such as "+", "STO _" or "STO 2".
+    bool has_current_op;        // Whether 'current_op' is set.
+    bool is_current_op_pending; // Whether 'current_op' is waiting for its digit parameter.
 
     // Internal state used for parsing.
     key57_t pending_op_key;  // The key such as "STO" before the digit parameter has been entered.
@@ -48,19 +65,38 @@ typedef struct log57_s {
     // The timestamp is incremented whenever there is a change to the log. It can be used by clients
     // to update the UI only when needed.
     long timestamp;
+
+    // Optional journal where final records are appended, see journal57.h.
+    struct journal57_s *journal;
+
+    // Storage for the strings returned by the retrieval functions.
+    log57_entry_t formatted_entry;
+    char formatted_op[16];
 } log57_t;
 
 extern log57_entry_t *LOG57_BLANK_ENTRY;
 
-/** Resets the log, setting the logged_count to 0. */
+/** Resets the log, setting the logged_count to 0. Also detaches any journal. */
 void log57_reset(log57_t *log);
 
+/**
+ * Attaches a journal to the log, or detaches it if 'journal' is 0.
+ *
+ * From then on, every record is appended to the journal as soon as it is final.
+ */
+void log57_set_journal(log57_t *log, struct journal57_s *journal);
+
 /**
  * ACTUAL LOGGING
  */
 
-/** Logs a message of a given type. */
-void log57_log_display(log57_t *log, char *display, log57_type_t type, bool is_error);
+/**
+ * Logs the display of a given type.
+ *
+ * 'digits' and 'mask' are the display registers, typically A and B in ti57_t.
+ */
+void log57_log_display(log57_t *log, unsigned char *digits, unsigned char *mask,
+                       log57_type_t type, bool is_error);
 
 /** Log an operation, possibly pending. */
 void log57_log_op(log57_t *log, op57_t *op, bool is_pending);
@@ -73,17 +109,27 @@ void log57_log_op(log57_t *log, op57_t *op, bool is_pending);
 long log57_get_logged_count(log57_t *log);
 
 /**
- * Returns the entry at a given index.
+ * Returns the record at a given index.
  *
  * 'index' should be between max(1, logged_count - LOG57_MAX_ENTRY_COUNT + 1) and logged_count.
  */
+log57_record_t *log57_get_record(log57_t *log, long index);
+
+/**
+ * Returns the entry at a given index, formatted.
+ *
+ * 'index' is as in log57_get_record. The entry is only valid until the next call.
+ */
 log57_entry_t *log57_get_entry(log57_t *log, long index);
 
+/** Formats a record into 'entry'. */
+void log57_format_record(log57_record_t *record, log57_entry_t *entry);
+
 /**
  * CURRENT OPERATION
  */
 
-/** Gets the last operation in EVAL mode. */
+/** Gets the last operation in EVAL mode. The string is only valid until the next call. */
 char *log57_get_current_op(log57_t *log);
 
 /** Clears the last operation in EVAL mode. */
@@ -33,11 +33,8 @@ static bool op_produces_result(key57_t key)
 
 static void log_display(ti57_t *ti57, log57_type_t type)
 {
-    char display_str[26];  // 26 = 2 * 12 + 1 ('?') + 1 (end of string).
-
     // Use A and B instead of dA and dB, in case the display hasn't been flushed.
-    strcpy(display_str, utils57_trim(utils57_display_to_str(&ti57->A, &ti57->B)));
-    log57_log_display(&ti57->log, display_str, type, ti57_is_error(ti57));
+    log57_log_display(ti57->log, ti57->A, ti57->B, type, ti57_is_error(ti57));
 }
 
 static void log_op(ti57_t *ti57, bool inv, key57_t key, int d, bool pending)
@@ -47,7 +44,7 @@ static void log_op(ti57_t *ti57, bool inv, key57_t key, int d, bool pending)
     op.inv = inv;
     op.key = key;
     op.d = d;
-    log57_log_op(&ti57->log, &op, pending);
+    log57_log_op(ti57->log, &op, pending);
 }
 
 // Activity transitions:
@@ -60,7 +57,9 @@ void logger57_update_after_next(ti57_t *ti57,
                                 ti57_activity_t previous_activity,
                                 ti57_mode_t previous_mode)
 {
-    log57_t *log = &ti57->log;
+    log57_t *log = ti57->log;
+
+    if (!log) return;
 
     // In RUN mode, log paused display and the special 'SBR d' case.
     if (ti57->mode == TI57_RUN) {
@@ -100,7 +99,7 @@ void logger57_update_after_next(ti57_t *ti57,
 
     if (ti57->mode == TI57_LRN) {
         if (previous_mode == TI57_EVAL) {
-            log57_clear_current_op(&ti57->log);
+            log57_clear_current_op(log);
         }
         return;
     }
@@ -137,9 +136,9 @@ void logger57_update_after_next(ti57_t *ti57,
 
     // Handle tracing.
     if (current_key == KEY57_SST) {
-        int pc = ti57->log.step_at_key_press;
+        int pc = log->step_at_key_press;
         if (pc < 0 || pc > 49) return;
-        op57_t *op = ti57_get_program_op(ti57, pc);
+        const op57_t *op = ti57_get_program_op(ti57, pc);
         if (op->d >= 0) {
             log->pending_op_key = op->key;
             current_key = op->d;
@@ -152,11 +151,11 @@ void logger57_update_after_next(ti57_t *ti57,
     if (ti57_is_number_edit(ti57)) {
         // Log "CLR", if number was not being edited.
         if (current_key == KEY57_CLR) {
-            if (ti57->log.logged_count &&
-                ti57->log.entries[ti57->log.logged_count].type != LOG57_NUMBER_IN) {
+            if (log->logged_count &&
+                log57_get_record(log, log->logged_count)->type != LOG57_NUMBER_IN) {
                 log_op(ti57, false, KEY57_CLR, -1, false);
             }
-            log57_clear_current_op(&ti57->log);
+            log57_clear_current_op(log);
         }
 
         // Log display.
@@ -5,12 +5,14 @@
 #ifndef logger57_h
 #define logger57_h
 
+#include "log57.h"
 #include "state57.h"
 
 /**
  * Updates the log using the current state of the calculator and comparing it to the previous one.
  *
- * Note: this function should be called after every call to 'next'.
+ * Note: 'ti57_next' calls this function whenever the activity or the mode changes and a log is
+ * attached (see ti57_set_log). Other calls are no-ops.
  */
 void logger57_update_after_next(ti57_t *ti57,
                                 ti57_activity_t previous_activity,
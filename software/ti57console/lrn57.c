@@ -3,6 +3,7 @@
 #include <string.h>
 
 #include "op57.h"
+#include "ops57.h"
 #include "utils57.h"
 
 static void clear_op_edit_flag(ti57_t *ti57)
@@ -229,7 +230,6 @@ char *lrn57_get_display(rcl57_t *rcl57)
     bool op_pending = ti57_is_op_edit_in_lrn(ti57);
     bool is_hp_mode = rcl57->options & RCL57_HP_LRN_MODE_FLAG;
     bool is_alphanumeric_mode = rcl57->options & RCL57_ALPHA_LRN_MODE_FLAG;
-    int dot_count = 0;
 
     if (pc == 0 && !op_pending && is_hp_mode) {
         return is_alphanumeric_mode ? " LRN        " : " Lrn        ";
@@ -239,47 +239,20 @@ char *lrn57_get_display(rcl57_t *rcl57)
         pc -= 1;
     }
 
-    op57_t *op = ti57_get_program_op(ti57, pc);
-
-    memset(str, ' ', sizeof(str));
-    str[sizeof(str) - 1] = 0;
-
-    // Set operation.
-    int i = (int)strlen(str) - 1;
-    if (op->d >= 0) {
-        str[i] = '0' + op->d;
-        i -= 2;
-    } else if (op_pending) {
-        str[i] = is_alphanumeric_mode ? '_' : '0';
-        i -= 2;
-    } else if (!is_alphanumeric_mode) {
-        i -= 2;
-    }
+    // Set operation, from the precomputed display.
+    int opcode = ti57_get_program_opcode(ti57, pc);
+    int start;
     if (is_alphanumeric_mode) {
-        char *name = key57_get_ascii_name(op->key);
-        for (int j = (int)strlen(name) - 1; j >= 0; j--) {
-            str[i--] = name[j];
-            if (str[i + 1] == '.') {
-                str[i--] = ' ';
-                dot_count += 1;
-            }
-        }
+        strcpy(str, OPS57_LRN_ALPHA[op_pending][opcode]);
+        start = 12 - OPS57_LRN_DOT_COUNT[opcode];
     } else {
-        str[i--] = '0' + op->key % 16 % 10;
-        str[i--] = '0' + op->key / 16;
-    }
-    if (op->inv) {
-        if (is_alphanumeric_mode) {
-            memcpy(str + i - 3, "INV", 3);
-        } else {
-            str[i] = '-';
-        }
+        strcpy(str, OPS57_LRN_NUMERIC[op_pending][opcode]);
+        start = 12;
     }
 
     // Set step number.
     char s1 = '0' + pc / 10;
     char s2 = '0' + pc % 10;
-    int start = 12 - dot_count;
     if (is_alphanumeric_mode) {
         str[start] = s1;
         str[start + 1] = s2;
@@ -0,0 +1,2658 @@
+/**
+ * Precomputed tables of the 256 program operations.
+ *
+ * Generated by opsgen57.c. Do not edit.
+ */
+
+#include "ops57.h"
+
+const op57_t OPS57[256] = {
+    {false, 0x00, -1},  // 0x00
+    {false, 0x01, -1},  // 0x01
+    {false, 0x02, -1},  // 0x02
+    {false, 0x03, -1},  // 0x03
+    {false, 0x04, -1},  // 0x04
+    {false, 0x05, -1},  // 0x05
+    {false, 0x06, -1},  // 0x06
+    {false, 0x07, -1},  // 0x07
+    {false, 0x08, -1},  // 0x08
+    {false, 0x09, -1},  // 0x09
+    {false, 0x0A, -1},  // 0x0A
+    {false, 0x0B, -1},  // 0x0B
+    {false, 0x0C, -1},  // 0x0C
+    {false, 0x0D, -1},  // 0x0D
+    {false, 0x0E, -1},  // 0x0E
+    {false, 0x0F, -1},  // 0x0F
+    {false, 0x11, -1},  // 0x10
+    {false, 0x21, -1},  // 0x11
+    {false, 0x31, -1},  // 0x12
+    {false, 0x41, -1},  // 0x13
+    {false, 0x51, -1},  // 0x14
+    {false, 0x61, -1},  // 0x15
+    {false, 0x71, -1},  // 0x16
+    {false, 0x81, -1},  // 0x17
+    {true, 0x11, -1},  // 0x18
+    {true, 0x21, -1},  // 0x19
+    {true, 0x31, -1},  // 0x1A
+    {true, 0x41, -1},  // 0x1B
+    {true, 0x51, -1},  // 0x1C
+    {true, 0x61, -1},  // 0x1D
+    {true, 0x71, -1},  // 0x1E
+    {true, 0x81, -1},  // 0x1F
+    {false, 0x12, -1},  // 0x20
+    {false, 0x22, -1},  // 0x21
+    {false, 0x32, -1},  // 0x22
+    {false, 0x42, -1},  // 0x23
+    {false, 0x86,  7},  // 0x24
+    {false, 0x86,  4},  // 0x25
+    {false, 0x86,  1},  // 0x26
+    {false, 0x86,  0},  // 0x27
+    {true, 0x12, -1},  // 0x28
+    {true, 0x22, -1},  // 0x29
+    {true, 0x32, -1},  // 0x2A
+    {true, 0x42, -1},  // 0x2B
+    {false, 0x51,  7},  // 0x2C
+    {false, 0x51,  4},  // 0x2D
+    {false, 0x51,  1},  // 0x2E
+    {false, 0x51,  0},  // 0x2F
+    {false, 0x13, -1},  // 0x30
+    {false, 0x23, -1},  // 0x31
+    {false, 0x33, -1},  // 0x32
+    {false, 0x43, -1},  // 0x33
+    {false, 0x86,  8},  // 0x34
+    {false, 0x86,  5},  // 0x35
+    {false, 0x86,  2},  // 0x36
+    {false, 0x83, -1},  // 0x37
+    {true, 0x13, -1},  // 0x38
+    {true, 0x23, -1},  // 0x39
+    {true, 0x33, -1},  // 0x3A
+    {true, 0x43, -1},  // 0x3B
+    {false, 0x51,  8},  // 0x3C
+    {false, 0x51,  5},  // 0x3D
+    {false, 0x51,  2},  // 0x3E
+    {true, 0x83, -1},  // 0x3F
+    {false, 0x14, -1},  // 0x40
+    {false, 0x24, -1},  // 0x41
+    {false, 0x34, -1},  // 0x42
+    {false, 0x44, -1},  // 0x43
+    {false, 0x86,  9},  // 0x44
+    {false, 0x86,  6},  // 0x45
+    {false, 0x86,  3},  // 0x46
+    {false, 0x84, -1},  // 0x47
+    {true, 0x14, -1},  // 0x48
+    {true, 0x24, -1},  // 0x49
+    {true, 0x34, -1},  // 0x4A
+    {true, 0x44, -1},  // 0x4B
+    {false, 0x51,  9},  // 0x4C
+    {false, 0x51,  6},  // 0x4D
+    {false, 0x51,  3},  // 0x4E
+    {true, 0x84, -1},  // 0x4F
+    {false, 0x15, -1},  // 0x50
+    {false, 0x25, -1},  // 0x51
+    {false, 0x35, -1},  // 0x52
+    {false, 0x45, -1},  // 0x53
+    {false, 0x55, -1},  // 0x54
+    {false, 0x65, -1},  // 0x55
+    {false, 0x75, -1},  // 0x56
+    {false, 0x85, -1},  // 0x57
+    {true, 0x15, -1},  // 0x58
+    {true, 0x25, -1},  // 0x59
+    {true, 0x35, -1},  // 0x5A
+    {true, 0x45, -1},  // 0x5B
+    {true, 0x55, -1},  // 0x5C
+    {true, 0x65, -1},  // 0x5D
+    {true, 0x75, -1},  // 0x5E
+    {true, 0x85, -1},  // 0x5F
+    {false, 0x16, -1},  // 0x60
+    {false, 0x26, -1},  // 0x61
+    {false, 0x36, -1},  // 0x62
+    {false, 0x46, -1},  // 0x63
+    {false, 0x56, -1},  // 0x64
+    {false, 0x66, -1},  // 0x65
+    {false, 0x76, -1},  // 0x66
+    {false, 0x86, -1},  // 0x67
+    {true, 0x16, -1},  // 0x68
+    {true, 0x26, -1},  // 0x69
+    {true, 0x36, -1},  // 0x6A
+    {true, 0x46, -1},  // 0x6B
+    {true, 0x56, -1},  // 0x6C
+    {true, 0x66, -1},  // 0x6D
+    {true, 0x76, -1},  // 0x6E
+    {true, 0x86, -1},  // 0x6F
+    {false, 0x17, -1},  // 0x70
+    {false, 0x27, -1},  // 0x71
+    {false, 0x37, -1},  // 0x72
+    {false, 0x47, -1},  // 0x73
+    {false, 0x61,  7},  // 0x74
+    {false, 0x61,  4},  // 0x75
+    {false, 0x61,  1},  // 0x76
+    {false, 0x61,  0},  // 0x77
+    {true, 0x17, -1},  // 0x78
+    {true, 0x27, -1},  // 0x79
+    {true, 0x37, -1},  // 0x7A
+    {true, 0x47, -1},  // 0x7B
+    {false, 0x48,  7},  // 0x7C
+    {false, 0x48,  4},  // 0x7D
+    {false, 0x48,  1},  // 0x7E
+    {false, 0x48,  0},  // 0x7F
+    {false, 0x18, -1},  // 0x80
+    {false, 0x28, -1},  // 0x81
+    {false, 0x38, -1},  // 0x82
+    {false, 0x48, -1},  // 0x83
+    {false, 0x61,  8},  // 0x84
+    {false, 0x61,  5},  // 0x85
+    {false, 0x61,  2},  // 0x86
+    {false, 0x88, -1},  // 0x87
+    {true, 0x18, -1},  // 0x88
+    {true, 0x28, -1},  // 0x89
+    {true, 0x38, -1},  // 0x8A
+    {true, 0x48, -1},  // 0x8B
+    {false, 0x48,  8},  // 0x8C
+    {false, 0x48,  5},  // 0x8D
+    {false, 0x48,  2},  // 0x8E
+    {true, 0x88, -1},  // 0x8F
+    {false, 0x19, -1},  // 0x90
+    {false, 0x29, -1},  // 0x91
+    {false, 0x39, -1},  // 0x92
+    {false, 0x49, -1},  // 0x93
+    {false, 0x61,  9},  // 0x94
+    {false, 0x61,  6},  // 0x95
+    {false, 0x61,  3},  // 0x96
+    {false, 0x89, -1},  // 0x97
+    {true, 0x19, -1},  // 0x98
+    {true, 0x29, -1},  // 0x99
+    {true, 0x39, -1},  // 0x9A
+    {true, 0x49, -1},  // 0x9B
+    {false, 0x48,  9},  // 0x9C
+    {false, 0x48,  6},  // 0x9D
+    {false, 0x48,  3},  // 0x9E
+    {true, 0x89, -1},  // 0x9F
+    {false, 0x1A, -1},  // 0xA0
+    {false, 0x2A, -1},  // 0xA1
+    {false, 0x3A, -1},  // 0xA2
+    {false, 0x4A, -1},  // 0xA3
+    {false, 0x5A, -1},  // 0xA4
+    {false, 0x6A, -1},  // 0xA5
+    {false, 0x7A, -1},  // 0xA6
+    {false, 0x8A, -1},  // 0xA7
+    {true, 0x1A, -1},  // 0xA8
+    {true, 0x2A, -1},  // 0xA9
+    {true, 0x3A, -1},  // 0xAA
+    {true, 0x4A, -1},  // 0xAB
+    {true, 0x5A, -1},  // 0xAC
+    {true, 0x6A, -1},  // 0xAD
+    {true, 0x7A, -1},  // 0xAE
+    {true, 0x8A, -1},  // 0xAF
+    {false, 0x33,  0},  // 0xB0
+    {false, 0x33,  1},  // 0xB1
+    {false, 0x33,  2},  // 0xB2
+    {false, 0x33,  3},  // 0xB3
+    {false, 0x33,  4},  // 0xB4
+    {false, 0x33,  5},  // 0xB5
+    {false, 0x33,  6},  // 0xB6
+    {false, 0x33,  7},  // 0xB7
+    {true, 0x33,  0},  // 0xB8
+    {true, 0x33,  1},  // 0xB9
+    {true, 0x33,  2},  // 0xBA
+    {true, 0x33,  3},  // 0xBB
+    {true, 0x33,  4},  // 0xBC
+    {true, 0x33,  5},  // 0xBD
+    {true, 0x33,  6},  // 0xBE
+    {true, 0x33,  7},  // 0xBF
+    {false, 0x38,  0},  // 0xC0
+    {false, 0x38,  1},  // 0xC1
+    {false, 0x38,  2},  // 0xC2
+    {false, 0x38,  3},  // 0xC3
+    {false, 0x38,  4},  // 0xC4
+    {false, 0x38,  5},  // 0xC5
+    {false, 0x38,  6},  // 0xC6
+    {false, 0x38,  7},  // 0xC7
+    {true, 0x38,  0},  // 0xC8
+    {true, 0x38,  1},  // 0xC9
+    {true, 0x38,  2},  // 0xCA
+    {true, 0x38,  3},  // 0xCB
+    {true, 0x38,  4},  // 0xCC
+    {true, 0x38,  5},  // 0xCD
+    {true, 0x38,  6},  // 0xCE
+    {true, 0x38,  7},  // 0xCF
+    {false, 0x34,  0},  // 0xD0
+    {false, 0x34,  1},  // 0xD1
+    {false, 0x34,  2},  // 0xD2
+    {false, 0x34,  3},  // 0xD3
+    {false, 0x34,  4},  // 0xD4
+    {false, 0x34,  5},  // 0xD5
+    {false, 0x34,  6},  // 0xD6
+    {false, 0x34,  7},  // 0xD7
+    {true, 0x34,  0},  // 0xD8
+    {true, 0x34,  1},  // 0xD9
+    {true, 0x34,  2},  // 0xDA
+    {true, 0x34,  3},  // 0xDB
+    {true, 0x34,  4},  // 0xDC
+    {true, 0x34,  5},  // 0xDD
+    {true, 0x34,  6},  // 0xDE
+    {true, 0x34,  7},  // 0xDF
+    {false, 0x39,  0},  // 0xE0
+    {false, 0x39,  1},  // 0xE1
+    {false, 0x39,  2},  // 0xE2
+    {false, 0x39,  3},  // 0xE3
+    {false, 0x39,  4},  // 0xE4
+    {false, 0x39,  5},  // 0xE5
+    {false, 0x39,  6},  // 0xE6
+    {false, 0x39,  7},  // 0xE7
+    {true, 0x39,  0},  // 0xE8
+    {true, 0x39,  1},  // 0xE9
+    {true, 0x39,  2},  // 0xEA
+    {true, 0x39,  3},  // 0xEB
+    {true, 0x39,  4},  // 0xEC
+    {true, 0x39,  5},  // 0xED
+    {true, 0x39,  6},  // 0xEE
+    {true, 0x39,  7},  // 0xEF
+    {false, 0x32,  0},  // 0xF0
+    {false, 0x32,  1},  // 0xF1
+    {false, 0x32,  2},  // 0xF2
+    {false, 0x32,  3},  // 0xF3
+    {false, 0x32,  4},  // 0xF4
+    {false, 0x32,  5},  // 0xF5
+    {false, 0x32,  6},  // 0xF6
+    {false, 0x32,  7},  // 0xF7
+    {true, 0x32,  0},  // 0xF8
+    {true, 0x32,  1},  // 0xF9
+    {true, 0x32,  2},  // 0xFA
+    {true, 0x32,  3},  // 0xFB
+    {true, 0x32,  4},  // 0xFC
+    {true, 0x32,  5},  // 0xFD
+    {true, 0x32,  6},  // 0xFE
+    {true, 0x32,  7},  // 0xFF
+};
+
+#if PLATFORM57_STRINGS
+
+const char *const OPS57_ASCII[256] = {
+    "0",  // 0x00
+    "1",  // 0x01
+    "2",  // 0x02
+    "3",  // 0x03
+    "4",  // 0x04
+    "5",  // 0x05
+    "6",  // 0x06
+    "7",  // 0x07
+    "8",  // 0x08
+    "9",  // 0x09
+    "A",  // 0x0A
+    "B",  // 0x0B
+    "C",  // 0x0C
+    "D",  // 0x0D
+    "E",  // 0x0E
+    "F",  // 0x0F
+    "2ND",  // 0x10
+    "LRN",  // 0x11
+    "SST",  // 0x12
+    "BST",  // 0x13
+    "GTO",  // 0x14
+    "SBR",  // 0x15
+    "RST",  // 0x16
+    "R/S",  // 0x17
+    "INV 2ND",  // 0x18
+    "INV LRN",  // 0x19
+    "INV SST",  // 0x1A
+    "INV BST",  // 0x1B
+    "INV GTO",  // 0x1C
+    "INV SBR",  // 0x1D
+    "INV RST",  // 0x1E
+    "INV R/S",  // 0x1F
+    "INV",  // 0x20
+    "X/T",  // 0x21
+    "STO",  // 0x22
+    "EE",  // 0x23
+    "LBL 7",  // 0x24
+    "LBL 4",  // 0x25
+    "LBL 1",  // 0x26
+    "LBL 0",  // 0x27
+    "INV INV",  // 0x28
+    "INV X/T",  // 0x29
+    "INV STO",  // 0x2A
+    "INV EE",  // 0x2B
+    "GTO 7",  // 0x2C
+    "GTO 4",  // 0x2D
+    "GTO 1",  // 0x2E
+    "GTO 0",  // 0x2F
+    "LNX",  // 0x30
+    "X^2",  // 0x31
+    "RCL",  // 0x32
+    "(",  // 0x33
+    "LBL 8",  // 0x34
+    "LBL 5",  // 0x35
+    "LBL 2",  // 0x36
+    ".",  // 0x37
+    "INV LNX",  // 0x38
+    "INV X^2",  // 0x39
+    "INV RCL",  // 0x3A
+    "INV (",  // 0x3B
+    "GTO 8",  // 0x3C
+    "GTO 5",  // 0x3D
+    "GTO 2",  // 0x3E
+    "INV .",  // 0x3F
+    "CE",  // 0x40
+    "vX",  // 0x41
+    "SUM",  // 0x42
+    ")",  // 0x43
+    "LBL 9",  // 0x44
+    "LBL 6",  // 0x45
+    "LBL 3",  // 0x46
+    "+/-",  // 0x47
+    "INV CE",  // 0x48
+    "INV vX",  // 0x49
+    "INV SUM",  // 0x4A
+    "INV )",  // 0x4B
+    "GTO 9",  // 0x4C
+    "GTO 6",  // 0x4D
+    "GTO 3",  // 0x4E
+    "INV +/-",  // 0x4F
+    "CLR",  // 0x50
+    "1/X",  // 0x51
+    "Y^X",  // 0x52
+    "/",  // 0x53
+    "x",  // 0x54
+    "-",  // 0x55
+    "+",  // 0x56
+    "=",  // 0x57
+    "INV CLR",  // 0x58
+    "INV 1/X",  // 0x59
+    "INV Y^X",  // 0x5A
+    "INV /",  // 0x5B
+    "INV x",  // 0x5C
+    "INV -",  // 0x5D
+    "INV +",  // 0x5E
+    "INV =",  // 0x5F
+    "2N2",  // 0x60
+    "DMS",  // 0x61
+    "PAU",  // 0x62
+    "NOP",  // 0x63
+    "DSZ",  // 0x64
+    "X=T",  // 0x65
+    "X>T",  // 0x66
+    "LBL",  // 0x67
+    "INV 2N2",  // 0x68
+    "INV DMS",  // 0x69
+    "INV PAU",  // 0x6A
+    "INV NOP",  // 0x6B
+    "INV DSZ",  // 0x6C
+    "INV X=T",  // 0x6D
+    "INV X>T",  // 0x6E
+    "INV LBL",  // 0x6F
+    "IN2",  // 0x70
+    "P-R",  // 0x71
+    "INS",  // 0x72
+    "DEL",  // 0x73
+    "SBR 7",  // 0x74
+    "SBR 4",  // 0x75
+    "SBR 1",  // 0x76
+    "SBR 0",  // 0x77
+    "INV IN2",  // 0x78
+    "INV P-R",  // 0x79
+    "INV INS",  // 0x7A
+    "INV DEL",  // 0x7B
+    "FIX 7",  // 0x7C
+    "FIX 4",  // 0x7D
+    "FIX 1",  // 0x7E
+    "FIX 0",  // 0x7F
+    "LOG",  // 0x80
+    "SIN",  // 0x81
+    "EXC",  // 0x82
+    "FIX",  // 0x83
+    "SBR 8",  // 0x84
+    "SBR 5",  // 0x85
+    "SBR 2",  // 0x86
+    "s+",  // 0x87
+    "INV LOG",  // 0x88
+    "INV SIN",  // 0x89
+    "INV EXC",  // 0x8A
+    "INV FIX",  // 0x8B
+    "FIX 8",  // 0x8C
+    "FIX 5",  // 0x8D
+    "FIX 2",  // 0x8E
+    "INV s+",  // 0x8F
+    "CT",  // 0x90
+    "COS",  // 0x91
+    "PRD",  // 0x92
+    "INT",  // 0x93
+    "SBR 9",  // 0x94
+    "SBR 6",  // 0x95
+    "SBR 3",  // 0x96
+    "@",  // 0x97
+    "INV CT",  // 0x98
+    "INV COS",  // 0x99
+    "INV PRD",  // 0x9A
+    "INV INT",  // 0x9B
+    "FIX 9",  // 0x9C
+    "FIX 6",  // 0x9D
+    "FIX 3",  // 0x9E
+    "INV @",  // 0x9F
+    "CL2",  // 0xA0
+    "TAN",  // 0xA1
+    "PI",  // 0xA2
+    "|X|",  // 0xA3
+    "DEG",  // 0xA4
+    "RAD",  // 0xA5
+    "GRD",  // 0xA6
+    "g^2",  // 0xA7
+    "INV CL2",  // 0xA8
+    "INV TAN",  // 0xA9
+    "INV PI",  // 0xAA
+    "INV |X|",  // 0xAB
+    "INV DEG",  // 0xAC
+    "INV RAD",  // 0xAD
+    "INV GRD",  // 0xAE
+    "INV g^2",  // 0xAF
+    "RCL 0",  // 0xB0
+    "RCL 1",  // 0xB1
+    "RCL 2",  // 0xB2
+    "RCL 3",  // 0xB3
+    "RCL 4",  // 0xB4
+    "RCL 5",  // 0xB5
+    "RCL 6",  // 0xB6
+    "RCL 7",  // 0xB7
+    "INV RCL 0",  // 0xB8
+    "INV RCL 1",  // 0xB9
+    "INV RCL 2",  // 0xBA
+    "INV RCL 3",  // 0xBB
+    "INV RCL 4",  // 0xBC
+    "INV RCL 5",  // 0xBD
+    "INV RCL 6",  // 0xBE
+    "INV RCL 7",  // 0xBF
+    "EXC 0",  // 0xC0
+    "EXC 1",  // 0xC1
+    "EXC 2",  // 0xC2
+    "EXC 3",  // 0xC3
+    "EXC 4",  // 0xC4
+    "EXC 5",  // 0xC5
+    "EXC 6",  // 0xC6
+    "EXC 7",  // 0xC7
+    "INV EXC 0",  // 0xC8
+    "INV EXC 1",  // 0xC9
+    "INV EXC 2",  // 0xCA
+    "INV EXC 3",  // 0xCB
+    "INV EXC 4",  // 0xCC
+    "INV EXC 5",  // 0xCD
+    "INV EXC 6",  // 0xCE
+    "INV EXC 7",  // 0xCF
+    "SUM 0",  // 0xD0
+    "SUM 1",  // 0xD1
+    "SUM 2",  // 0xD2
+    "SUM 3",  // 0xD3
+    "SUM 4",  // 0xD4
+    "SUM 5",  // 0xD5
+    "SUM 6",  // 0xD6
+    "SUM 7",  // 0xD7
+    "INV SUM 0",  // 0xD8
+    "INV SUM 1",  // 0xD9
+    "INV SUM 2",  // 0xDA
+    "INV SUM 3",  // 0xDB
+    "INV SUM 4",  // 0xDC
+    "INV SUM 5",  // 0xDD
+    "INV SUM 6",  // 0xDE
+    "INV SUM 7",  // 0xDF
+    "PRD 0",  // 0xE0
+    "PRD 1",  // 0xE1
+    "PRD 2",  // 0xE2
+    "PRD 3",  // 0xE3
+    "PRD 4",  // 0xE4
+    "PRD 5",  // 0xE5
+    "PRD 6",  // 0xE6
+    "PRD 7",  // 0xE7
+    "INV PRD 0",  // 0xE8
+    "INV PRD 1",  // 0xE9
+    "INV PRD 2",  // 0xEA
+    "INV PRD 3",  // 0xEB
+    "INV PRD 4",  // 0xEC
+    "INV PRD 5",  // 0xED
+    "INV PRD 6",  // 0xEE
+    "INV PRD 7",  // 0xEF
+    "STO 0",  // 0xF0
+    "STO 1",  // 0xF1
+    "STO 2",  // 0xF2
+    "STO 3",  // 0xF3
+    "STO 4",  // 0xF4
+    "STO 5",  // 0xF5
+    "STO 6",  // 0xF6
+    "STO 7",  // 0xF7
+    "INV STO 0",  // 0xF8
+    "INV STO 1",  // 0xF9
+    "INV STO 2",  // 0xFA
+    "INV STO 3",  // 0xFB
+    "INV STO 4",  // 0xFC
+    "INV STO 5",  // 0xFD
+    "INV STO 6",  // 0xFE
+    "INV STO 7",  // 0xFF
+};
+
+const char *const OPS57_UNICODE[256] = {
+    "0",  // 0x00
+    "1",  // 0x01
+    "2",  // 0x02
+    "3",  // 0x03
+    "4",  // 0x04
+    "5",  // 0x05
+    "6",  // 0x06
+    "7",  // 0x07
+    "8",  // 0x08
+    "9",  // 0x09
+    "A",  // 0x0A
+    "B",  // 0x0B
+    "C",  // 0x0C
+    "D",  // 0x0D
+    "E",  // 0x0E
+    "F",  // 0x0F
+    "2nd",  // 0x10
+    "LRN",  // 0x11
+    "SST",  // 0x12
+    "BST",  // 0x13
+    "GTO",  // 0x14
+    "SBR",  // 0x15
+    "RST",  // 0x16
+    "R/S",  // 0x17
+    "INV 2nd",  // 0x18
+    "INV LRN",  // 0x19
+    "INV SST",  // 0x1A
+    "INV BST",  // 0x1B
+    "INV GTO",  // 0x1C
+    "INV SBR",  // 0x1D
+    "INV RST",  // 0x1E
+    "INV R/S",  // 0x1F
+    "INV",  // 0x20
+    "x:t",  // 0x21
+    "STO",  // 0x22
+    "EE",  // 0x23
+    "Lbl 7",  // 0x24
+    "Lbl 4",  // 0x25
+    "Lbl 1",  // 0x26
+    "Lbl 0",  // 0x27
+    "INV INV",  // 0x28
+    "INV x:t",  // 0x29
+    "INV STO",  // 0x2A
+    "INV EE",  // 0x2B
+    "GTO 7",  // 0x2C
+    "GTO 4",  // 0x2D
+    "GTO 1",  // 0x2E
+    "GTO 0",  // 0x2F
+    "lnx",  // 0x30
+    "x\302\262",  // 0x31
+    "RCL",  // 0x32
+    "(",  // 0x33
+    "Lbl 8",  // 0x34
+    "Lbl 5",  // 0x35
+    "Lbl 2",  // 0x36
+    ".",  // 0x37
+    "INV lnx",  // 0x38
+    "INV x\302\262",  // 0x39
+    "INV RCL",  // 0x3A
+    "INV (",  // 0x3B
+    "GTO 8",  // 0x3C
+    "GTO 5",  // 0x3D
+    "GTO 2",  // 0x3E
+    "INV .",  // 0x3F
+    "CE",  // 0x40
+    "\342\210\232x",  // 0x41
+    "SUM",  // 0x42
+    ")",  // 0x43
+    "Lbl 9",  // 0x44
+    "Lbl 6",  // 0x45
+    "Lbl 3",  // 0x46
+    "+/-",  // 0x47
+    "INV CE",  // 0x48
+    "INV \342\210\232x",  // 0x49
+    "INV SUM",  // 0x4A
+    "INV )",  // 0x4B
+    "GTO 9",  // 0x4C
+    "GTO 6",  // 0x4D
+    "GTO 3",  // 0x4E
+    "INV +/-",  // 0x4F
+    "CLR",  // 0x50
+    "1/x",  // 0x51
+    "y\313\243",  // 0x52
+    "/",  // 0x53
+    "x",  // 0x54
+    "-",  // 0x55
+    "+",  // 0x56
+    "=",  // 0x57
+    "INV CLR",  // 0x58
+    "INV 1/x",  // 0x59
+    "INV y\313\243",  // 0x5A
+    "INV /",  // 0x5B
+    "INV x",  // 0x5C
+    "INV -",  // 0x5D
+    "INV +",  // 0x5E
+    "INV =",  // 0x5F
+    "2n2",  // 0x60
+    "D.MS",  // 0x61
+    "Pause",  // 0x62
+    "Nop",  // 0x63
+    "Dsz",  // 0x64
+    "x=t",  // 0x65
+    "x\342\211\245t",  // 0x66
+    "Lbl",  // 0x67
+    "INV 2n2",  // 0x68
+    "INV D.MS",  // 0x69
+    "INV Pause",  // 0x6A
+    "INV Nop",  // 0x6B
+    "INV Dsz",  // 0x6C
+    "INV x=t",  // 0x6D
+    "INV x\342\211\245t",  // 0x6E
+    "INV Lbl",  // 0x6F
+    "IN2",  // 0x70
+    "P\342\206\222R",  // 0x71
+    "Ins",  // 0x72
+    "Del",  // 0x73
+    "SBR 7",  // 0x74
+    "SBR 4",  // 0x75
+    "SBR 1",  // 0x76
+    "SBR 0",  // 0x77
+    "INV IN2",  // 0x78
+    "INV P\342\206\222R",  // 0x79
+    "INV Ins",  // 0x7A
+    "INV Del",  // 0x7B
+    "Fix 7",  // 0x7C
+    "Fix 4",  // 0x7D
+    "Fix 1",  // 0x7E
+    "Fix 0",  // 0x7F
+    "log",  // 0x80
+    "sin",  // 0x81
+    "Exc",  // 0x82
+    "Fix",  // 0x83
+    "SBR 8",  // 0x84
+    "SBR 5",  // 0x85
+    "SBR 2",  // 0x86
+    "\316\243+",  // 0x87
+    "INV log",  // 0x88
+    "INV sin",  // 0x89
+    "INV Exc",  // 0x8A
+    "INV Fix",  // 0x8B
+    "Fix 8",  // 0x8C
+    "Fix 5",  // 0x8D
+    "Fix 2",  // 0x8E
+    "INV \316\243+",  // 0x8F
+    "C.t",  // 0x90
+    "cos",  // 0x91
+    "Prd",  // 0x92
+    "Int",  // 0x93
+    "SBR 9",  // 0x94
+    "SBR 6",  // 0x95
+    "SBR 3",  // 0x96
+    "x\314\205",  // 0x97
+    "INV C.t",  // 0x98
+    "INV cos",  // 0x99
+    "INV Prd",  // 0x9A
+    "INV Int",  // 0x9B
+    "Fix 9",  // 0x9C
+    "Fix 6",  // 0x9D
+    "Fix 3",  // 0x9E
+    "INV x\314\205",  // 0x9F
+    "CLR",  // 0xA0
+    "tan",  // 0xA1
+    "\317\200",  // 0xA2
+    "|x|",  // 0xA3
+    "Deg",  // 0xA4
+    "Rad",  // 0xA5
+    "Grad",  // 0xA6
+    "\317\203\302\262",  // 0xA7
+    "INV CLR",  // 0xA8
+    "INV tan",  // 0xA9
+    "INV \317\200",  // 0xAA
+    "INV |x|",  // 0xAB
+    "INV Deg",  // 0xAC
+    "INV Rad",  // 0xAD
+    "INV Grad",  // 0xAE
+    "INV \317\203\302\262",  // 0xAF
+    "RCL 0",  // 0xB0
+    "RCL 1",  // 0xB1
+    "RCL 2",  // 0xB2
+    "RCL 3",  // 0xB3
+    "RCL 4",  // 0xB4
+    "RCL 5",  // 0xB5
+    "RCL 6",  // 0xB6
+    "RCL 7",  // 0xB7
+    "INV RCL 0",  // 0xB8
+    "INV RCL 1",  // 0xB9
+    "INV RCL 2",  // 0xBA
+    "INV RCL 3",  // 0xBB
+    "INV RCL 4",  // 0xBC
+    "INV RCL 5",  // 0xBD
+    "INV RCL 6",  // 0xBE
+    "INV RCL 7",  // 0xBF
+    "Exc 0",  // 0xC0
+    "Exc 1",  // 0xC1
+    "Exc 2",  // 0xC2
+    "Exc 3",  // 0xC3
+    "Exc 4",  // 0xC4
+    "Exc 5",  // 0xC5
+    "Exc 6",  // 0xC6
+    "Exc 7",  // 0xC7
+    "INV Exc 0",  // 0xC8
+    "INV Exc 1",  // 0xC9
+    "INV Exc 2",  // 0xCA
+    "INV Exc 3",  // 0xCB
+    "INV Exc 4",  // 0xCC
+    "INV Exc 5",  // 0xCD
+    "INV Exc 6",  // 0xCE
+    "INV Exc 7",  // 0xCF
+    "SUM 0",  // 0xD0
+    "SUM 1",  // 0xD1
+    "SUM 2",  // 0xD2
+    "SUM 3",  // 0xD3
+    "SUM 4",  // 0xD4
+    "SUM 5",  // 0xD5
+    "SUM 6",  // 0xD6
+    "SUM 7",  // 0xD7
+    "INV SUM 0",  // 0xD8
+    "INV SUM 1",  // 0xD9
+    "INV SUM 2",  // 0xDA
+    "INV SUM 3",  // 0xDB
+    "INV SUM 4",  // 0xDC
+    "INV SUM 5",  // 0xDD
+    "INV SUM 6",  // 0xDE
+    "INV SUM 7",  // 0xDF
+    "Prd 0",  // 0xE0
+    "Prd 1",  // 0xE1
+    "Prd 2",  // 0xE2
+    "Prd 3",  // 0xE3
+    "Prd 4",  // 0xE4
+    "Prd 5",  // 0xE5
+    "Prd 6",  // 0xE6
+    "Prd 7",  // 0xE7
+    "INV Prd 0",  // 0xE8
+    "INV Prd 1",  // 0xE9
+    "INV Prd 2",  // 0xEA
+    "INV Prd 3",  // 0xEB
+    "INV Prd 4",  // 0xEC
+    "INV Prd 5",  // 0xED
+    "INV Prd 6",  // 0xEE
+    "INV Prd 7",  // 0xEF
+    "STO 0",  // 0xF0
+    "STO 1",  // 0xF1
+    "STO 2",  // 0xF2
+    "STO 3",  // 0xF3
+    "STO 4",  // 0xF4
+    "STO 5",  // 0xF5
+    "STO 6",  // 0xF6
+    "STO 7",  // 0xF7
+    "INV STO 0",  // 0xF8
+    "INV STO 1",  // 0xF9
+    "INV STO 2",  // 0xFA
+    "INV STO 3",  // 0xFB
+    "INV STO 4",  // 0xFC
+    "INV STO 5",  // 0xFD
+    "INV STO 6",  // 0xFE
+    "INV STO 7",  // 0xFF
+};
+
+const char *const OPS57_ASCII_PENDING[256] = {
+    "0",  // 0x00
+    "1",  // 0x01
+    "2",  // 0x02
+    "3",  // 0x03
+    "4",  // 0x04
+    "5",  // 0x05
+    "6",  // 0x06
+    "7",  // 0x07
+    "8",  // 0x08
+    "9",  // 0x09
+    "A",  // 0x0A
+    "B",  // 0x0B
+    "C",  // 0x0C
+    "D",  // 0x0D
+    "E",  // 0x0E
+    "F",  // 0x0F
+    "2ND",  // 0x10
+    "LRN",  // 0x11
+    "SST",  // 0x12
+    "BST",  // 0x13
+    "GTO",  // 0x14
+    "SBR",  // 0x15
+    "RST",  // 0x16
+    "R/S",  // 0x17
+    "INV 2ND",  // 0x18
+    "INV LRN",  // 0x19
+    "INV SST",  // 0x1A
+    "INV BST",  // 0x1B
+    "INV GTO",  // 0x1C
+    "INV SBR",  // 0x1D
+    "INV RST",  // 0x1E
+    "INV R/S",  // 0x1F
+    "INV",  // 0x20
+    "X/T",  // 0x21
+    "STO",  // 0x22
+    "EE",  // 0x23
+    "LBL _",  // 0x24
+    "LBL _",  // 0x25
+    "LBL _",  // 0x26
+    "LBL _",  // 0x27
+    "INV INV",  // 0x28
+    "INV X/T",  // 0x29
+    "INV STO",  // 0x2A
+    "INV EE",  // 0x2B
+    "GTO _",  // 0x2C
+    "GTO _",  // 0x2D
+    "GTO _",  // 0x2E
+    "GTO _",  // 0x2F
+    "LNX",  // 0x30
+    "X^2",  // 0x31
+    "RCL",  // 0x32
+    "(",  // 0x33
+    "LBL _",  // 0x34
+    "LBL _",  // 0x35
+    "LBL _",  // 0x36
+    ".",  // 0x37
+    "INV LNX",  // 0x38
+    "INV X^2",  // 0x39
+    "INV RCL",  // 0x3A
+    "INV (",  // 0x3B
+    "GTO _",  // 0x3C
+    "GTO _",  // 0x3D
+    "GTO _",  // 0x3E
+    "INV .",  // 0x3F
+    "CE",  // 0x40
+    "vX",  // 0x41
+    "SUM",  // 0x42
+    ")",  // 0x43
+    "LBL _",  // 0x44
+    "LBL _",  // 0x45
+    "LBL _",  // 0x46
+    "+/-",  // 0x47
+    "INV CE",  // 0x48
+    "INV vX",  // 0x49
+    "INV SUM",  // 0x4A
+    "INV )",  // 0x4B
+    "GTO _",  // 0x4C
+    "GTO _",  // 0x4D
+    "GTO _",  // 0x4E
+    "INV +/-",  // 0x4F
+    "CLR",  // 0x50
+    "1/X",  // 0x51
+    "Y^X",  // 0x52
+    "/",  // 0x53
+    "x",  // 0x54
+    "-",  // 0x55
+    "+",  // 0x56
+    "=",  // 0x57
+    "INV CLR",  // 0x58
+    "INV 1/X",  // 0x59
+    "INV Y^X",  // 0x5A
+    "INV /",  // 0x5B
+    "INV x",  // 0x5C
+    "INV -",  // 0x5D
+    "INV +",  // 0x5E
+    "INV =",  // 0x5F
+    "2N2",  // 0x60
+    "DMS",  // 0x61
+    "PAU",  // 0x62
+    "NOP",  // 0x63
+    "DSZ",  // 0x64
+    "X=T",  // 0x65
+    "X>T",  // 0x66
+    "LBL",  // 0x67
+    "INV 2N2",  // 0x68
+    "INV DMS",  // 0x69
+    "INV PAU",  // 0x6A
+    "INV NOP",  // 0x6B
+    "INV DSZ",  // 0x6C
+    "INV X=T",  // 0x6D
+    "INV X>T",  // 0x6E
+    "INV LBL",  // 0x6F
+    "IN2",  // 0x70
+    "P-R",  // 0x71
+    "INS",  // 0x72
+    "DEL",  // 0x73
+    "SBR _",  // 0x74
+    "SBR _",  // 0x75
+    "SBR _",  // 0x76
+    "SBR _",  // 0x77
+    "INV IN2",  // 0x78
+    "INV P-R",  // 0x79
+    "INV INS",  // 0x7A
+    "INV DEL",  // 0x7B
+    "FIX _",  // 0x7C
+    "FIX _",  // 0x7D
+    "FIX _",  // 0x7E
+    "FIX _",  // 0x7F
+    "LOG",  // 0x80
+    "SIN",  // 0x81
+    "EXC",  // 0x82
+    "FIX",  // 0x83
+    "SBR _",  // 0x84
+    "SBR _",  // 0x85
+    "SBR _",  // 0x86
+    "s+",  // 0x87
+    "INV LOG",  // 0x88
+    "INV SIN",  // 0x89
+    "INV EXC",  // 0x8A
+    "INV FIX",  // 0x8B
+    "FIX _",  // 0x8C
+    "FIX _",  // 0x8D
+    "FIX _",  // 0x8E
+    "INV s+",  // 0x8F
+    "CT",  // 0x90
+    "COS",  // 0x91
+    "PRD",  // 0x92
+    "INT",  // 0x93
+    "SBR _",  // 0x94
+    "SBR _",  // 0x95
+    "SBR _",  // 0x96
+    "@",  // 0x97
+    "INV CT",  // 0x98
+    "INV COS",  // 0x99
+    "INV PRD",  // 0x9A
+    "INV INT",  // 0x9B
+    "FIX _",  // 0x9C
+    "FIX _",  // 0x9D
+    "FIX _",  // 0x9E
+    "INV @",  // 0x9F
+    "CL2",  // 0xA0
+    "TAN",  // 0xA1
+    "PI",  // 0xA2
+    "|X|",  // 0xA3
+    "DEG",  // 0xA4
+    "RAD",  // 0xA5
+    "GRD",  // 0xA6
+    "g^2",  // 0xA7
+    "INV CL2",  // 0xA8
+    "INV TAN",  // 0xA9
+    "INV PI",  // 0xAA
+    "INV |X|",  // 0xAB
+    "INV DEG",  // 0xAC
+    "INV RAD",  // 0xAD
+    "INV GRD",  // 0xAE
+    "INV g^2",  // 0xAF
+    "RCL _",  // 0xB0
+    "RCL _",  // 0xB1
+    "RCL _",  // 0xB2
+    "RCL _",  // 0xB3
+    "RCL _",  // 0xB4
+    "RCL _",  // 0xB5
+    "RCL _",  // 0xB6
+    "RCL _",  // 0xB7
+    "INV RCL _",  // 0xB8
+    "INV RCL _",  // 0xB9
+    "INV RCL _",  // 0xBA
+    "INV RCL _",  // 0xBB
+    "INV RCL _",  // 0xBC
+    "INV RCL _",  // 0xBD
+    "INV RCL _",  // 0xBE
+    "INV RCL _",  // 0xBF
+    "EXC _",  // 0xC0
+    "EXC _",  // 0xC1
+    "EXC _",  // 0xC2
+    "EXC _",  // 0xC3
+    "EXC _",  // 0xC4
+    "EXC _",  // 0xC5
+    "EXC _",  // 0xC6
+    "EXC _",  // 0xC7
+    "INV EXC _",  // 0xC8
+    "INV EXC _",  // 0xC9
+    "INV EXC _",  // 0xCA
+    "INV EXC _",  // 0xCB
+    "INV EXC _",  // 0xCC
+    "INV EXC _",  // 0xCD
+    "INV EXC _",  // 0xCE
+    "INV EXC _",  // 0xCF
+    "SUM _",  // 0xD0
+    "SUM _",  // 0xD1
+    "SUM _",  // 0xD2
+    "SUM _",  // 0xD3
+    "SUM _",  // 0xD4
+    "SUM _",  // 0xD5
+    "SUM _",  // 0xD6
+    "SUM _",  // 0xD7
+    "INV SUM _",  // 0xD8
+    "INV SUM _",  // 0xD9
+    "INV SUM _",  // 0xDA
+    "INV SUM _",  // 0xDB
+    "INV SUM _",  // 0xDC
+    "INV SUM _",  // 0xDD
+    "INV SUM _",  // 0xDE
+    "INV SUM _",  // 0xDF
+    "PRD _",  // 0xE0
+    "PRD _",  // 0xE1
+    "PRD _",  // 0xE2
+    "PRD _",  // 0xE3
+    "PRD _",  // 0xE4
+    "PRD _",  // 0xE5
+    "PRD _",  // 0xE6
+    "PRD _",  // 0xE7
+    "INV PRD _",  // 0xE8
+    "INV PRD _",  // 0xE9
+    "INV PRD _",  // 0xEA
+    "INV PRD _",  // 0xEB
+    "INV PRD _",  // 0xEC
+    "INV PRD _",  // 0xED
+    "INV PRD _",  // 0xEE
+    "INV PRD _",  // 0xEF
+    "STO _",  // 0xF0
+    "STO _",  // 0xF1
+    "STO _",  // 0xF2
+    "STO _",  // 0xF3
+    "STO _",  // 0xF4
+    "STO _",  // 0xF5
+    "STO _",  // 0xF6
+    "STO _",  // 0xF7
+    "INV STO _",  // 0xF8
+    "INV STO _",  // 0xF9
+    "INV STO _",  // 0xFA
+    "INV STO _",  // 0xFB
+    "INV STO _",  // 0xFC
+    "INV STO _",  // 0xFD
+    "INV STO _",  // 0xFE
+    "INV STO _",  // 0xFF
+};
+
+const char *const OPS57_UNICODE_PENDING[256] = {
+    "0",  // 0x00
+    "1",  // 0x01
+    "2",  // 0x02
+    "3",  // 0x03
+    "4",  // 0x04
+    "5",  // 0x05
+    "6",  // 0x06
+    "7",  // 0x07
+    "8",  // 0x08
+    "9",  // 0x09
+    "A",  // 0x0A
+    "B",  // 0x0B
+    "C",  // 0x0C
+    "D",  // 0x0D
+    "E",  // 0x0E
+    "F",  // 0x0F
+    "2nd",  // 0x10
+    "LRN",  // 0x11
+    "SST",  // 0x12
+    "BST",  // 0x13
+    "GTO",  // 0x14
+    "SBR",  // 0x15
+    "RST",  // 0x16
+    "R/S",  // 0x17
+    "INV 2nd",  // 0x18
+    "INV LRN",  // 0x19
+    "INV SST",  // 0x1A
+    "INV BST",  // 0x1B
+    "INV GTO",  // 0x1C
+    "INV SBR",  // 0x1D
+    "INV RST",  // 0x1E
+    "INV R/S",  // 0x1F
+    "INV",  // 0x20
+    "x:t",  // 0x21
+    "STO",  // 0x22
+    "EE",  // 0x23
+    "Lbl _",  // 0x24
+    "Lbl _",  // 0x25
+    "Lbl _",  // 0x26
+    "Lbl _",  // 0x27
+    "INV INV",  // 0x28
+    "INV x:t",  // 0x29
+    "INV STO",  // 0x2A
+    "INV EE",  // 0x2B
+    "GTO _",  // 0x2C
+    "GTO _",  // 0x2D
+    "GTO _",  // 0x2E
+    "GTO _",  // 0x2F
+    "lnx",  // 0x30
+    "x\302\262",  // 0x31
+    "RCL",  // 0x32
+    "(",  // 0x33
+    "Lbl _",  // 0x34
+    "Lbl _",  // 0x35
+    "Lbl _",  // 0x36
+    ".",  // 0x37
+    "INV lnx",  // 0x38
+    "INV x\302\262",  // 0x39
+    "INV RCL",  // 0x3A
+    "INV (",  // 0x3B
+    "GTO _",  // 0x3C
+    "GTO _",  // 0x3D
+    "GTO _",  // 0x3E
+    "INV .",  // 0x3F
+    "CE",  // 0x40
+    "\342\210\232x",  // 0x41
+    "SUM",  // 0x42
+    ")",  // 0x43
+    "Lbl _",  // 0x44
+    "Lbl _",  // 0x45
+    "Lbl _",  // 0x46
+    "+/-",  // 0x47
+    "INV CE",  // 0x48
+    "INV \342\210\232x",  // 0x49
+    "INV SUM",  // 0x4A
+    "INV )",  // 0x4B
+    "GTO _",  // 0x4C
+    "GTO _",  // 0x4D
+    "GTO _",  // 0x4E
+    "INV +/-",  // 0x4F
+    "CLR",  // 0x50
+    "1/x",  // 0x51
+    "y\313\243",  // 0x52
+    "/",  // 0x53
+    "x",  // 0x54
+    "-",  // 0x55
+    "+",  // 0x56
+    "=",  // 0x57
+    "INV CLR",  // 0x58
+    "INV 1/x",  // 0x59
+    "INV y\313\243",  // 0x5A
+    "INV /",  // 0x5B
+    "INV x",  // 0x5C
+    "INV -",  // 0x5D
+    "INV +",  // 0x5E
+    "INV =",  // 0x5F
+    "2n2",  // 0x60
+    "D.MS",  // 0x61
+    "Pause",  // 0x62
+    "Nop",  // 0x63
+    "Dsz",  // 0x64
+    "x=t",  // 0x65
+    "x\342\211\245t",  // 0x66
+    "Lbl",  // 0x67
+    "INV 2n2",  // 0x68
+    "INV D.MS",  // 0x69
+    "INV Pause",  // 0x6A
+    "INV Nop",  // 0x6B
+    "INV Dsz",  // 0x6C
+    "INV x=t",  // 0x6D
+    "INV x\342\211\245t",  // 0x6E
+    "INV Lbl",  // 0x6F
+    "IN2",  // 0x70
+    "P\342\206\222R",  // 0x71
+    "Ins",  // 0x72
+    "Del",  // 0x73
+    "SBR _",  // 0x74
+    "SBR _",  // 0x75
+    "SBR _",  // 0x76
+    "SBR _",  // 0x77
+    "INV IN2",  // 0x78
+    "INV P\342\206\222R",  // 0x79
+    "INV Ins",  // 0x7A
+    "INV Del",  // 0x7B
+    "Fix _",  // 0x7C
+    "Fix _",  // 0x7D
+    "Fix _",  // 0x7E
+    "Fix _",  // 0x7F
+    "log",  // 0x80
+    "sin",  // 0x81
+    "Exc",  // 0x82
+    "Fix",  // 0x83
+    "SBR _",  // 0x84
+    "SBR _",  // 0x85
+    "SBR _",  // 0x86
+    "\316\243+",  // 0x87
+    "INV log",  // 0x88
+    "INV sin",  // 0x89
+    "INV Exc",  // 0x8A
+    "INV Fix",  // 0x8B
+    "Fix _",  // 0x8C
+    "Fix _",  // 0x8D
+    "Fix _",  // 0x8E
+    "INV \316\243+",  // 0x8F
+    "C.t",  // 0x90
+    "cos",  // 0x91
+    "Prd",  // 0x92
+    "Int",  // 0x93
+    "SBR _",  // 0x94
+    "SBR _",  // 0x95
+    "SBR _",  // 0x96
+    "x\314\205",  // 0x97
+    "INV C.t",  // 0x98
+    "INV cos",  // 0x99
+    "INV Prd",  // 0x9A
+    "INV Int",  // 0x9B
+    "Fix _",  // 0x9C
+    "Fix _",  // 0x9D
+    "Fix _",  // 0x9E
+    "INV x\314\205",  // 0x9F
+    "CLR",  // 0xA0
+    "tan",  // 0xA1
+    "\317\200",  // 0xA2
+    "|x|",  // 0xA3
+    "Deg",  // 0xA4
+    "Rad",  // 0xA5
+    "Grad",  // 0xA6
+    "\317\203\302\262",  // 0xA7
+    "INV CLR",  // 0xA8
+    "INV tan",  // 0xA9
+    "INV \317\200",  // 0xAA
+    "INV |x|",  // 0xAB
+    "INV Deg",  // 0xAC
+    "INV Rad",  // 0xAD
+    "INV Grad",  // 0xAE
+    "INV \317\203\302\262",  // 0xAF
+    "RCL _",  // 0xB0
+    "RCL _",  // 0xB1
+    "RCL _",  // 0xB2
+    "RCL _",  // 0xB3
+    "RCL _",  // 0xB4
+    "RCL _",  // 0xB5
+    "RCL _",  // 0xB6
+    "RCL _",  // 0xB7
+    "INV RCL _",  // 0xB8
+    "INV RCL _",  // 0xB9
+    "INV RCL _",  // 0xBA
+    "INV RCL _",  // 0xBB
+    "INV RCL _",  // 0xBC
+    "INV RCL _",  // 0xBD
+    "INV RCL _",  // 0xBE
+    "INV RCL _",  // 0xBF
+    "Exc _",  // 0xC0
+    "Exc _",  // 0xC1
+    "Exc _",  // 0xC2
+    "Exc _",  // 0xC3
+    "Exc _",  // 0xC4
+    "Exc _",  // 0xC5
+    "Exc _",  // 0xC6
+    "Exc _",  // 0xC7
+    "INV Exc _",  // 0xC8
+    "INV Exc _",  // 0xC9
+    "INV Exc _",  // 0xCA
+    "INV Exc _",  // 0xCB
+    "INV Exc _",  // 0xCC
+    "INV Exc _",  // 0xCD
+    "INV Exc _",  // 0xCE
+    "INV Exc _",  // 0xCF
+    "SUM _",  // 0xD0
+    "SUM _",  // 0xD1
+    "SUM _",  // 0xD2
+    "SUM _",  // 0xD3
+    "SUM _",  // 0xD4
+    "SUM _",  // 0xD5
+    "SUM _",  // 0xD6
+    "SUM _",  // 0xD7
+    "INV SUM _",  // 0xD8
+    "INV SUM _",  // 0xD9
+    "INV SUM _",  // 0xDA
+    "INV SUM _",  // 0xDB
+    "INV SUM _",  // 0xDC
+    "INV SUM _",  // 0xDD
+    "INV SUM _",  // 0xDE
+    "INV SUM _",  // 0xDF
+    "Prd _",  // 0xE0
+    "Prd _",  // 0xE1
+    "Prd _",  // 0xE2
+    "Prd _",  // 0xE3
+    "Prd _",  // 0xE4
+    "Prd _",  // 0xE5
+    "Prd _",  // 0xE6
+    "Prd _",  // 0xE7
+    "INV Prd _",  // 0xE8
+    "INV Prd _",  // 0xE9
+    "INV Prd _",  // 0xEA
+    "INV Prd _",  // 0xEB
+    "INV Prd _",  // 0xEC
+    "INV Prd _",  // 0xED
+    "INV Prd _",  // 0xEE
+    "INV Prd _",  // 0xEF
+    "STO _",  // 0xF0
+    "STO _",  // 0xF1
+    "STO _",  // 0xF2
+    "STO _",  // 0xF3
+    "STO _",  // 0xF4
+    "STO _",  // 0xF5
+    "STO _",  // 0xF6
+    "STO _",  // 0xF7
+    "INV STO _",  // 0xF8
+    "INV STO _",  // 0xF9
+    "INV STO _",  // 0xFA
+    "INV STO _",  // 0xFB
+    "INV STO _",  // 0xFC
+    "INV STO _",  // 0xFD
+    "INV STO _",  // 0xFE
+    "INV STO _",  // 0xFF
+};
+
+const char *const OPS57_LRN_ALPHA[2][256] = {
+    {
+        "                       0",  // 0x00
+        "                       1",  // 0x01
+        "                       2",  // 0x02
+        "                       3",  // 0x03
+        "                       4",  // 0x04
+        "                       5",  // 0x05
+        "                       6",  // 0x06
+        "                       7",  // 0x07
+        "                       8",  // 0x08
+        "                       9",  // 0x09
+        "                       A",  // 0x0A
+        "                       B",  // 0x0B
+        "                       C",  // 0x0C
+        "                       D",  // 0x0D
+        "                       E",  // 0x0E
+        "                       F",  // 0x0F
+        "                     2ND",  // 0x10
+        "                     LRN",  // 0x11
+        "                     SST",  // 0x12
+        "                     BST",  // 0x13
+        "                     GTO",  // 0x14
+        "                     SBR",  // 0x15
+        "                     RST",  // 0x16
+        "                     R/S",  // 0x17
+        "                 INV 2ND",  // 0x18
+        "                 INV LRN",  // 0x19
+        "                 INV SST",  // 0x1A
+        "                 INV BST",  // 0x1B
+        "                 INV GTO",  // 0x1C
+        "                 INV SBR",  // 0x1D
+        "                 INV RST",  // 0x1E
+        "                 INV R/S",  // 0x1F
+        "                     INV",  // 0x20
+        "                     X/T",  // 0x21
+        "                     STO",  // 0x22
+        "                      EE",  // 0x23
+        "                   LBL 7",  // 0x24
+        "                   LBL 4",  // 0x25
+        "                   LBL 1",  // 0x26
+        "                   LBL 0",  // 0x27
+        "                 INV INV",  // 0x28
+        "                 INV X/T",  // 0x29
+        "                 INV STO",  // 0x2A
+        "                  INV EE",  // 0x2B
+        "                   GTO 7",  // 0x2C
+        "                   GTO 4",  // 0x2D
+        "                   GTO 1",  // 0x2E
+        "                   GTO 0",  // 0x2F
+        "                     LNX",  // 0x30
+        "                     X^2",  // 0x31
+        "                     RCL",  // 0x32
+        "                       (",  // 0x33
+        "                   LBL 8",  // 0x34
+        "                   LBL 5",  // 0x35
+        "                   LBL 2",  // 0x36
+        "                       .",  // 0x37
+        "                 INV LNX",  // 0x38
+        "                 INV X^2",  // 0x39
+        "                 INV RCL",  // 0x3A
+        "                   INV (",  // 0x3B
+        "                   GTO 8",  // 0x3C
+        "                   GTO 5",  // 0x3D
+        "                   GTO 2",  // 0x3E
+        "                  INV  .",  // 0x3F
+        "                      CE",  // 0x40
+        "                      vX",  // 0x41
+        "                     SUM",  // 0x42
+        "                       )",  // 0x43
+        "                   LBL 9",  // 0x44
+        "                   LBL 6",  // 0x45
+        "                   LBL 3",  // 0x46
+        "                     +/-",  // 0x47
+        "                  INV CE",  // 0x48
+        "                  INV vX",  // 0x49
+        "                 INV SUM",  // 0x4A
+        "                   INV )",  // 0x4B
+        "                   GTO 9",  // 0x4C
+        "                   GTO 6",  // 0x4D
+        "                   GTO 3",  // 0x4E
+        "                 INV +/-",  // 0x4F
+        "                     CLR",  // 0x50
+        "                     1/X",  // 0x51
+        "                     Y^X",  // 0x52
+        "                       /",  // 0x53
+        "                       x",  // 0x54
+        "                       -",  // 0x55
+        "                       +",  // 0x56
+        "                       =",  // 0x57
+        "                 INV CLR",  // 0x58
+        "                 INV 1/X",  // 0x59
+        "                 INV Y^X",  // 0x5A
+        "                   INV /",  // 0x5B
+        "                   INV x",  // 0x5C
+        "                   INV -",  // 0x5D
+        "                   INV +",  // 0x5E
+        "                   INV =",  // 0x5F
+        "                     2N2",  // 0x60
+        "                     DMS",  // 0x61
+        "                     PAU",  // 0x62
+        "                     NOP",  // 0x63
+        "                     DSZ",  // 0x64
+        "                     X=T",  // 0x65
+        "                     X>T",  // 0x66
+        "                     LBL",  // 0x67
+        "                 INV 2N2",  // 0x68
+        "                 INV DMS",  // 0x69
+        "                 INV PAU",  // 0x6A
+        "                 INV NOP",  // 0x6B
+        "                 INV DSZ",  // 0x6C
+        "                 INV X=T",  // 0x6D
+        "                 INV X>T",  // 0x6E
+        "                 INV LBL",  // 0x6F
+        "                     IN2",  // 0x70
+        "                     P-R",  // 0x71
+        "                     INS",  // 0x72
+        "                     DEL",  // 0x73
+        "                   SBR 7",  // 0x74
+        "                   SBR 4",  // 0x75
+        "                   SBR 1",  // 0x76
+        "                   SBR 0",  // 0x77
+        "                 INV IN2",  // 0x78
+        "                 INV P-R",  // 0x79
+        "                 INV INS",  // 0x7A
+        "                 INV DEL",  // 0x7B
+        "                   FIX 7",  // 0x7C
+        "                   FIX 4",  // 0x7D
+        "                   FIX 1",  // 0x7E
+        "                   FIX 0",  // 0x7F
+        "                     LOG",  // 0x80
+        "                     SIN",  // 0x81
+        "                     EXC",  // 0x82
+        "                     FIX",  // 0x83
+        "                   SBR 8",  // 0x84
+        "                   SBR 5",  // 0x85
+        "                   SBR 2",  // 0x86
+        "                      s+",  // 0x87
+        "                 INV LOG",  // 0x88
+        "                 INV SIN",  // 0x89
+        "                 INV EXC",  // 0x8A
+        "                 INV FIX",  // 0x8B
+        "                   FIX 8",  // 0x8C
+        "                   FIX 5",  // 0x8D
+        "                   FIX 2",  // 0x8E
+        "                  INV s+",  // 0x8F
+        "                      CT",  // 0x90
+        "                     COS",  // 0x91
+        "                     PRD",  // 0x92
+        "                     INT",  // 0x93
+        "                   SBR 9",  // 0x94
+        "                   SBR 6",  // 0x95
+        "                   SBR 3",  // 0x96
+        "                       @",  // 0x97
+        "                  INV CT",  // 0x98
+        "                 INV COS",  // 0x99
+        "                 INV PRD",  // 0x9A
+        "                 INV INT",  // 0x9B
+        "                   FIX 9",  // 0x9C
+        "                   FIX 6",  // 0x9D
+        "                   FIX 3",  // 0x9E
+        "                   INV @",  // 0x9F
+        "                     CL2",  // 0xA0
+        "                     TAN",  // 0xA1
+        "                      PI",  // 0xA2
+        "                     |X|",  // 0xA3
+        "                     DEG",  // 0xA4
+        "                     RAD",  // 0xA5
+        "                     GRD",  // 0xA6
+        "                     g^2",  // 0xA7
+        "                 INV CL2",  // 0xA8
+        "                 INV TAN",  // 0xA9
+        "                  INV PI",  // 0xAA
+        "                 INV |X|",  // 0xAB
+        "                 INV DEG",  // 0xAC
+        "                 INV RAD",  // 0xAD
+        "                 INV GRD",  // 0xAE
+        "                 INV g^2",  // 0xAF
+        "                   RCL 0",  // 0xB0
+        "                   RCL 1",  // 0xB1
+        "                   RCL 2",  // 0xB2
+        "                   RCL 3",  // 0xB3
+        "                   RCL 4",  // 0xB4
+        "                   RCL 5",  // 0xB5
+        "                   RCL 6",  // 0xB6
+        "                   RCL 7",  // 0xB7
+        "               INV RCL 0",  // 0xB8
+        "               INV RCL 1",  // 0xB9
+        "               INV RCL 2",  // 0xBA
+        "               INV RCL 3",  // 0xBB
+        "               INV RCL 4",  // 0xBC
+        "               INV RCL 5",  // 0xBD
+        "               INV RCL 6",  // 0xBE
+        "               INV RCL 7",  // 0xBF
+        "                   EXC 0",  // 0xC0
+        "                   EXC 1",  // 0xC1
+        "                   EXC 2",  // 0xC2
+        "                   EXC 3",  // 0xC3
+        "                   EXC 4",  // 0xC4
+        "                   EXC 5",  // 0xC5
+        "                   EXC 6",  // 0xC6
+        "                   EXC 7",  // 0xC7
+        "               INV EXC 0",  // 0xC8
+        "               INV EXC 1",  // 0xC9
+        "               INV EXC 2",  // 0xCA
+        "               INV EXC 3",  // 0xCB
+        "               INV EXC 4",  // 0xCC
+        "               INV EXC 5",  // 0xCD
+        "               INV EXC 6",  // 0xCE
+        "               INV EXC 7",  // 0xCF
+        "                   SUM 0",  // 0xD0
+        "                   SUM 1",  // 0xD1
+        "                   SUM 2",  // 0xD2
+        "                   SUM 3",  // 0xD3
+        "                   SUM 4",  // 0xD4
+        "                   SUM 5",  // 0xD5
+        "                   SUM 6",  // 0xD6
+        "                   SUM 7",  // 0xD7
+        "               INV SUM 0",  // 0xD8
+        "               INV SUM 1",  // 0xD9
+        "               INV SUM 2",  // 0xDA
+        "               INV SUM 3",  // 0xDB
+        "               INV SUM 4",  // 0xDC
+        "               INV SUM 5",  // 0xDD
+        "               INV SUM 6",  // 0xDE
+        "               INV SUM 7",  // 0xDF
+        "                   PRD 0",  // 0xE0
+        "                   PRD 1",  // 0xE1
+        "                   PRD 2",  // 0xE2
+        "                   PRD 3",  // 0xE3
+        "                   PRD 4",  // 0xE4
+        "                   PRD 5",  // 0xE5
+        "                   PRD 6",  // 0xE6
+        "                   PRD 7",  // 0xE7
+        "               INV PRD 0",  // 0xE8
+        "               INV PRD 1",  // 0xE9
+        "               INV PRD 2",  // 0xEA
+        "               INV PRD 3",  // 0xEB
+        "               INV PRD 4",  // 0xEC
+        "               INV PRD 5",  // 0xED
+        "               INV PRD 6",  // 0xEE
+        "               INV PRD 7",  // 0xEF
+        "                   STO 0",  // 0xF0
+        "                   STO 1",  // 0xF1
+        "                   STO 2",  // 0xF2
+        "                   STO 3",  // 0xF3
+        "                   STO 4",  // 0xF4
+        "                   STO 5",  // 0xF5
+        "                   STO 6",  // 0xF6
+        "                   STO 7",  // 0xF7
+        "               INV STO 0",  // 0xF8
+        "               INV STO 1",  // 0xF9
+        "               INV STO 2",  // 0xFA
+        "               INV STO 3",  // 0xFB
+        "               INV STO 4",  // 0xFC
+        "               INV STO 5",  // 0xFD
+        "               INV STO 6",  // 0xFE
+        "               INV STO 7",  // 0xFF
+    },
+    {
+        "                     0 _",  // 0x00
+        "                     1 _",  // 0x01
+        "                     2 _",  // 0x02
+        "                     3 _",  // 0x03
+        "                     4 _",  // 0x04
+        "                     5 _",  // 0x05
+        "                     6 _",  // 0x06
+        "                     7 _",  // 0x07
+        "                     8 _",  // 0x08
+        "                     9 _",  // 0x09
+        "                     A _",  // 0x0A
+        "                     B _",  // 0x0B
+        "                     C _",  // 0x0C
+        "                     D _",  // 0x0D
+        "                     E _",  // 0x0E
+        "                     F _",  // 0x0F
+        "                   2ND _",  // 0x10
+        "                   LRN _",  // 0x11
+        "                   SST _",  // 0x12
+        "                   BST _",  // 0x13
+        "                   GTO _",  // 0x14
+        "                   SBR _",  // 0x15
+        "                   RST _",  // 0x16
+        "                   R/S _",  // 0x17
+        "               INV 2ND _",  // 0x18
+        "               INV LRN _",  // 0x19
+        "               INV SST _",  // 0x1A
+        "               INV BST _",  // 0x1B
+        "               INV GTO _",  // 0x1C
+        "               INV SBR _",  // 0x1D
+        "               INV RST _",  // 0x1E
+        "               INV R/S _",  // 0x1F
+        "                   INV _",  // 0x20
+        "                   X/T _",  // 0x21
+        "                   STO _",  // 0x22
+        "                    EE _",  // 0x23
+        "                   LBL 7",  // 0x24
+        "                   LBL 4",  // 0x25
+        "                   LBL 1",  // 0x26
+        "                   LBL 0",  // 0x27
+        "               INV INV _",  // 0x28
+        "               INV X/T _",  // 0x29
+        "               INV STO _",  // 0x2A
+        "                INV EE _",  // 0x2B
+        "                   GTO 7",  // 0x2C
+        "                   GTO 4",  // 0x2D
+        "                   GTO 1",  // 0x2E
+        "                   GTO 0",  // 0x2F
+        "                   LNX _",  // 0x30
+        "                   X^2 _",  // 0x31
+        "                   RCL _",  // 0x32
+        "                     ( _",  // 0x33
+        "                   LBL 8",  // 0x34
+        "                   LBL 5",  // 0x35
+        "                   LBL 2",  // 0x36
+        "                     . _",  // 0x37
+        "               INV LNX _",  // 0x38
+        "               INV X^2 _",  // 0x39
+        "               INV RCL _",  // 0x3A
+        "                 INV ( _",  // 0x3B
+        "                   GTO 8",  // 0x3C
+        "                   GTO 5",  // 0x3D
+        "                   GTO 2",  // 0x3E
+        "                INV  . _",  // 0x3F
+        "                    CE _",  // 0x40
+        "                    vX _",  // 0x41
+        "                   SUM _",  // 0x42
+        "                     ) _",  // 0x43
+        "                   LBL 9",  // 0x44
+        "                   LBL 6",  // 0x45
+        "                   LBL 3",  // 0x46
+        "                   +/- _",  // 0x47
+        "                INV CE _",  // 0x48
+        "                INV vX _",  // 0x49
+        "               INV SUM _",  // 0x4A
+        "                 INV ) _",  // 0x4B
+        "                   GTO 9",  // 0x4C
+        "                   GTO 6",  // 0x4D
+        "                   GTO 3",  // 0x4E
+        "               INV +/- _",  // 0x4F
+        "                   CLR _",  // 0x50
+        "                   1/X _",  // 0x51
+        "                   Y^X _",  // 0x52
+        "                     / _",  // 0x53
+        "                     x _",  // 0x54
+        "                     - _",  // 0x55
+        "                     + _",  // 0x56
+        "                     = _",  // 0x57
+        "               INV CLR _",  // 0x58
+        "               INV 1/X _",  // 0x59
+        "               INV Y^X _",  // 0x5A
+        "                 INV / _",  // 0x5B
+        "                 INV x _",  // 0x5C
+        "                 INV - _",  // 0x5D
+        "                 INV + _",  // 0x5E
+        "                 INV = _",  // 0x5F
+        "                   2N2 _",  // 0x60
+        "                   DMS _",  // 0x61
+        "                   PAU _",  // 0x62
+        "                   NOP _",  // 0x63
+        "                   DSZ _",  // 0x64
+        "                   X=T _",  // 0x65
+        "                   X>T _",  // 0x66
+        "                   LBL _",  // 0x67
+        "               INV 2N2 _",  // 0x68
+        "               INV DMS _",  // 0x69
+        "               INV PAU _",  // 0x6A
+        "               INV NOP _",  // 0x6B
+        "               INV DSZ _",  // 0x6C
+        "               INV X=T _",  // 0x6D
+        "               INV X>T _",  // 0x6E
+        "               INV LBL _",  // 0x6F
+        "                   IN2 _",  // 0x70
+        "                   P-R _",  // 0x71
+        "                   INS _",  // 0x72
+        "                   DEL _",  // 0x73
+        "                   SBR 7",  // 0x74
+        "                   SBR 4",  // 0x75
+        "                   SBR 1",  // 0x76
+        "                   SBR 0",  // 0x77
+        "               INV IN2 _",  // 0x78
+        "               INV P-R _",  // 0x79
+        "               INV INS _",  // 0x7A
+        "               INV DEL _",  // 0x7B
+        "                   FIX 7",  // 0x7C
+        "                   FIX 4",  // 0x7D
+        "                   FIX 1",  // 0x7E
+        "                   FIX 0",  // 0x7F
+        "                   LOG _",  // 0x80
+        "                   SIN _",  // 0x81
+        "                   EXC _",  // 0x82
+        "                   FIX _",  // 0x83
+        "                   SBR 8",  // 0x84
+        "                   SBR 5",  // 0x85
+        "                   SBR 2",  // 0x86
+        "                    s+ _",  // 0x87
+        "               INV LOG _",  // 0x88
+        "               INV SIN _",  // 0x89
+        "               INV EXC _",  // 0x8A
+        "               INV FIX _",  // 0x8B
+        "                   FIX 8",  // 0x8C
+        "                   FIX 5",  // 0x8D
+        "                   FIX 2",  // 0x8E
+        "                INV s+ _",  // 0x8F
+        "                    CT _",  // 0x90
+        "                   COS _",  // 0x91
+        "                   PRD _",  // 0x92
+        "                   INT _",  // 0x93
+        "                   SBR 9",  // 0x94
+        "                   SBR 6",  // 0x95
+        "                   SBR 3",  // 0x96
+        "                     @ _",  // 0x97
+        "                INV CT _",  // 0x98
+        "               INV COS _",  // 0x99
+        "               INV PRD _",  // 0x9A
+        "               INV INT _",  // 0x9B
+        "                   FIX 9",  // 0x9C
+        "                   FIX 6",  // 0x9D
+        "                   FIX 3",  // 0x9E
+        "                 INV @ _",  // 0x9F
+        "                   CL2 _",  // 0xA0
+        "                   TAN _",  // 0xA1
+        "                    PI _",  // 0xA2
+        "                   |X| _",  // 0xA3
+        "                   DEG _",  // 0xA4
+        "                   RAD _",  // 0xA5
+        "                   GRD _",  // 0xA6
+        "                   g^2 _",  // 0xA7
+        "               INV CL2 _",  // 0xA8
+        "               INV TAN _",  // 0xA9
+        "                INV PI _",  // 0xAA
+        "               INV |X| _",  // 0xAB
+        "               INV DEG _",  // 0xAC
+        "               INV RAD _",  // 0xAD
+        "               INV GRD _",  // 0xAE
+        "               INV g^2 _",  // 0xAF
+        "                   RCL 0",  // 0xB0
+        "                   RCL 1",  // 0xB1
+        "                   RCL 2",  // 0xB2
+        "                   RCL 3",  // 0xB3
+        "                   RCL 4",  // 0xB4
+        "                   RCL 5",  // 0xB5
+        "                   RCL 6",  // 0xB6
+        "                   RCL 7",  // 0xB7
+        "               INV RCL 0",  // 0xB8
+        "               INV RCL 1",  // 0xB9
+        "               INV RCL 2",  // 0xBA
+        "               INV RCL 3",  // 0xBB
+        "               INV RCL 4",  // 0xBC
+        "               INV RCL 5",  // 0xBD
+        "               INV RCL 6",  // 0xBE
+        "               INV RCL 7",  // 0xBF
+        "                   EXC 0",  // 0xC0
+        "                   EXC 1",  // 0xC1
+        "                   EXC 2",  // 0xC2
+        "                   EXC 3",  // 0xC3
+        "                   EXC 4",  // 0xC4
+        "                   EXC 5",  // 0xC5
+        "                   EXC 6",  // 0xC6
+        "                   EXC 7",  // 0xC7
+        "               INV EXC 0",  // 0xC8
+        "               INV EXC 1",  // 0xC9
+        "               INV EXC 2",  // 0xCA
+        "               INV EXC 3",  // 0xCB
+        "               INV EXC 4",  // 0xCC
+        "               INV EXC 5",  // 0xCD
+        "               INV EXC 6",  // 0xCE
+        "               INV EXC 7",  // 0xCF
+        "                   SUM 0",  // 0xD0
+        "                   SUM 1",  // 0xD1
+        "                   SUM 2",  // 0xD2
+        "                   SUM 3",  // 0xD3
+        "                   SUM 4",  // 0xD4
+        "                   SUM 5",  // 0xD5
+        "                   SUM 6",  // 0xD6
+        "                   SUM 7",  // 0xD7
+        "               INV SUM 0",  // 0xD8
+        "               INV SUM 1",  // 0xD9
+        "               INV SUM 2",  // 0xDA
+        "               INV SUM 3",  // 0xDB
+        "               INV SUM 4",  // 0xDC
+        "               INV SUM 5",  // 0xDD
+        "               INV SUM 6",  // 0xDE
+        "               INV SUM 7",  // 0xDF
+        "                   PRD 0",  // 0xE0
+        "                   PRD 1",  // 0xE1
+        "                   PRD 2",  // 0xE2
+        "                   PRD 3",  // 0xE3
+        "                   PRD 4",  // 0xE4
+        "                   PRD 5",  // 0xE5
+        "                   PRD 6",  // 0xE6
+        "                   PRD 7",  // 0xE7
+        "               INV PRD 0",  // 0xE8
+        "               INV PRD 1",  // 0xE9
+        "               INV PRD 2",  // 0xEA
+        "               INV PRD 3",  // 0xEB
+        "               INV PRD 4",  // 0xEC
+        "               INV PRD 5",  // 0xED
+        "               INV PRD 6",  // 0xEE
+        "               INV PRD 7",  // 0xEF
+        "                   STO 0",  // 0xF0
+        "                   STO 1",  // 0xF1
+        "                   STO 2",  // 0xF2
+        "                   STO 3",  // 0xF3
+        "                   STO 4",  // 0xF4
+        "                   STO 5",  // 0xF5
+        "                   STO 6",  // 0xF6
+        "                   STO 7",  // 0xF7
+        "               INV STO 0",  // 0xF8
+        "               INV STO 1",  // 0xF9
+        "               INV STO 2",  // 0xFA
+        "               INV STO 3",  // 0xFB
+        "               INV STO 4",  // 0xFC
+        "               INV STO 5",  // 0xFD
+        "               INV STO 6",  // 0xFE
+        "               INV STO 7",  // 0xFF
+    },
+};
+
+const char *const OPS57_LRN_NUMERIC[2][256] = {
+    {
+        "                    00  ",  // 0x00
+        "                    01  ",  // 0x01
+        "                    02  ",  // 0x02
+        "                    03  ",  // 0x03
+        "                    04  ",  // 0x04
+        "                    05  ",  // 0x05
+        "                    06  ",  // 0x06
+        "                    07  ",  // 0x07
+        "                    08  ",  // 0x08
+        "                    09  ",  // 0x09
+        "                    00  ",  // 0x0A
+        "                    01  ",  // 0x0B
+        "                    02  ",  // 0x0C
+        "                    03  ",  // 0x0D
+        "                    04  ",  // 0x0E
+        "                    05  ",  // 0x0F
+        "                    11  ",  // 0x10
+        "                    21  ",  // 0x11
+        "                    31  ",  // 0x12
+        "                    41  ",  // 0x13
+        "                    51  ",  // 0x14
+        "                    61  ",  // 0x15
+        "                    71  ",  // 0x16
+        "                    81  ",  // 0x17
+        "                   -11  ",  // 0x18
+        "                   -21  ",  // 0x19
+        "                   -31  ",  // 0x1A
+        "                   -41  ",  // 0x1B
+        "                   -51  ",  // 0x1C
+        "                   -61  ",  // 0x1D
+        "                   -71  ",  // 0x1E
+        "                   -81  ",  // 0x1F
+        "                    12  ",  // 0x20
+        "                    22  ",  // 0x21
+        "                    32  ",  // 0x22
+        "                    42  ",  // 0x23
+        "                    86 7",  // 0x24
+        "                    86 4",  // 0x25
+        "                    86 1",  // 0x26
+        "                    86 0",  // 0x27
+        "                   -12  ",  // 0x28
+        "                   -22  ",  // 0x29
+        "                   -32  ",  // 0x2A
+        "                   -42  ",  // 0x2B
+        "                    51 7",  // 0x2C
+        "                    51 4",  // 0x2D
+        "                    51 1",  // 0x2E
+        "                    51 0",  // 0x2F
+        "                    13  ",  // 0x30
+        "                    23  ",  // 0x31
+        "                    33  ",  // 0x32
+        "                    43  ",  // 0x33
+        "                    86 8",  // 0x34
+        "                    86 5",  // 0x35
+        "                    86 2",  // 0x36
+        "                    83  ",  // 0x37
+        "                   -13  ",  // 0x38
+        "                   -23  ",  // 0x39
+        "                   -33  ",  // 0x3A
+        "                   -43  ",  // 0x3B
+        "                    51 8",  // 0x3C
+        "                    51 5",  // 0x3D
+        "                    51 2",  // 0x3E
+        "                   -83  ",  // 0x3F
+        "                    14  ",  // 0x40
+        "                    24  ",  // 0x41
+        "                    34  ",  // 0x42
+        "                    44  ",  // 0x43
+        "                    86 9",  // 0x44
+        "                    86 6",  // 0x45
+        "                    86 3",  // 0x46
+        "                    84  ",  // 0x47
+        "                   -14  ",  // 0x48
+        "                   -24  ",  // 0x49
+        "                   -34  ",  // 0x4A
+        "                   -44  ",  // 0x4B
+        "                    51 9",  // 0x4C
+        "                    51 6",  // 0x4D
+        "                    51 3",  // 0x4E
+        "                   -84  ",  // 0x4F
+        "                    15  ",  // 0x50
+        "                    25  ",  // 0x51
+        "                    35  ",  // 0x52
+        "                    45  ",  // 0x53
+        "                    55  ",  // 0x54
+        "                    65  ",  // 0x55
+        "                    75  ",  // 0x56
+        "                    85  ",  // 0x57
+        "                   -15  ",  // 0x58
+        "                   -25  ",  // 0x59
+        "                   -35  ",  // 0x5A
+        "                   -45  ",  // 0x5B
+        "                   -55  ",  // 0x5C
+        "                   -65  ",  // 0x5D
+        "                   -75  ",  // 0x5E
+        "                   -85  ",  // 0x5F
+        "                    16  ",  // 0x60
+        "                    26  ",  // 0x61
+        "                    36  ",  // 0x62
+        "                    46  ",  // 0x63
+        "                    56  ",  // 0x64
+        "                    66  ",  // 0x65
+        "                    76  ",  // 0x66
+        "                    86  ",  // 0x67
+        "                   -16  ",  // 0x68
+        "                   -26  ",  // 0x69
+        "                   -36  ",  // 0x6A
+        "                   -46  ",  // 0x6B
+        "                   -56  ",  // 0x6C
+        "                   -66  ",  // 0x6D
+        "                   -76  ",  // 0x6E
+        "                   -86  ",  // 0x6F
+        "                    17  ",  // 0x70
+        "                    27  ",  // 0x71
+        "                    37  ",  // 0x72
+        "                    47  ",  // 0x73
+        "                    61 7",  // 0x74
+        "                    61 4",  // 0x75
+        "                    61 1",  // 0x76
+        "                    61 0",  // 0x77
+        "                   -17  ",  // 0x78
+        "                   -27  ",  // 0x79
+        "                   -37  ",  // 0x7A
+        "                   -47  ",  // 0x7B
+        "                    48 7",  // 0x7C
+        "                    48 4",  // 0x7D
+        "                    48 1",  // 0x7E
+        "                    48 0",  // 0x7F
+        "                    18  ",  // 0x80
+        "                    28  ",  // 0x81
+        "                    38  ",  // 0x82
+        "                    48  ",  // 0x83
+        "                    61 8",  // 0x84
+        "                    61 5",  // 0x85
+        "                    61 2",  // 0x86
+        "                    88  ",  // 0x87
+        "                   -18  ",  // 0x88
+        "                   -28  ",  // 0x89
+        "                   -38  ",  // 0x8A
+        "                   -48  ",  // 0x8B
+        "                    48 8",  // 0x8C
+        "                    48 5",  // 0x8D
+        "                    48 2",  // 0x8E
+        "                   -88  ",  // 0x8F
+        "                    19  ",  // 0x90
+        "                    29  ",  // 0x91
+        "                    39  ",  // 0x92
+        "                    49  ",  // 0x93
+        "                    61 9",  // 0x94
+        "                    61 6",  // 0x95
+        "                    61 3",  // 0x96
+        "                    89  ",  // 0x97
+        "                   -19  ",  // 0x98
+        "                   -29  ",  // 0x99
+        "                   -39  ",  // 0x9A
+        "                   -49  ",  // 0x9B
+        "                    48 9",  // 0x9C
+        "                    48 6",  // 0x9D
+        "                    48 3",  // 0x9E
+        "                   -89  ",  // 0x9F
+        "                    10  ",  // 0xA0
+        "                    20  ",  // 0xA1
+        "                    30  ",  // 0xA2
+        "                    40  ",  // 0xA3
+        "                    50  ",  // 0xA4
+        "                    60  ",  // 0xA5
+        "                    70  ",  // 0xA6
+        "                    80  ",  // 0xA7
+        "                   -10  ",  // 0xA8
+        "                   -20  ",  // 0xA9
+        "                   -30  ",  // 0xAA
+        "                   -40  ",  // 0xAB
+        "                   -50  ",  // 0xAC
+        "                   -60  ",  // 0xAD
+        "                   -70  ",  // 0xAE
+        "                   -80  ",  // 0xAF
+        "                    33 0",  // 0xB0
+        "                    33 1",  // 0xB1
+        "                    33 2",  // 0xB2
+        "                    33 3",  // 0xB3
+        "                    33 4",  // 0xB4
+        "                    33 5",  // 0xB5
+        "                    33 6",  // 0xB6
+        "                    33 7",  // 0xB7
+        "                   -33 0",  // 0xB8
+        "                   -33 1",  // 0xB9
+        "                   -33 2",  // 0xBA
+        "                   -33 3",  // 0xBB
+        "                   -33 4",  // 0xBC
+        "                   -33 5",  // 0xBD
+        "                   -33 6",  // 0xBE
+        "                   -33 7",  // 0xBF
+        "                    38 0",  // 0xC0
+        "                    38 1",  // 0xC1
+        "                    38 2",  // 0xC2
+        "                    38 3",  // 0xC3
+        "                    38 4",  // 0xC4
+        "                    38 5",  // 0xC5
+        "                    38 6",  // 0xC6
+        "                    38 7",  // 0xC7
+        "                   -38 0",  // 0xC8
+        "                   -38 1",  // 0xC9
+        "                   -38 2",  // 0xCA
+        "                   -38 3",  // 0xCB
+        "                   -38 4",  // 0xCC
+        "                   -38 5",  // 0xCD
+        "                   -38 6",  // 0xCE
+        "                   -38 7",  // 0xCF
+        "                    34 0",  // 0xD0
+        "                    34 1",  // 0xD1
+        "                    34 2",  // 0xD2
+        "                    34 3",  // 0xD3
+        "                    34 4",  // 0xD4
+        "                    34 5",  // 0xD5
+        "                    34 6",  // 0xD6
+        "                    34 7",  // 0xD7
+        "                   -34 0",  // 0xD8
+        "                   -34 1",  // 0xD9
+        "                   -34 2",  // 0xDA
+        "                   -34 3",  // 0xDB
+        "                   -34 4",  // 0xDC
+        "                   -34 5",  // 0xDD
+        "                   -34 6",  // 0xDE
+        "                   -34 7",  // 0xDF
+        "                    39 0",  // 0xE0
+        "                    39 1",  // 0xE1
+        "                    39 2",  // 0xE2
+        "                    39 3",  // 0xE3
+        "                    39 4",  // 0xE4
+        "                    39 5",  // 0xE5
+        "                    39 6",  // 0xE6
+        "                    39 7",  // 0xE7
+        "                   -39 0",  // 0xE8
+        "                   -39 1",  // 0xE9
+        "                   -39 2",  // 0xEA
+        "                   -39 3",  // 0xEB
+        "                   -39 4",  // 0xEC
+        "                   -39 5",  // 0xED
+        "                   -39 6",  // 0xEE
+        "                   -39 7",  // 0xEF
+        "                    32 0",  // 0xF0
+        "                    32 1",  // 0xF1
+        "                    32 2",  // 0xF2
+        "                    32 3",  // 0xF3
+        "                    32 4",  // 0xF4
+        "                    32 5",  // 0xF5
+        "                    32 6",  // 0xF6
+        "                    32 7",  // 0xF7
+        "                   -32 0",  // 0xF8
+        "                   -32 1",  // 0xF9
+        "                   -32 2",  // 0xFA
+        "                   -32 3",  // 0xFB
+        "                   -32 4",  // 0xFC
+        "                   -32 5",  // 0xFD
+        "                   -32 6",  // 0xFE
+        "                   -32 7",  // 0xFF
+    },
+    {
+        "                    00 0",  // 0x00
+        "                    01 0",  // 0x01
+        "                    02 0",  // 0x02
+        "                    03 0",  // 0x03
+        "                    04 0",  // 0x04
+        "                    05 0",  // 0x05
+        "                    06 0",  // 0x06
+        "                    07 0",  // 0x07
+        "                    08 0",  // 0x08
+        "                    09 0",  // 0x09
+        "                    00 0",  // 0x0A
+        "                    01 0",  // 0x0B
+        "                    02 0",  // 0x0C
+        "                    03 0",  // 0x0D
+        "                    04 0",  // 0x0E
+        "                    05 0",  // 0x0F
+        "                    11 0",  // 0x10
+        "                    21 0",  // 0x11
+        "                    31 0",  // 0x12
+        "                    41 0",  // 0x13
+        "                    51 0",  // 0x14
+        "                    61 0",  // 0x15
+        "                    71 0",  // 0x16
+        "                    81 0",  // 0x17
+        "                   -11 0",  // 0x18
+        "                   -21 0",  // 0x19
+        "                   -31 0",  // 0x1A
+        "                   -41 0",  // 0x1B
+        "                   -51 0",  // 0x1C
+        "                   -61 0",  // 0x1D
+        "                   -71 0",  // 0x1E
+        "                   -81 0",  // 0x1F
+        "                    12 0",  // 0x20
+        "                    22 0",  // 0x21
+        "                    32 0",  // 0x22
+        "                    42 0",  // 0x23
+        "                    86 7",  // 0x24
+        "                    86 4",  // 0x25
+        "                    86 1",  // 0x26
+        "                    86 0",  // 0x27
+        "                   -12 0",  // 0x28
+        "                   -22 0",  // 0x29
+        "                   -32 0",  // 0x2A
+        "                   -42 0",  // 0x2B
+        "                    51 7",  // 0x2C
+        "                    51 4",  // 0x2D
+        "                    51 1",  // 0x2E
+        "                    51 0",  // 0x2F
+        "                    13 0",  // 0x30
+        "                    23 0",  // 0x31
+        "                    33 0",  // 0x32
+        "                    43 0",  // 0x33
+        "                    86 8",  // 0x34
+        "                    86 5",  // 0x35
+        "                    86 2",  // 0x36
+        "                    83 0",  // 0x37
+        "                   -13 0",  // 0x38
+        "                   -23 0",  // 0x39
+        "                   -33 0",  // 0x3A
+        "                   -43 0",  // 0x3B
+        "                    51 8",  // 0x3C
+        "                    51 5",  // 0x3D
+        "                    51 2",  // 0x3E
+        "                   -83 0",  // 0x3F
+        "                    14 0",  // 0x40
+        "                    24 0",  // 0x41
+        "                    34 0",  // 0x42
+        "                    44 0",  // 0x43
+        "                    86 9",  // 0x44
+        "                    86 6",  // 0x45
+        "                    86 3",  // 0x46
+        "                    84 0",  // 0x47
+        "                   -14 0",  // 0x48
+        "                   -24 0",  // 0x49
+        "                   -34 0",  // 0x4A
+        "                   -44 0",  // 0x4B
+        "                    51 9",  // 0x4C
+        "                    51 6",  // 0x4D
+        "                    51 3",  // 0x4E
+        "                   -84 0",  // 0x4F
+        "                    15 0",  // 0x50
+        "                    25 0",  // 0x51
+        "                    35 0",  // 0x52
+        "                    45 0",  // 0x53
+        "                    55 0",  // 0x54
+        "                    65 0",  // 0x55
+        "                    75 0",  // 0x56
+        "                    85 0",  // 0x57
+        "                   -15 0",  // 0x58
+        "                   -25 0",  // 0x59
+        "                   -35 0",  // 0x5A
+        "                   -45 0",  // 0x5B
+        "                   -55 0",  // 0x5C
+        "                   -65 0",  // 0x5D
+        "                   -75 0",  // 0x5E
+        "                   -85 0",  // 0x5F
+        "                    16 0",  // 0x60
+        "                    26 0",  // 0x61
+        "                    36 0",  // 0x62
+        "                    46 0",  // 0x63
+        "                    56 0",  // 0x64
+        "                    66 0",  // 0x65
+        "                    76 0",  // 0x66
+        "                    86 0",  // 0x67
+        "                   -16 0",  // 0x68
+        "                   -26 0",  // 0x69
+        "                   -36 0",  // 0x6A
+        "                   -46 0",  // 0x6B
+        "                   -56 0",  // 0x6C
+        "                   -66 0",  // 0x6D
+        "                   -76 0",  // 0x6E
+        "                   -86 0",  // 0x6F
+        "                    17 0",  // 0x70
+        "                    27 0",  // 0x71
+        "                    37 0",  // 0x72
+        "                    47 0",  // 0x73
+        "                    61 7",  // 0x74
+        "                    61 4",  // 0x75
+        "                    61 1",  // 0x76
+        "                    61 0",  // 0x77
+        "                   -17 0",  // 0x78
+        "                   -27 0",  // 0x79
+        "                   -37 0",  // 0x7A
+        "                   -47 0",  // 0x7B
+        "                    48 7",  // 0x7C
+        "                    48 4",  // 0x7D
+        "                    48 1",  // 0x7E
+        "                    48 0",  // 0x7F
+        "                    18 0",  // 0x80
+        "                    28 0",  // 0x81
+        "                    38 0",  // 0x82
+        "                    48 0",  // 0x83
+        "                    61 8",  // 0x84
+        "                    61 5",  // 0x85
+        "                    61 2",  // 0x86
+        "                    88 0",  // 0x87
+        "                   -18 0",  // 0x88
+        "                   -28 0",  // 0x89
+        "                   -38 0",  // 0x8A
+        "                   -48 0",  // 0x8B
+        "                    48 8",  // 0x8C
+        "                    48 5",  // 0x8D
+        "                    48 2",  // 0x8E
+        "                   -88 0",  // 0x8F
+        "                    19 0",  // 0x90
+        "                    29 0",  // 0x91
+        "                    39 0",  // 0x92
+        "                    49 0",  // 0x93
+        "                    61 9",  // 0x94
+        "                    61 6",  // 0x95
+        "                    61 3",  // 0x96
+        "                    89 0",  // 0x97
+        "                   -19 0",  // 0x98
+        "                   -29 0",  // 0x99
+        "                   -39 0",  // 0x9A
+        "                   -49 0",  // 0x9B
+        "                    48 9",  // 0x9C
+        "                    48 6",  // 0x9D
+        "                    48 3",  // 0x9E
+        "                   -89 0",  // 0x9F
+        "                    10 0",  // 0xA0
+        "                    20 0",  // 0xA1
+        "                    30 0",  // 0xA2
+        "                    40 0",  // 0xA3
+        "                    50 0",  // 0xA4
+        "                    60 0",  // 0xA5
+        "                    70 0",  // 0xA6
+        "                    80 0",  // 0xA7
+        "                   -10 0",  // 0xA8
+        "                   -20 0",  // 0xA9
+        "                   -30 0",  // 0xAA
+        "                   -40 0",  // 0xAB
+        "                   -50 0",  // 0xAC
+        "                   -60 0",  // 0xAD
+        "                   -70 0",  // 0xAE
+        "                   -80 0",  // 0xAF
+        "                    33 0",  // 0xB0
+        "                    33 1",  // 0xB1
+        "                    33 2",  // 0xB2
+        "                    33 3",  // 0xB3
+        "                    33 4",  // 0xB4
+        "                    33 5",  // 0xB5
+        "                    33 6",  // 0xB6
+        "                    33 7",  // 0xB7
+        "                   -33 0",  // 0xB8
+        "                   -33 1",  // 0xB9
+        "                   -33 2",  // 0xBA
+        "                   -33 3",  // 0xBB
+        "                   -33 4",  // 0xBC
+        "                   -33 5",  // 0xBD
+        "                   -33 6",  // 0xBE
+        "                   -33 7",  // 0xBF
+        "                    38 0",  // 0xC0
+        "                    38 1",  // 0xC1
+        "                    38 2",  // 0xC2
+        "                    38 3",  // 0xC3
+        "                    38 4",  // 0xC4
+        "                    38 5",  // 0xC5
+        "                    38 6",  // 0xC6
+        "                    38 7",  // 0xC7
+        "                   -38 0",  // 0xC8
+        "                   -38 1",  // 0xC9
+        "                   -38 2",  // 0xCA
+        "                   -38 3",  // 0xCB
+        "                   -38 4",  // 0xCC
+        "                   -38 5",  // 0xCD
+        "                   -38 6",  // 0xCE
+        "                   -38 7",  // 0xCF
+        "                    34 0",  // 0xD0
+        "                    34 1",  // 0xD1
+        "                    34 2",  // 0xD2
+        "                    34 3",  // 0xD3
+        "                    34 4",  // 0xD4
+        "                    34 5",  // 0xD5
+        "                    34 6",  // 0xD6
+        "                    34 7",  // 0xD7
+        "                   -34 0",  // 0xD8
+        "                   -34 1",  // 0xD9
+        "                   -34 2",  // 0xDA
+        "                   -34 3",  // 0xDB
+        "                   -34 4",  // 0xDC
+        "                   -34 5",  // 0xDD
+        "                   -34 6",  // 0xDE
+        "                   -34 7",  // 0xDF
+        "                    39 0",  // 0xE0
+        "                    39 1",  // 0xE1
+        "                    39 2",  // 0xE2
+        "                    39 3",  // 0xE3
+        "                    39 4",  // 0xE4
+        "                    39 5",  // 0xE5
+        "                    39 6",  // 0xE6
+        "                    39 7",  // 0xE7
+        "                   -39 0",  // 0xE8
+        "                   -39 1",  // 0xE9
+        "                   -39 2",  // 0xEA
+        "                   -39 3",  // 0xEB
+        "                   -39 4",  // 0xEC
+        "                   -39 5",  // 0xED
+        "                   -39 6",  // 0xEE
+        "                   -39 7",  // 0xEF
+        "                    32 0",  // 0xF0
+        "                    32 1",  // 0xF1
+        "                    32 2",  // 0xF2
+        "                    32 3",  // 0xF3
+        "                    32 4",  // 0xF4
+        "                    32 5",  // 0xF5
+        "                    32 6",  // 0xF6
+        "                    32 7",  // 0xF7
+        "                   -32 0",  // 0xF8
+        "                   -32 1",  // 0xF9
+        "                   -32 2",  // 0xFA
+        "                   -32 3",  // 0xFB
+        "                   -32 4",  // 0xFC
+        "                   -32 5",  // 0xFD
+        "                   -32 6",  // 0xFE
+        "                   -32 7",  // 0xFF
+    },
+};
+
+const unsigned char OPS57_LRN_DOT_COUNT[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const short OPS57_OPCODES[2][OPS57_MAX_KEY][11] = {
+    {
+        {   0,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x00
+        {   1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x01
+        {   2,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x02
+        {   3,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x03
+        {   4,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x04
+        {   5,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x05
+        {   6,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x06
+        {   7,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x07
+        {   8,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x08
+        {   9,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x09
+        {  10,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0A
+        {  11,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0B
+        {  12,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0C
+        {  13,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0D
+        {  14,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0E
+        {  15,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x10
+        {  16,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x11
+        {  32,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x12
+        {  48,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x13
+        {  64,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x14
+        {  80,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x15
+        {  96,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x16
+        { 112,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x17
+        { 128,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x18
+        { 144,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x19
+        { 160,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x20
+        {  17,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x21
+        {  33,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x22
+        {  49,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x23
+        {  65,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x24
+        {  81,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x25
+        {  97,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x26
+        { 113,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x27
+        { 129,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x28
+        { 145,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x29
+        { 161,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x30
+        {  18,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x31
+        {  34, 240, 241, 242, 243, 244, 245, 246, 247,  -1,  -1},  // 0x32
+        {  50, 176, 177, 178, 179, 180, 181, 182, 183,  -1,  -1},  // 0x33
+        {  66, 208, 209, 210, 211, 212, 213, 214, 215,  -1,  -1},  // 0x34
+        {  82,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x35
+        {  98,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x36
+        { 114,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x37
+        { 130, 192, 193, 194, 195, 196, 197, 198, 199,  -1,  -1},  // 0x38
+        { 146, 224, 225, 226, 227, 228, 229, 230, 231,  -1,  -1},  // 0x39
+        { 162,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x40
+        {  19,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x41
+        {  35,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x42
+        {  51,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x43
+        {  67,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x44
+        {  83,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x45
+        {  99,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x46
+        { 115,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x47
+        { 131, 127, 126, 142, 158, 125, 141, 157, 124, 140, 156},  // 0x48
+        { 147,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x49
+        { 163,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x50
+        {  20,  47,  46,  62,  78,  45,  61,  77,  44,  60,  76},  // 0x51
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x52
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x53
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x54
+        {  84,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x55
+        { 100,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x56
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x57
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x58
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x59
+        { 164,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x60
+        {  21, 119, 118, 134, 150, 117, 133, 149, 116, 132, 148},  // 0x61
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x62
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x63
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x64
+        {  85,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x65
+        { 101,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x66
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x67
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x68
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x69
+        { 165,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x70
+        {  22,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x71
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x72
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x73
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x74
+        {  86,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x75
+        { 102,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x76
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x77
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x78
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x79
+        { 166,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x80
+        {  23,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x81
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x82
+        {  55,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x83
+        {  71,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x84
+        {  87,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x85
+        { 103,  39,  38,  54,  70,  37,  53,  69,  36,  52,  68},  // 0x86
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x87
+        { 135,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x88
+        { 151,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x89
+        { 167,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8F
+    },
+    {
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x00
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x01
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x02
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x03
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x04
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x05
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x06
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x07
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x08
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x09
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x0F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x10
+        {  24,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x11
+        {  40,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x12
+        {  56,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x13
+        {  72,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x14
+        {  88,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x15
+        { 104,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x16
+        { 120,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x17
+        { 136,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x18
+        { 152,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x19
+        { 168,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x1F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x20
+        {  25,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x21
+        {  41,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x22
+        {  57,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x23
+        {  73,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x24
+        {  89,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x25
+        { 105,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x26
+        { 121,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x27
+        { 137,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x28
+        { 153,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x29
+        { 169,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x2F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x30
+        {  26,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x31
+        {  42, 248, 249, 250, 251, 252, 253, 254, 255,  -1,  -1},  // 0x32
+        {  58, 184, 185, 186, 187, 188, 189, 190, 191,  -1,  -1},  // 0x33
+        {  74, 216, 217, 218, 219, 220, 221, 222, 223,  -1,  -1},  // 0x34
+        {  90,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x35
+        { 106,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x36
+        { 122,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x37
+        { 138, 200, 201, 202, 203, 204, 205, 206, 207,  -1,  -1},  // 0x38
+        { 154, 232, 233, 234, 235, 236, 237, 238, 239,  -1,  -1},  // 0x39
+        { 170,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x3F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x40
+        {  27,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x41
+        {  43,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x42
+        {  59,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x43
+        {  75,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x44
+        {  91,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x45
+        { 107,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x46
+        { 123,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x47
+        { 139,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x48
+        { 155,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x49
+        { 171,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x4F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x50
+        {  28,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x51
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x52
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x53
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x54
+        {  92,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x55
+        { 108,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x56
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x57
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x58
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x59
+        { 172,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x5F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x60
+        {  29,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x61
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x62
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x63
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x64
+        {  93,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x65
+        { 109,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x66
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x67
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x68
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x69
+        { 173,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x6F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x70
+        {  30,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x71
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x72
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x73
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x74
+        {  94,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x75
+        { 110,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x76
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x77
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x78
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x79
+        { 174,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x7F
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x80
+        {  31,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x81
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x82
+        {  63,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x83
+        {  79,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x84
+        {  95,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x85
+        { 111,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x86
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x87
+        { 143,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x88
+        { 159,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x89
+        { 175,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8A
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8B
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8C
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8D
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8E
+        {  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1},  // 0x8F
+    },
+};
+
+#endif  /* PLATFORM57_STRINGS */
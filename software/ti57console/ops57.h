@@ -0,0 +1,50 @@
+/**
+ * Precomputed tables of the 256 program operations, indexed by opcode.
+ *
+ * The opcode is the byte stored in a program step (see ti57_get_program_opcode).
+ * The tables are in ops57.c, which is generated by opsgen57.c.
+ */
+
+#ifndef ops57_h
+#define ops57_h
+
+#include <stdbool.h>
+
+#include "platform57.h"
+#include "key57.h"
+#include "op57.h"
+
+/** Largest key code that is part of an operation, plus one. */
+#define OPS57_MAX_KEY 0x90
+
+/** The operation of each opcode. */
+extern const op57_t OPS57[256];
+
+#if PLATFORM57_STRINGS
+/** ASCII and Unicode mnemonics, such as "INV STO 2". */
+extern const char *const OPS57_ASCII[256];
+extern const char *const OPS57_UNICODE[256];
+
+/** Same with the parameter pending, such as "INV STO _", for operations with a parameter. */
+extern const char *const OPS57_ASCII_PENDING[256];
+extern const char *const OPS57_UNICODE_PENDING[256];
+
+/**
+ * The LRN display of each opcode, without the step number, indexed by [pending][opcode].
+ *
+ * Strings are 24 characters long. See lrn57_get_display for where the step number goes.
+ */
+extern const char *const OPS57_LRN_ALPHA[2][256];
+extern const char *const OPS57_LRN_NUMERIC[2][256];
+
+/** The number of dots in the alphanumeric LRN display of each opcode. */
+extern const unsigned char OPS57_LRN_DOT_COUNT[256];
+
+/**
+ * The opcode of each operation, indexed by [inv][key][d + 1], -1 if the operation is not
+ * programmable.
+ */
+extern const short OPS57_OPCODES[2][OPS57_MAX_KEY][11];
+#endif
+
+#endif /* ops57_h */
@@ -0,0 +1,236 @@
+/**
+ * Generates ops57.c, the precomputed tables of the 256 program operations.
+ *
+ * Everything that is derived from an opcode (the operation, its mnemonics and
+ * its rendering in LRN mode) is computed here once, so that logging and LRN
+ * display are simple table lookups.
+ *
+ * Usage:
+ *   opsgen57 > ops57.c
+ *
+ * Build with key57.c only. Regenerate ops57.c whenever the decoding below, the
+ * key names in key57.c or the LRN display format change.
+ *
+ * All the tables but OPS57 are only compiled with PLATFORM57_STRINGS, so that
+ * the firmware only carries the operations.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "key57.h"
+#include "op57.h"
+
+/** Largest key code that is part of an operation, plus one. */
+#define MAX_KEY 0x90
+
+static op57_t ops[256];
+
+/** Decodes the 256 opcodes, as stored in the program steps. */
+static void decode_ops(void)
+{
+    for (int i = 0; i <= 0xff; i++) {
+        op57_t *op = &ops[i];
+        if (i < 0x10) {
+            // Digits.
+            op->inv = false;
+            op->key = i;
+            op->d = -1;
+        } else if (i < 0xb0) {
+            // Ops with no parameters.
+            op->inv = (i & 0x08) != 0;
+            op->key = (((i & 0x07) + 1) << 4) | (i & 0xf0) >> 4;
+            op->d = -1;
+        } else {
+            // Register ops: RCL, PRD, SUM, EXC and STO.
+            static key57_t keys[] = {0x33, 0x38, 0x34, 0x39, 0x32};
+            op->inv = (i & 0x08) != 0;
+            op->key = keys[(i >> 4) - 0xb];
+            op->d = i & 0x07;
+        }
+    }
+
+    // LBL, GTO, SBR and FIX.
+    static int start_indices[] = {0x27, 0x2f, 0x77, 0x7f};
+    static key57_t keys[] = {0x86, 0x51, 0x61, 0x48};
+    static int offsets[] = {0, -1, 15, 31, -2, 14, 30, -3, 13, 29};
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 10; j++) {
+            op57_t *op = &ops[start_indices[i] + offsets[j]];
+            op->inv = false;
+            op->key = keys[i];
+            op->d = j;
+        }
+    }
+}
+
+/** Formats a mnemonic such as "INV STO 2" or, if pending, "INV STO _". */
+static void format_mnemonic(op57_t *op, bool unicode, bool is_pending, char *str)
+{
+    char *name = unicode ? key57_get_unicode_name(op->key) : key57_get_ascii_name(op->key);
+
+    if (is_pending) {
+        sprintf(str, "%s%s _", op->inv ? "INV " : "", name);
+    } else if (op->d >= 0) {
+        sprintf(str, "%s%s %d", op->inv ? "INV " : "", name, op->d);
+    } else {
+        sprintf(str, "%s%s", op->inv ? "INV " : "", name);
+    }
+}
+
+/**
+ * Formats the LRN display of an operation, without the step number.
+ *
+ * 'str' holds 24 characters. The step number goes at 12 - dot count (and 4
+ * characters further in numeric mode), see lrn57_get_display.
+ */
+static int format_lrn(op57_t *op, bool is_alphanumeric_mode, bool op_pending, char *str)
+{
+    int dot_count = 0;
+
+    memset(str, ' ', 24);
+    str[24] = 0;
+
+    // Set operation.
+    int i = 23;
+    if (op->d >= 0) {
+        str[i] = '0' + op->d;
+        i -= 2;
+    } else if (op_pending) {
+        str[i] = is_alphanumeric_mode ? '_' : '0';
+        i -= 2;
+    } else if (!is_alphanumeric_mode) {
+        i -= 2;
+    }
+    if (is_alphanumeric_mode) {
+        char *name = key57_get_ascii_name(op->key);
+        for (int j = (int)strlen(name) - 1; j >= 0; j--) {
+            str[i--] = name[j];
+            if (str[i + 1] == '.') {
+                str[i--] = ' ';
+                dot_count += 1;
+            }
+        }
+    } else {
+        str[i--] = '0' + op->key % 16 % 10;
+        str[i--] = '0' + op->key / 16;
+    }
+    if (op->inv) {
+        if (is_alphanumeric_mode) {
+            memcpy(str + i - 3, "INV", 3);
+        } else {
+            str[i] = '-';
+        }
+    }
+    return dot_count;
+}
+
+/**
+ * OUTPUT
+ */
+
+/** Prints a C string literal, escaping non ASCII characters in octal. */
+static void print_literal(const char *str)
+{
+    putchar('"');
+    for (const unsigned char *c = (const unsigned char *)str; *c; c++) {
+        if (*c < 0x20 || *c >= 0x7f) {
+            printf("\\%03o", *c);
+        } else if (*c == '"' || *c == '\\') {
+            printf("\\%c", *c);
+        } else {
+            putchar(*c);
+        }
+    }
+    putchar('"');
+}
+
+static void print_mnemonics(const char *name, bool unicode, bool is_pending)
+{
+    char str[32];
+
+    printf("\nconst char *const %s[256] = {\n", name);
+    for (int i = 0; i <= 0xff; i++) {
+        format_mnemonic(&ops[i], unicode, is_pending && ops[i].d >= 0, str);
+        printf("    ");
+        print_literal(str);
+        printf(",  // 0x%02X\n", i);
+    }
+    printf("};\n");
+}
+
+static void print_lrn(const char *name, bool is_alphanumeric_mode)
+{
+    char str[25];
+
+    printf("\nconst char *const %s[2][256] = {\n", name);
+    for (int pending = 0; pending <= 1; pending++) {
+        printf("    {\n");
+        for (int i = 0; i <= 0xff; i++) {
+            format_lrn(&ops[i], is_alphanumeric_mode, pending, str);
+            printf("        ");
+            print_literal(str);
+            printf(",  // 0x%02X\n", i);
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+}
+
+int main(void)
+{
+    static short opcodes[2][MAX_KEY][11];
+    char str[25];
+
+    decode_ops();
+    memset(opcodes, 0xff, sizeof(opcodes));
+    for (int i = 0; i <= 0xff; i++) {
+        opcodes[ops[i].inv][ops[i].key][ops[i].d + 1] = i;
+    }
+
+    printf("/**\n"
+           " * Precomputed tables of the 256 program operations.\n"
+           " *\n"
+           " * Generated by opsgen57.c. Do not edit.\n"
+           " */\n"
+           "\n"
+           "#include \"ops57.h\"\n");
+
+    printf("\nconst op57_t OPS57[256] = {\n");
+    for (int i = 0; i <= 0xff; i++) {
+        printf("    {%s, 0x%02X, %2d},  // 0x%02X\n",
+               ops[i].inv ? "true" : "false", ops[i].key, ops[i].d, i);
+    }
+    printf("};\n");
+
+    printf("\n#if PLATFORM57_STRINGS\n");
+    print_mnemonics("OPS57_ASCII", false, false);
+    print_mnemonics("OPS57_UNICODE", true, false);
+    print_mnemonics("OPS57_ASCII_PENDING", false, true);
+    print_mnemonics("OPS57_UNICODE_PENDING", true, true);
+    print_lrn("OPS57_LRN_ALPHA", true);
+    print_lrn("OPS57_LRN_NUMERIC", false);
+
+    printf("\nconst unsigned char OPS57_LRN_DOT_COUNT[256] = {\n");
+    for (int i = 0; i <= 0xff; i++) {
+        printf("%s%d,%s", i % 16 ? " " : "    ",
+               format_lrn(&ops[i], true, false, str), i % 16 == 15 ? "\n" : "");
+    }
+    printf("};\n");
+
+    printf("\nconst short OPS57_OPCODES[2][OPS57_MAX_KEY][11] = {\n");
+    for (int inv = 0; inv <= 1; inv++) {
+        printf("    {\n");
+        for (int key = 0; key < MAX_KEY; key++) {
+            printf("        {");
+            for (int d = 0; d <= 10; d++) {
+                printf("%s%4d", d ? "," : "", opcodes[inv][key][d]);
+            }
+            printf("},  // 0x%02X\n", key);
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+    printf("\n#endif  /* PLATFORM57_STRINGS */\n");
+    return 0;
+}
@@ -0,0 +1,64 @@
+/**
+ * Compile-time profile of the platform the engine is built for.
+ *
+ * The engine (ti57.c, state57.c, utils57.c, key57.c, rcl57.c, the ROMs and
+ * ops57.c) is shared by this console and the RCL-57 firmware in ../ti57mcu. The
+ * firmware and its simulator define PLATFORM57_MCU, which compiles out what
+ * only a host can afford. Each feature can also be set on its own on the
+ * command line, for example -DPLATFORM57_TRACE=0.
+ */
+
+#ifndef platform57_h
+#define platform57_h
+
+#ifdef PLATFORM57_MCU
+    #include "rcl57mcu.h"  // TI55_ROM or TI57_ROM
+    #define PLATFORM57_HOST 0
+#else
+    #define PLATFORM57_HOST 1
+#endif
+
+/** Argument checks with assert(). */
+#ifndef PLATFORM57_ASSERTS
+    #define PLATFORM57_ASSERTS PLATFORM57_HOST
+#endif
+
+/** The log of operations and results (log57.h), attached with ti57_set_log. */
+#ifndef PLATFORM57_LOG
+    #define PLATFORM57_LOG PLATFORM57_HOST
+#endif
+
+/** printf() trace of every opcode and display cycle, muted while in_register_dump is set. */
+#ifndef PLATFORM57_TRACE
+    #define PLATFORM57_TRACE PLATFORM57_HOST
+#endif
+
+/**
+ * String conversions of the display, registers, AOS stack and key names, and the
+ * tables of ops57.h other than OPS57 (mnemonics, LRN display, opcode lookup).
+ */
+#ifndef PLATFORM57_STRINGS
+    #define PLATFORM57_STRINGS PLATFORM57_HOST
+#endif
+
+#if PLATFORM57_TRACE && !PLATFORM57_STRINGS
+    #error "PLATFORM57_TRACE needs PLATFORM57_STRINGS"
+#endif
+
+#if PLATFORM57_ASSERTS
+    #include <assert.h>
+    #define ASSERT57(x) assert(x)
+#else
+    #define ASSERT57(x) ((void)0)
+#endif
+
+/** The ROM run by ti57_next: the TI-55 one if TI55_ROM is defined, the TI-57 one otherwise. */
+#ifdef TI55_ROM
+    #include "rom55.h"
+    #define PLATFORM57_ROM ROM55
+#else
+    #include "rom57.h"
+    #define PLATFORM57_ROM ROM57
+#endif
+
+#endif  /* !platform57_h */
@@ -1,10 +1,10 @@
-#include <assert.h>
-#include <stdio.h>
 #include <string.h>
 
-#include "lrn57.h"
 #include "rcl57.h"
 #include "utils57.h"
+#if PLATFORM57_STRINGS
+#include "lrn57.h"
+#endif
 
 static bool is_post_pause(ti57_t *ti57) {
     long diff = ti57->current_cycle - ti57->last_pause_cycle;
@@ -16,8 +16,7 @@ static bool is_post_eval(ti57_t *ti57) {
     return diff > 0 && diff <= 500;
 }
 
-// -1 means as fast as possible.
-static double get_goal_speed(rcl57_t *rcl57)
+int rcl57_get_goal_speed(rcl57_t *rcl57)
 {
     ti57_t *ti57 = &rcl57->ti57;
 
@@ -57,6 +56,7 @@ static double get_goal_speed(rcl57_t *rcl57)
         }
         return -1;
     }
+    return -1;
 }
 
 void rcl57_init(rcl57_t *rcl57)
@@ -65,10 +65,22 @@ void rcl57_init(rcl57_t *rcl57)
     rcl57->speedup = 1;
 }
 
+int rcl57_next(rcl57_t *rcl57)
+{
+    ti57_t *ti57 = &rcl57->ti57;
+
+    int n = ti57_next(ti57);
+    if (ti57_is_stopping(ti57) &&
+        rcl57->options & RCL57_QUICK_STOP_FLAG) {
+        utils57_burst_until_idle(ti57);
+    }
+    return n;
+}
+
 bool rcl57_advance(rcl57_t *rcl57, int ms)
 {
-    assert(ms > 0);
-    assert(rcl57->speedup > 0);
+    ASSERT57(ms > 0);
+    ASSERT57(rcl57->speedup > 0);
 
     ti57_t *ti57 = &rcl57->ti57;
 
@@ -76,12 +88,8 @@ bool rcl57_advance(rcl57_t *rcl57, int ms)
     int max_cycles = 5 * ms * rcl57->speedup;
 
     do {
-        int n = ti57_next(ti57);
-        if (ti57_is_stopping(ti57) &&
-            rcl57->options & RCL57_QUICK_STOP_FLAG) {
-            utils57_burst_until_idle(ti57);
-        }
-        double current_speed = get_goal_speed(rcl57);
+        int n = rcl57_next(rcl57);
+        double current_speed = rcl57_get_goal_speed(rcl57);
         if (current_speed == 0) {
             utils57_burst_until_idle(ti57);
             return false;
@@ -106,10 +114,12 @@ void rcl57_key_press(rcl57_t *rcl57, int row, int col)
         rcl57->at_end_program = false;
     }
 
+#if PLATFORM57_STRINGS
     if (ti57->mode == TI57_LRN &&
         rcl57->options & RCL57_HP_LRN_MODE_FLAG) {
          lrn57_key_press_in_hp_mode(rcl57, row, col);
     }
+#endif
 
     ti57_key_press(&rcl57->ti57, row, col);
 }
@@ -119,6 +129,17 @@ void rcl57_key_release(rcl57_t *rcl57)
     ti57_key_release(&rcl57->ti57);
 }
 
+bool rcl57_is_run_indicator(rcl57_t *rcl57)
+{
+    ti57_t *ti57 = &rcl57->ti57;
+
+    return ti57->mode == TI57_RUN &&
+           rcl57->options & RCL57_SHOW_RUN_INDICATOR_FLAG &&
+           ti57->activity != TI57_PAUSE &&
+           (rcl57_get_goal_speed(rcl57) < 0 || is_post_pause(ti57) || is_post_eval(ti57));
+}
+
+#if PLATFORM57_STRINGS
 char *rcl57_get_display(rcl57_t *rcl57)
 {
     ti57_t *ti57 = &rcl57->ti57;
@@ -129,10 +150,7 @@ char *rcl57_get_display(rcl57_t *rcl57)
         return lrn57_get_display(rcl57);
     }
 
-    if (ti57->mode == TI57_RUN &&
-        rcl57->options & RCL57_SHOW_RUN_INDICATOR_FLAG &&
-        ti57->activity != TI57_PAUSE &&
-        (get_goal_speed(rcl57) < 0 || is_post_pause(ti57) || is_post_eval(ti57))) {
+    if (rcl57_is_run_indicator(rcl57)) {
         return "[           ";
     }
 
@@ -144,6 +162,7 @@ char *rcl57_get_display(rcl57_t *rcl57)
 
     return utils57_display_to_str(&ti57->dA, &ti57->dB);
 }
+#endif
 
 void rcl57_clear(rcl57_t *rcl57) {
     ti57_init(&rcl57->ti57);
@@ -21,6 +21,11 @@
  *     rcl57_key_press(&rcl57, row, col);
  *   On key release:
  *     rcl57_key_release(&rcl57);
+ *
+ * A client that keeps its own pace, such as the RCL-57 firmware, calls
+ * rcl57_next() instead of rcl57_advance() and asks rcl57_get_goal_speed()
+ * for the speed of each operation. The LRN modes that show mnemonics and
+ * rcl57_get_display() need PLATFORM57_STRINGS (platform57.h).
  */
 
 #ifndef rcl57_h
@@ -67,6 +72,13 @@
 /** In LRN mode, show steps as alphanumeric mnemonics such as "LNX". */
 #define RCL57_ALPHA_LRN_MODE_FLAG              0x20
 
+/** All the options supported by this build. */
+#if PLATFORM57_STRINGS
+#define RCL57_OPTIONS_MASK                     0x3f
+#else
+#define RCL57_OPTIONS_MASK                     0x0f
+#endif
+
 typedef struct rcl57_s {
     ti57_t ti57;           // The underlying state.
     bool at_end_program;   // In HP mode, indicates that the last step has been executed.
@@ -77,6 +89,25 @@ typedef struct rcl57_s {
 /** Initializes or resets a RCL57. */
 void rcl57_init(rcl57_t *rcl57);
 
+/**
+ * Executes the operation at the current program counter address, as
+ * ti57_next() does.
+ *
+ * With RCL57_QUICK_STOP_FLAG, R/S pressed in RUN mode stops the program
+ * right away: the operations until the calculator waits for the key
+ * release are executed in one burst.
+ *
+ * Returns the relative cost of the operation (not counting the burst).
+ */
+int rcl57_next(rcl57_t *rcl57);
+
+/**
+ * The speed at which the current activity should run: 1 for the speed
+ * of an actual TI-57, 2 for twice that speed, or -1 for as fast as
+ * possible.
+ */
+int rcl57_get_goal_speed(rcl57_t *rcl57);
+
 /**
  * Runs the emulator for 'ms' milliseconds.
  *
@@ -90,6 +121,13 @@ void rcl57_key_press(rcl57_t *rcl57, int row, int col);
 /** Should be called when a key is released. */
 void rcl57_key_release(rcl57_t *rcl57);
 
+/**
+ * Whether the run indicator should be shown instead of the display, in
+ * RUN mode with RCL57_SHOW_RUN_INDICATOR_FLAG.
+ */
+bool rcl57_is_run_indicator(rcl57_t *rcl57);
+
+#if PLATFORM57_STRINGS
 /**
  * Returns the display as a string.
  *
@@ -105,6 +143,7 @@ void rcl57_key_release(rcl57_t *rcl57);
  * For example: "   02   vX  ".
  */
 char *rcl57_get_display(rcl57_t *rcl57);
+#endif
 
 /* Clears the state while preserving the options. */
 void rcl57_clear(rcl57_t *rcl57);
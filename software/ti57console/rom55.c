@@ -1,6 +1,6 @@
 #include "rom55.h"
 
-unsigned short ROM55[] =
+const unsigned short ROM55[2048] =
 {
     4400, 5066, 3089, 6364, 3237, 543, 813, 813, 3233, 6371, 3198, 6266, 3245, 6364, 1991, 5556,
     1865, 103, 3587, 6187, 6815, 3296, 3308, 6290, 6148, 3098, 6578, 2265, 3188, 5365, 6271, 2055,
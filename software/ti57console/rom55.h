@@ -5,6 +5,6 @@
 #ifndef rom55_h
 #define rom55_h
 
-extern unsigned short ROM55[2048];
+extern const unsigned short ROM55[2048];
 
 #endif  /* !rom55_h */
@@ -1,4 +1,6 @@
-unsigned short ROM57[] = {
+#include "rom57.h"
+
+const unsigned short ROM57[2048] = {
     0x120f, 0x1122, 0x13f2, 0x1b8b, 0x0cae, 0x1808, 0x16b5, 0x15fc,
     0x16ad, 0x1b8b, 0x1122, 0x0cae, 0x1ee7, 0x140c, 0x071e, 0x1a8e,
     0x0a28, 0x05d9, 0x198b, 0x1947, 0x19f2, 0x193e, 0x1af3, 0x1b1b,
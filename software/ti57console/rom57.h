@@ -5,6 +5,6 @@
 #ifndef rom57_h
 #define rom57_h
 
-extern unsigned short ROM57[2048];
+extern const unsigned short ROM57[2048];
 
 #endif  /* !rom57_h */
@@ -1,7 +1,7 @@
 #include "state57.h"
+#include "ops57.h"
 #include "utils57.h"
 
-#include <assert.h>
 #include <string.h>
 
 /**
@@ -103,6 +103,7 @@ bool ti57_is_stopping(ti57_t *ti57)
     return key57_get_key(ti57->row, ti57->col, false) == KEY57_RS;
 }
 
+#if PLATFORM57_STRINGS
 /**
  * AOS
  */
@@ -150,6 +151,7 @@ char *ti57_get_aos_stack(ti57_t *ti57)
     str[k++] = 0;
     return str;
 }
+#endif
 
 /**
  * USER REGISTERS
@@ -220,70 +222,49 @@ int ti57_get_program_ret(ti57_t *ti57, int i)
     return (ti57->X[6 + i][15] << 4) + ti57->X[6 + i][14];
 }
 
-static op57_t ALL_OPS[256];
-
-static void init_ops(void)
+/** Returns the nibbles of a step (step in 0..49): low nibble first. */
+static unsigned char *get_step_nibbles(ti57_t *ti57, int step)
 {
-    for (int i = 0; i <= 0xff; i++) {
-        op57_t *op = &ALL_OPS[i];
-        if (i < 0x10) {
-            // Digits.
-            op->inv = false;
-            op->key = i;
-            op->d = -1;
-        } else if (i < 0xb0) {
-            // Ops with no parameters.
-            op->inv = (i & 0x08) != 0;
-            op->key = (((i & 0x07) + 1) << 4) | (i & 0xf0) >> 4;
-            op->d = -1;
-        } else {
-            // Register ops: RCL, PRD, SUM, EXC and STO.
-            static key57_t keys[] = {0x33, 0x38, 0x34, 0x39, 0x32};
-            op->inv = (i & 0x08) != 0;
-            op->key = keys[(i >> 4) - 0xb];
-            op->d = i & 0x07;
-        }
-    }
+    //assert(0 <= step && step <= 49);
 
-    // LBL, GTO, SBR and FIX.
-    static int start_indices[] = {0x27, 0x2f, 0x77, 0x7f};
-    static key57_t keys[] = {0x86, 0x51, 0x61, 0x48};
-    static int offsets[] = {0, -1, 15, 31, -2, 14, 30, -3, 13, 29};
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 10; j++) {
-            op57_t *op = &ALL_OPS[start_indices[i] + offsets[j]];
-            op->inv = false;
-            op->key = keys[i];
-            op->d = j;
-        }
+    if (step == 49) {
+        return &ti57->Y[7][14];
     }
+    return &ti57->Y[step / 8][14 - 2 * (step % 8)];
 }
 
-static op57_t *get_op(unsigned char index)
+int ti57_get_program_opcode(ti57_t *ti57, int step)
 {
-    return &ALL_OPS[index];
+    unsigned char *nibbles = get_step_nibbles(ti57, step);
+
+    return (nibbles[1] << 4) | nibbles[0];
 }
 
-op57_t *ti57_get_program_op(ti57_t *ti57, int step)
+const op57_t *ti57_get_program_op(ti57_t *ti57, int step)
 {
-    int i;
-    ti57_reg_t *reg;
-    static bool initialized = false;
+    return &OPS57[ti57_get_program_opcode(ti57, step)];
+}
 
-    //assert(0 <= step && step <= 49);
+void ti57_set_program_opcode(ti57_t *ti57, int step, int opcode)
+{
+    unsigned char *nibbles = get_step_nibbles(ti57, step);
+
+    nibbles[1] = (opcode >> 4) & 0x0f;
+    nibbles[0] = opcode & 0x0f;
+}
 
-    if (!initialized) {
-        init_ops();
-        initialized = true;
+void ti57_get_program_opcodes(ti57_t *ti57, unsigned char opcodes[50])
+{
+    for (int step = 0; step < 50; step++) {
+        opcodes[step] = ti57_get_program_opcode(ti57, step);
     }
-    if (step == 49) {
-        reg = &ti57->Y[7];
-        i = 15;
-    } else {
-        reg = &ti57->Y[step / 8];
-        i = 15 - 2 * (step % 8);
+}
+
+void ti57_set_program_opcodes(ti57_t *ti57, const unsigned char *opcodes, int count)
+{
+    for (int step = 0; step < 50; step++) {
+        ti57_set_program_opcode(ti57, step, step < count ? opcodes[step] : 0);
     }
-    return get_op(((*reg)[i] << 4) | (*reg)[i-1]);
 }
 
 int ti57_get_program_last_index(ti57_t *ti57)
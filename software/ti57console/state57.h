@@ -7,8 +7,8 @@
 
 #include <stdbool.h>
 
+#include "platform57.h"
 #include "key57.h"
-#include "log57.h"
 #include "op57.h"
 
 /**
@@ -50,29 +50,42 @@ typedef enum ti57_trig_e {
     TI57_GRAD,
 } ti57_trig_t;
 
-/** The state of a TI-57. */
+#if PLATFORM57_LOG
+/** Optional log, see log57.h. */
+struct log57_s;
+#endif
+
+/**
+ * The state of a TI-57.
+ *
+ * Fields touched by every call to 'next' come first so that they share the first 2 cache lines:
+ * the scalar CPU state and A, B, C in the first one, D and the bookkeeping in the second one.
+ */
 typedef struct ti57_s {
     // The internal state of a TI-57.
-    ti57_reg_t A, B, C, D;           // Operational registers.
-    ti57_reg_t X[8], Y[8];           // Storage registers.
-    unsigned char RAB;               // Register Address Buffer (3-bit).
-    unsigned char R5;                // Auxiliary 8-bit register.
     ti57_address_t pc;               // Internal program counter.
     ti57_address_t stack[3];         // Subroutine stack.
+    unsigned char R5;                // Auxiliary 8-bit register.
+    unsigned char RAB;               // Register Address Buffer (3-bit).
     bool COND;                       // Conditional latch.
     bool is_hex;                     // Arithmetic done in base 16 instead of 10.
-    int row, col;                    // Row (1..8) and column (1..5) of last pressed key.
     bool is_key_pressed;             // Whether a key is being pressed by the user.
+    bool display_update;             // Whether the last operation was a display cycle.
+    ti57_reg_t A, B, C, D;           // Operational registers.
+    unsigned long current_cycle;     // The number of cycles the emulator has been running for.
+    ti57_mode_t mode;                // The current mode.
+    ti57_activity_t activity;        // The current activity.
+    int row, col;                    // Row (1..8) and column (1..5) of last pressed key.
+    ti57_reg_t X[8], Y[8];           // Storage registers.
 
     ti57_reg_t dA, dB;               // Copy of A and B for display purposes.
-    unsigned long current_cycle;     // The number of cycles the emulator has been running for.
     unsigned long last_disp_cycle;   // The cycle DISP (display refresh) was executed last.
     unsigned long last_pause_cycle;  // The cycle the calculator was last paused.
     unsigned long last_eval_cycle;   // The cycle the calculator was last in eval mode.
-    ti57_mode_t mode;                // The current mode.
-    ti57_activity_t activity;        // The current activity.
 
-    log57_t log;                     // The sequence of operations and results.
+#if PLATFORM57_LOG
+    struct log57_s *log;             // The sequence of operations and results, 0 if not logging.
+#endif
 } ti57_t;
 
 /**
@@ -119,6 +132,7 @@ bool ti57_is_trace(ti57_t *ti57);
 /** 'R/S' is pressed while in RUN mode. */
 bool ti57_is_stopping(ti57_t *ti57);
 
+#if PLATFORM57_STRINGS
 /**
  * AOS
  */
@@ -138,6 +152,7 @@ bool ti57_is_stopping(ti57_t *ti57);
  * For example "0+1*(2+d"
  */
 char *ti57_get_aos_stack(ti57_t *ti57);
+#endif
 
 /**
  * USER REGISTERS
@@ -168,8 +183,20 @@ int ti57_get_program_pc(ti57_t *ti57);
 /** Returns the subroutine return addresses (i in 0..1). */
 int ti57_get_program_ret(ti57_t *ti57, int i);
 
+/** Returns the opcode (0x00..0xff) at a given step (step in 0..49), see ops57.h. */
+int ti57_get_program_opcode(ti57_t *ti57, int step);
+
 /** Returns the operation at a given step (step in 0..49). */
-op57_t *ti57_get_program_op(ti57_t *ti57, int step);
+const op57_t *ti57_get_program_op(ti57_t *ti57, int step);
+
+/** Sets the opcode (0x00..0xff) at a given step (step in 0..49). */
+void ti57_set_program_opcode(ti57_t *ti57, int step, int opcode);
+
+/** Copies the opcodes of the 50 steps. */
+void ti57_get_program_opcodes(ti57_t *ti57, unsigned char opcodes[50]);
+
+/** Sets the steps to 'count' opcodes, clearing the remaining steps. */
+void ti57_set_program_opcodes(ti57_t *ti57, const unsigned char *opcodes, int count);
 
 /** Returns the index of the last non-zero step, or -1 if none,*/
 int ti57_get_program_last_index(ti57_t *ti57);
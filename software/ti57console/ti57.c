@@ -1,11 +1,11 @@
 #include "ti57.h"
 
-#include <assert.h>
 #include <stdio.h>
 #include <string.h>
 
+#if PLATFORM57_LOG
 #include "logger57.h"
-#include "rom57.h"
+#endif
 #include "utils57.h"
 
 /** A 13-bit opcode. */
@@ -214,10 +214,13 @@ static void op_misc(ti57_t *ti57, ti57_opcode_t opcode)
             memcpy(ti57->dA, ti57->A, sizeof(ti57_reg_t));
             memcpy(ti57->dB, ti57->B, sizeof(ti57_reg_t));
             ti57->last_disp_cycle = ti57->current_cycle;
-			if (in_register_dump == 0) {
-				printf("\r\nDISPLAY CYCLE - %s", utils57_reg_to_str(ti57->dA));
-				printf(" %s", utils57_reg_to_str(ti57->dB));
-			}
+            ti57->display_update = true;
+#if PLATFORM57_TRACE
+            if (in_register_dump == 0) {
+                printf("\r\nDISPLAY CYCLE - %s", utils57_reg_to_str(ti57->dA));
+                printf(" %s", utils57_reg_to_str(ti57->dB));
+            }
+#endif
             break;
     case 8: ti57->is_hex = false; break;
     case 9: ti57->is_hex = true; break;
@@ -366,15 +369,20 @@ void ti57_init(ti57_t *ti57)
 
 int ti57_next(ti57_t *ti57)
 {
-    ti57_opcode_t opcode = ROM57[ti57->pc];
+    ti57_opcode_t opcode = PLATFORM57_ROM[ti57->pc];
+#if PLATFORM57_LOG
     ti57_activity_t previous_activity = ti57->activity;
     ti57_mode_t previous_mode = ti57->mode;
+#endif
 
-    assert(opcode <= 0x1fff);
+    ASSERT57(opcode <= 0x1fff);
 
-	if (in_register_dump == 0)
-		printf("\n\rnext:PC-OPCODE = %04X-%04X",(unsigned int)ti57->pc, (unsigned int)opcode);
+#if PLATFORM57_TRACE
+    if (in_register_dump == 0)
+        printf("\n\rnext:PC-OPCODE = %04X-%04X", (unsigned int)ti57->pc, (unsigned int)opcode);
+#endif
 
+    ti57->display_update = false;
     ti57->pc += 1;
 
     // Execute operation.
@@ -393,13 +401,26 @@ int ti57_next(ti57_t *ti57)
     // Update state.
     update_mode(ti57);
     update_activity(ti57);
-    //logger57_update_after_next(ti57, previous_activity, previous_mode);
+
+#if PLATFORM57_LOG
+    // The logger only acts on activity and mode transitions: don't call it otherwise.
+    if (ti57->log && (ti57->activity != previous_activity || ti57->mode != previous_mode)) {
+        logger57_update_after_next(ti57, previous_activity, previous_mode);
+    }
+#endif
 
     int cost = ((opcode & 0x0e07) == 0x0e07) ? 32 : 1;
     ti57->current_cycle += cost;
     return cost;
 }
 
+#if PLATFORM57_LOG
+void ti57_set_log(ti57_t *ti57, log57_t *log)
+{
+    ti57->log = log;
+}
+#endif
+
 void ti57_key_release(ti57_t *ti57)
 {
     // Do not zero out row and col, so we can keep track of the last pressed key.
@@ -409,15 +430,19 @@ void ti57_key_release(ti57_t *ti57)
 
 void ti57_key_press(ti57_t *ti57, int row, int col)
 {
-    assert(1 <= row && row <= 8);
-    assert(1 <= col && col <= 5);
+    ASSERT57(1 <= row && row <= 8);
+    ASSERT57(1 <= col && col <= 5);
 
     ti57->row = row;
     ti57->col = col;
     ti57->is_key_pressed = true;
-    ti57->log.step_at_key_press = ti57_get_program_pc(ti57);
+#if PLATFORM57_LOG
+    if (ti57->log)
+        ti57->log->step_at_key_press = ti57_get_program_pc(ti57);
+#endif
 }
 
+#if PLATFORM57_STRINGS
 char *ti57_get_display(ti57_t *ti57)
 {
     static char str[26];
@@ -429,3 +454,4 @@ char *ti57_get_display(ti57_t *ti57)
 
     return utils57_display_to_str(&ti57->dA, &ti57->dB);
 }
+#endif
@@ -16,11 +16,17 @@
  *     ti57_key_press(&ti57, row, col);
  *   On key release:
  *     ti57_key_release(&ti57);
+ *
+ * What is compiled in depends on the platform profile, see platform57.h.
  */
 
 #ifndef ti57_h
 #define ti57_h
 
+#include "platform57.h"
+#if PLATFORM57_LOG
+#include "log57.h"
+#endif
 #include "state57.h"
 
 /** Initializes the state of a TI-57. */
@@ -30,19 +36,30 @@ void ti57_init(ti57_t *ti57);
  * Executes the operation at the current program counter address.
  *
  * A TI-57 is always executing operations, possibly just polling for user
- * input. It takes around 1/5000 seconds to execute most operations.
+ * input. It takes around 1/5000 seconds (200us) to execute most operations.
  *
  * Returns the relative cost of the operation, most often 1 though some
  * operations, such as those involving the display, may take longer.
  */
 int ti57_next(ti57_t *ti57);
 
+#if PLATFORM57_LOG
+/**
+ * Attaches a log to a TI-57, or detaches it if 'log' is 0.
+ *
+ * The log is owned by the client and is not part of ti57_t, so that a TI-57 that doesn't need a
+ * log stays small. A TI-57 starts without a log.
+ */
+void ti57_set_log(ti57_t *ti57, log57_t *log);
+#endif
+
 /** Should be called when a key is pressed (row in 1..8, col in 1..5). */
 void ti57_key_press(ti57_t *ti57, int row, int col);
 
 /** Should be called when a key is released. */
 void ti57_key_release(ti57_t *ti57);
 
+#if PLATFORM57_STRINGS
 /**
  * Returns the display as a string.
  *
@@ -57,5 +74,6 @@ void ti57_key_release(ti57_t *ti57);
  * For example: "  -3.14159   ".
  */
 char *ti57_get_display(ti57_t *ti57);
+#endif
 
 #endif  /* !ti57_h */
@@ -2,6 +2,11 @@
 #include <stdio.h>
 #include <string.h>
 
+#if PLATFORM57_TRACE
+char in_register_dump = 0;
+#endif
+
+#if PLATFORM57_STRINGS
 char *utils57_trim(char *str)
 {
     char *begin, *end;
@@ -36,7 +41,9 @@ char *utils57_user_reg_to_str(ti57_reg_t *reg, bool sci, int fix)
     // Hack: we run a new emulator and modify its state to compute the string representation of reg.
 
     static char str[25];
-	in_register_dump = 1;
+#if PLATFORM57_TRACE
+    in_register_dump = 1;
+#endif
     ti57_t ti57;
     ti57_reg_t *T;
 
@@ -67,7 +74,9 @@ char *utils57_user_reg_to_str(ti57_reg_t *reg, bool sci, int fix)
         *last = 0;
     }
 
-	in_register_dump = 0;
+#if PLATFORM57_TRACE
+    in_register_dump = 0;
+#endif
     return str;
 }
 
@@ -101,6 +110,7 @@ char *utils57_display_to_str(ti57_reg_t *digits, ti57_reg_t *mask)
 
     return str;
 }
+#endif
 
 void utils57_burst_until_idle(ti57_t *ti57)
 {
@@ -7,9 +7,12 @@
 
 #include "ti57.h"
 
-/** Non-zero when inside the register dump hack */
-char in_register_dump = 0;
+#if PLATFORM57_TRACE
+/** Non-zero when inside the register dump hack, which mutes the trace. */
+extern char in_register_dump;
+#endif
 
+#if PLATFORM57_STRINGS
 /** Trims 'str'. */
 char *utils57_trim(char *str);
 
@@ -30,6 +33,7 @@ char *utils57_user_reg_to_str(ti57_reg_t *reg, bool sci, int fix);
  * other one the mask (typically register B or dB in ti57_t),  returns a string representing the display.
  */
 char *utils57_display_to_str(ti57_reg_t *digits, ti57_reg_t *mask);
+#endif
 
 /** Calls 'ti57_next' repeatedly until the calculator is waiting for a key press or a key release. */
 void utils57_burst_until_idle(ti57_t *ti57);
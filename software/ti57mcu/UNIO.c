@@ -20,63 +20,59 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 
-#include "UNIO.h"
+#include "unio.h"
+#include "prof57.h"
 
-#include "stm32f10x.h"
-
-/* GPT polled microsecond delay function */
-void delayMicroseconds(uint16_t us)
+/* Steps of a request: set the write enable bit, send the command, then
+   poll the status register until the write cycle is over */
+typedef enum
 {
-    /* load the reload-register with target tick value */
-    //TIM3->ARR = (us - 1);
-    GPT_RELOAD(us - 1);
-
-    /* force update of the PSC and ARR */
-    //TIM3->EGR |= TIM_EGR_UG;
-    GPT_UPDATE;
-
-    /* start the timer */
-    //TIM3->CR1  |= TIM_CR1_CEN;
-    GPT_START;
+    STEP_ENABLE,
+    STEP_COMMAND,
+    STEP_POLL
+} step_t;
 
-    /* wait for timer to expire */
-    while (TIM3->CR1 & TIM_CR1_CEN)
-        __NOP();
-}
-
-/* GPT polled transition hunt function - returns true if transition found */
-bool huntMicroseconds(uint16_t us)
+/* Phases of a command on the bus */
+typedef enum
 {
-    bool state;
-    UNIO_HIGH;      // release bus to pullup
-
-    /* load the reload-register with target tick value */
-    //TIM3->ARR = (us - 1);
-    GPT_RELOAD(us - 1);
-
-    /* force update of the PSC and ARR */
-    //TIM3->EGR |= TIM_EGR_UG;
-    GPT_UPDATE;
-
-    /* start the timer */
-    //TIM3->CR1  |= TIM_CR1_CEN;
-    GPT_START;
-
-    /* capture the input state */
-    state = !!(UNIO_INP);
-
-    /* wait for timer to expire OR the state to change */
-    while (GPT_RUNNING && (state == !!(UNIO_INP)))
-        __NOP();
-
-    /* stop the timer */
-    //TIM3->CR1  &= ~TIM_CR1_CEN;
-    GPT_STOP;
-
-    /* return true if state changed */
-    return (state == !(UNIO_INP));
-}
-
+    PHASE_STANDBY_LOW,      // low before the standby pulse
+    PHASE_GAP,              // high: standby pulse, or gap between commands
+    PHASE_HEADER_LOW,       // low of the start header
+    PHASE_BITS,             // header and command bytes, quarter bit by quarter bit
+    PHASE_END               // last quarter of the last SAK
+} phase_t;
+
+/* Request queue: the main loop writes tail, the ISR writes head */
+static unio_request_t* volatile queue[UNIO_QUEUE_SIZE];
+static volatile uint8_t queue_head;
+static volatile uint8_t queue_tail;
+static volatile bool is_running;
+
+/* Request being run, from the TIM3 ISR */
+static unio_request_t* request;
+static step_t step;
+static uint16_t done_count;         // UNIO_OP_WRITE bytes written
+static uint16_t chunk;              // UNIO_OP_WRITE bytes in the current page
+static uint8_t poll_count;
+static uint8_t poll_status;
+static bool is_standby_needed = true;
+
+/* Command being clocked: header, tx bytes, then data sent or received */
+static phase_t phase;
+static uint8_t tx[4];
+static uint8_t tx_count;
+static uint8_t* data;
+static uint16_t data_count;
+static bool is_data_read;
+static uint16_t byte_index;         // 0 = start header
+static uint8_t bit_index;           // 0-7 data, 8 MAK, 9 SAK
+static uint8_t quarter;
+static uint8_t shift;
+static bool is_sending;             // master drives the bits of this byte
+static bool first_sample;
+static bool is_command_ok;
+
+static uint16_t begin_request(void);
 
 static void unio_set_bus(bool state)
 {
@@ -91,285 +87,414 @@ static inline bool unio_read_bus(void)
     return !!(UNIO_INP);
 }
 
-/* If multiple commands are to be issued to a device without a standby
-   pulse in between, the bus must be held high for at least UNIO_TSS
-   between the end of one command and the start of the next. */
-static void unio_inter_command_gap(void)
+/* Set up the next command of the request for the current step, and start
+   it after 'gap_us' of high bus (or after a standby pulse if the device
+   needs one). Returns the time until the next event */
+static uint16_t begin_command(uint16_t gap_us)
 {
-    UNIO_HIGH;
-    delayMicroseconds(UNIO_TSS_US + UNIO_MARGIN_US);
-}
+    uint16_t address = request->address + done_count;
 
-/* Send a standby pulse on the bus.  After power-on or brown-out
-   reset, the device requires a low-to-high transition on the bus at
-   the start of the standby pulse.  To be conservative, we take the
-   bus low for UNIO_TSS, then high for UNIO_TSTBY. */
-static void unio_standby_pulse(void)
-{
-    UNIO_LOW;
-    delayMicroseconds(UNIO_TSS_US + UNIO_MARGIN_US);
+    tx[0] = request->dev_address;
+    tx_count = 2;
+    data = NULL;
+    data_count = 0;
+    is_data_read = false;
+
+    if (step == STEP_ENABLE)
+        tx[1] = UNIO_EEPROM_WREN;
+    else if (step == STEP_POLL)
+    {
+        tx[1] = UNIO_EEPROM_RDSR;
+        data = &poll_status;
+        data_count = 1;
+        is_data_read = true;
+    }
+    else
+    {
+        switch (request->op)
+        {
+        case UNIO_OP_READ:
+            tx[1] = UNIO_EEPROM_READ;
+            data = request->buffer;
+            data_count = request->length;
+            is_data_read = true;
+            break;
+        case UNIO_OP_WRITE:
+            /* truncate the write to the page boundary */
+            chunk = request->length - done_count;
+            if (((address & 0x0f) + chunk) > 16)
+                chunk = 16 - (address & 0x0f);
+            tx[1] = UNIO_EEPROM_WRITE;
+            data = request->buffer + done_count;
+            data_count = chunk;
+            break;
+        case UNIO_OP_READ_STATUS:
+            tx[1] = UNIO_EEPROM_RDSR;
+            data = request->buffer;
+            data_count = 1;
+            is_data_read = true;
+            break;
+        case UNIO_OP_WRITE_STATUS:
+            tx[1] = UNIO_EEPROM_WRSR;
+            tx[2] = request->buffer[0];
+            tx_count = 3;
+            break;
+        case UNIO_OP_ENABLE_WRITE:
+            tx[1] = UNIO_EEPROM_WREN;
+            break;
+        case UNIO_OP_DISABLE_WRITE:
+            tx[1] = UNIO_EEPROM_WRDI;
+            break;
+        case UNIO_OP_ERASE_ALL:
+            tx[1] = UNIO_EEPROM_ERAL;
+            break;
+        case UNIO_OP_SET_ALL:
+            tx[1] = UNIO_EEPROM_SETAL;
+            break;
+        default:
+            tx[1] = UNIO_EEPROM_RDSR;
+            break;
+        }
+        if ((request->op == UNIO_OP_READ) || (request->op == UNIO_OP_WRITE))
+        {
+            tx[2] = (uint8_t)(address >> 8);
+            tx[3] = (uint8_t)(address & 0xff);
+            tx_count = 4;
+        }
+    }
+
+    /* After power-on, brown-out reset or an error, the device requires a
+       low-to-high transition on the bus at the start of the standby
+       pulse. To be conservative, we take the bus low for UNIO_TSS, then
+       high for UNIO_TSTBY. */
+    if (is_standby_needed)
+    {
+        is_standby_needed = false;
+        UNIO_LOW;
+        phase = PHASE_STANDBY_LOW;
+        return UNIO_TSS_US + UNIO_MARGIN_US;
+    }
+
+    /* Otherwise the bus must be held high for at least UNIO_TSS between
+       the end of one command and the start of the next. */
     UNIO_HIGH;
-    delayMicroseconds(UNIO_TSTBY_US + UNIO_MARGIN_US);
+    phase = PHASE_GAP;
+    return gap_us;
 }
 
-/* While bit-banging, all delays are expressed in terms of UNIO_BIT_US.
-   We use the similar code path for reading and writing.  During a
-   write, we perform dummy reads at 1/4 and 3/4 of the way through
-   each bit time.  During a read we perform a dummy write at the start
-   and 1/2 way through each bit time. By using a hardware General Purpose
-   timer, this code is not NEARLY as critial as it would be if software
-   loops were used. */
-
-static bool unio_send_bit(bool w)
+/* Complete the request being run, and start the next one if any */
+static uint16_t end_request(bool ok)
 {
-    bool a, b;
-    unio_set_bus(!w);
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    a = unio_read_bus();
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    unio_set_bus(w);
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    b = unio_read_bus();
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    return b && !a;
+    request->status = ok ? UNIO_OK : UNIO_FAILED;
+    if (request->done != NULL)
+        request->done(request);
+
+    queue_head = (queue_head + 1) & (UNIO_QUEUE_SIZE - 1);
+    if (queue_head == queue_tail)
+    {
+        is_running = false;
+        return 0;
+    }
+    return begin_request();
 }
 
-static bool unio_receive_bit(void)
+/* Start the request at the head of the queue */
+static uint16_t begin_request(void)
 {
-    bool a, b;
-    unio_set_bus(1);  // release bus to pullup
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    a = unio_read_bus();
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    unio_set_bus(1);  // release bus to pullup
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    b = unio_read_bus();
-    delayMicroseconds(UNIO_QUARTER_BIT_US);
-    return b && !a;
+    request = queue[queue_head];
+    done_count = 0;
+    poll_count = 0;
+
+    switch (request->op)
+    {
+    case UNIO_OP_WRITE:
+    case UNIO_OP_WRITE_STATUS:
+    case UNIO_OP_ERASE_ALL:
+    case UNIO_OP_SET_ALL:
+        step = STEP_ENABLE;
+        break;
+    case UNIO_OP_AWAIT_WRITE:
+        step = STEP_POLL;
+        break;
+    default:
+        step = STEP_COMMAND;
+        break;
+    }
+    return begin_command(UNIO_TSS_US + UNIO_MARGIN_US);
 }
-/* Send a single byte terminated by MAK/NoMAK. Return SAK/NoSAK status */
-static bool unio_send_byte(uint8_t b, bool mak)
+
+/* A command ended on the bus: move on to the next step of the request */
+static uint16_t end_command(bool ok)
 {
-    for (int i = 0; i < 8; i++)
+    if (!ok)
     {
-        unio_send_bit(b & 0x80);
-        b <<= 1;
+        /* NoSAK: the device waits for a standby pulse */
+        is_standby_needed = true;
+        return end_request(false);
     }
-    unio_send_bit(mak);           // transmite MAK/NoMAK
 
-    return unio_receive_bit();    // return SAK/NoSAK status
+    switch (step)
+    {
+    case STEP_ENABLE:
+        step = STEP_COMMAND;
+        return begin_command(UNIO_TSS_US + UNIO_MARGIN_US);
+
+    case STEP_COMMAND:
+        if ((request->op == UNIO_OP_WRITE) || (request->op == UNIO_OP_WRITE_STATUS) ||
+                (request->op == UNIO_OP_ERASE_ALL) || (request->op == UNIO_OP_SET_ALL))
+        {
+            step = STEP_POLL;
+            poll_count = 0;
+            return begin_command(UNIO_POLL_US);
+        }
+        return end_request(true);
+
+    default:
+        if (poll_status & UNIO_EEPROM_STATUS_WIP)
+        {
+            if (++poll_count >= UNIO_POLL_LIMIT)
+                return end_request(false);
+            return begin_command(UNIO_POLL_US);
+        }
+        if (request->op == UNIO_OP_WRITE)
+        {
+            done_count += chunk;
+            if (done_count < request->length)
+            {
+                step = STEP_ENABLE;
+                return begin_command(UNIO_TSS_US + UNIO_MARGIN_US);
+            }
+        }
+        return end_request(true);
+    }
 }
 
-/* Receive a single byte terminated by MAK/NoMAK. Return SAK/NoSAK status */
-static bool unio_receive_byte(uint8_t* b, bool mak)
+/* Load the byte about to be clocked: the start header, a command byte,
+   or a data byte */
+static void begin_byte(void)
 {
-    uint8_t data = 0;
-    for (int i = 0; i < 8; i++)
+    is_sending = true;
+    if (byte_index == 0)
+        shift = UNIO_STARTHEADER;
+    else if (byte_index <= tx_count)
+        shift = tx[byte_index - 1];
+    else if (!is_data_read)
+        shift = data[byte_index - 1 - tx_count];
+    else
     {
-        data = (data << 1) | unio_receive_bit();
+        is_sending = false;
+        shift = 0;
     }
-    *b = data;
-    unio_send_bit(mak);           // issue MAK/NoMAK
-
-    return unio_receive_bit();    // return SAK/NoSAK status
 }
 
-/* Send multiple byte data on the bus. If end is true, send NoMAK after the last
-   byte; otherwise send MAK. */
-static bool unio_send_n_bytes(const uint8_t* data, uint16_t length, bool end)
+/* While clocking, all delays are expressed in terms of UNIO_BIT_US. We
+   use the same code path for sending and receiving: each bit takes four
+   quarters, driving the bus at the start and 1/2 way through the bit,
+   and sampling it at 1/4 and 3/4 of the way through. While receiving,
+   the bus is released to the pullup at the start and 1/2 way through.
+   A bit is 1 if the bus went from low to high. */
+static uint16_t clock_quarter(void)
 {
-    for (uint16_t i = 0; i < length; i++)
+    bool bit;
+    bool is_send_slot = (bit_index == 8) || ((bit_index < 8) && is_sending);
+    bool is_last_byte = (byte_index == tx_count + data_count);
+    bool w = (bit_index == 8) ? !is_last_byte : !!(shift & 0x80);
+
+    switch (quarter)
     {
-        /* Rules for sending MAK: if it's the last byte and end is true,
-           send NoMAK.  Otherwise send MAK. */
-        if (!unio_send_byte(data[i], !(((i + 1) == length) && end)))
-            return false;
+    case 0:
+        unio_set_bus(is_send_slot ? !w : true);
+        break;
+    case 1:
+        first_sample = unio_read_bus();
+        break;
+    case 2:
+        unio_set_bus(is_send_slot ? w : true);
+        break;
+    default:
+        bit = unio_read_bus() && !first_sample;
+        quarter = 0;
+        if (bit_index < 8)
+        {
+            shift = (shift << 1) | ((is_sending == false) && bit);
+            bit_index++;
+            return UNIO_QUARTER_BIT_US;
+        }
+        if (bit_index == 8)
+        {
+            bit_index++;
+            return UNIO_QUARTER_BIT_US;
+        }
+
+        /* SAK slot: no slave answers the start header. The command ends
+           with the bit time, a quarter bit later */
+        is_command_ok = (byte_index == 0) || bit;
+        if (is_command_ok && (byte_index > tx_count) && is_data_read)
+            data[byte_index - 1 - tx_count] = shift;
+        if (!is_command_ok || is_last_byte)
+        {
+            phase = PHASE_END;
+            return UNIO_QUARTER_BIT_US;
+        }
+        byte_index++;
+        bit_index = 0;
+        begin_byte();
+        return UNIO_QUARTER_BIT_US;
     }
-    return true;
+    quarter++;
+    return UNIO_QUARTER_BIT_US;
 }
 
-/* Read data from the bus.  After reading 'length' bytes, send NoMAK to
-   terminate the command. */
-static bool unio_receive_n_bytes(uint8_t* data, uint16_t length)
+/* TIM3 compare interrupt: one event of the command on the bus */
+void TIM3_IRQHandler(void)
 {
-    for (uint16_t i = 0; i < length; i++)
+    uint16_t us;
+    prof57_mark_t mark;
+
+    PROF57_BEGIN(mark);
+
+    switch (phase)
     {
-        if (!unio_receive_byte(data + i, !((i + 1) == length)))
-            return false;
+    case PHASE_STANDBY_LOW:
+        UNIO_HIGH;
+        phase = PHASE_GAP;
+        us = UNIO_TSTBY_US + UNIO_MARGIN_US;
+        break;
+    case PHASE_GAP:
+        UNIO_LOW;
+        phase = PHASE_HEADER_LOW;
+        us = UNIO_HEADER_LOW_US;
+        break;
+    case PHASE_HEADER_LOW:
+        /* release the bus and clock the start header right away */
+        UNIO_HIGH;
+        phase = PHASE_BITS;
+        byte_index = 0;
+        bit_index = 0;
+        quarter = 0;
+        begin_byte();
+        us = clock_quarter();
+        break;
+    case PHASE_BITS:
+        us = clock_quarter();
+        break;
+    default:
+        us = end_command(is_command_ok);
+        break;
     }
-    return true;
+
+    if (us != 0)
+        GPT_ALARM_NEXT(us);
+    else
+        GPT_ALARM_STOP;
+
+    PROF57_END(mark, PROF57_UNIO);
 }
 
-/* Put the UNIO bus to sleep. This does NOT init the MCU GPT and GPIO
-   resources! That must be done elsewhere. */
+/* Reset the engine. This does NOT init the MCU GPT and GPIO resources!
+   That must be done elsewhere. */
 void UNIO_init()
 {
-    GPT_STOP;
-    GPT_UPDATE;
-    unio_standby_pulse();
+    GPT_ALARM_STOP;
+    UNIO_HIGH;
+    queue_head = 0;
+    queue_tail = 0;
+    is_running = false;
+    is_standby_needed = true;
 }
 
-/* Send a start header on the bus.  Hold the bus low for UNIO_THDR,
-   then transmit UNIO_STARTHEADER.  There is a time slot for SAK after
-   this transmission, but we must ignore the value because no slave
-   devices will drive the bus; if there is more than one device
-   connected then that could cause bus contention. */
-static void unio_start_header(void)
+bool UNIO_submit(unio_request_t* request)
 {
-    UNIO_LOW;
-    //delayMicroseconds(UNIO_THDR_US + UNIO_MARGIN_US);
-    delayMicroseconds(70);
-    UNIO_HIGH;
-    unio_send_byte(UNIO_STARTHEADER, true);
+    uint8_t tail = queue_tail;
+    uint8_t next = (tail + 1) & (UNIO_QUEUE_SIZE - 1);
+
+    if (next == queue_head)
+        return false;
+
+    request->status = UNIO_PENDING;
+    queue[tail] = request;
+    queue_tail = next;
+
+    /* the ISR only goes idle after finding the queue empty, so a request
+       queued while it runs is always picked up by one side or the other */
+    if (!is_running)
+    {
+        is_running = true;
+        GPT_ALARM_START(begin_request());
+    }
+    return true;
 }
 
-bool UNIO_read(uint8_t dev_address, uint8_t* buffer, uint16_t mem_address, uint16_t length)
+bool UNIO_is_busy(void)
 {
-    bool a, b;
-    uint8_t cmd[4];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_READ;
-    cmd[2] = (uint8_t)(mem_address >> 8);
-    cmd[3] = (uint8_t)(mem_address & 0xff);
-    unio_inter_command_gap();
-    unio_start_header();
-    a = unio_send_n_bytes(cmd, 4, false);
-    b = unio_receive_n_bytes(buffer, length);
-    return a && b;
+    return is_running;
 }
 
-bool UNIO_start_write(uint8_t dev_address, const uint8_t* buffer, uint16_t mem_address, uint16_t length)
+/* Queue a request and sleep until it is done */
+static bool unio_run(uint8_t dev_address, unio_op_t op, uint8_t* buffer, uint16_t address, uint16_t length)
 {
-    bool a, b;
-    uint8_t cmd[4];
-    if (((mem_address & 0x0f) + length) > 16)
-        return false; // would cross page boundary
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_WRITE;
-    cmd[2] = (uint8_t)(mem_address >> 8);
-    cmd[3] = (uint8_t)(mem_address & 0xff);
-    unio_inter_command_gap();
-    unio_start_header();
-    a = unio_send_n_bytes(cmd, 4, false);
-    b = unio_send_n_bytes(buffer, length, true);
-    return a && b;
+    unio_request_t r;
+
+    r.dev_address = dev_address;
+    r.op = op;
+    r.address = address;
+    r.buffer = buffer;
+    r.length = length;
+    r.done = NULL;
+
+    while (!UNIO_submit(&r))
+        hal57_wait_for_interrupt();
+    while (r.status == UNIO_PENDING)
+        hal57_wait_for_interrupt();
+
+    return r.status == UNIO_OK;
+}
+
+bool UNIO_read(uint8_t dev_address, uint8_t* buffer, uint16_t mem_address, uint16_t length)
+{
+    if (length == 0)
+        return true;
+    return unio_run(dev_address, UNIO_OP_READ, buffer, mem_address, length);
 }
 
 bool UNIO_enable_write(uint8_t dev_address)
 {
-    uint8_t cmd[2];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_WREN;
-    unio_inter_command_gap();
-    unio_start_header();
-    return unio_send_n_bytes(cmd, 2, true);
+    return unio_run(dev_address, UNIO_OP_ENABLE_WRITE, NULL, 0, 0);
 }
 
 bool UNIO_disable_write(uint8_t dev_address)
 {
-    uint8_t cmd[2];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_WRDI;
-    unio_inter_command_gap();
-    unio_start_header();
-    return unio_send_n_bytes(cmd, 2, true);
+    return unio_run(dev_address, UNIO_OP_DISABLE_WRITE, NULL, 0, 0);
 }
 
 bool UNIO_read_status(uint8_t dev_address, uint8_t* status)
 {
-    bool a, b;
-    uint8_t cmd[2];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_RDSR;
-    unio_inter_command_gap();
-    unio_start_header();
-    a = unio_send_n_bytes(cmd, 2, false);
-    b = unio_receive_n_bytes(status, 1);
-    return a && b;
+    return unio_run(dev_address, UNIO_OP_READ_STATUS, status, 0, 1);
 }
 
 bool UNIO_write_status(uint8_t dev_address, uint8_t status)
 {
-    uint8_t cmd[3];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_WRSR;
-    cmd[2] = status;
-    unio_inter_command_gap();
-    unio_start_header();
-    return unio_send_n_bytes(cmd, 3, true);
+    return unio_run(dev_address, UNIO_OP_WRITE_STATUS, &status, 0, 1);
 }
 
 bool UNIO_erase_all(uint8_t dev_address)
 {
-    uint8_t cmd[2];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_ERAL;
-    unio_inter_command_gap();
-    unio_start_header();
-    return unio_send_n_bytes(cmd, 2, true);
+    return unio_run(dev_address, UNIO_OP_ERASE_ALL, NULL, 0, 0);
 }
 
 bool UNIO_set_all(uint8_t dev_address)
 {
-    uint8_t cmd[2];
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_SETAL;
-    unio_inter_command_gap();
-    unio_start_header();
-    return unio_send_n_bytes(cmd, 2, true);
+    return unio_run(dev_address, UNIO_OP_SET_ALL, NULL, 0, 0);
 }
 
 bool UNIO_await_write_complete(uint8_t dev_address)
 {
-    bool a, b;
-    uint8_t cmd[2];
-    uint8_t status;
-    cmd[0] = dev_address;
-    cmd[1] = UNIO_EEPROM_RDSR;
-    unio_inter_command_gap();
-
-    /* Here we issue RDSR commands back-to-back until the WIP bit in the
-       status register is cleared.  Note that this isn't absolutely the
-       most efficient way to monitor this bit; after sending the command
-       we could read as many uint8_ts as we like as long as we send MAK
-       after each uint8_t.  The unio_read() function isn't set up to do
-       this, though, and it's not really performance-critical compared
-       to the eeprom write time! We re-enable interrupts briefly between
-       each command so that any background tasks like updating millis()
-       continue to happen.*/
-    do
-    {
-        unio_inter_command_gap();
-        unio_start_header();
-        a = unio_send_n_bytes(cmd, 2, false);
-        b = unio_receive_n_bytes(&status, 1);
-    }
-    while (a && b && (status & UNIO_EEPROM_STATUS_WIP));
-
-    return true;
+    return unio_run(dev_address, UNIO_OP_AWAIT_WRITE, NULL, 0, 0);
 }
 
 bool UNIO_simple_write(uint8_t dev_address, const uint8_t* buffer, uint16_t address, uint16_t length)
 {
-    uint16_t wlen;
-    while (length > 0)
-    {
-        wlen = length;
-        if (((address & 0x0f) + wlen) > 16)
-        {
-            /* Write would cross a page boundary.  Truncate the write to the
-               page boundary. */
-            wlen = 16 - (address & 0x0f);
-        }
-        if (!UNIO_enable_write(dev_address))
-            return false;
-        if (!UNIO_start_write(dev_address, buffer, address, wlen))
-            return false;
-        if (!UNIO_await_write_complete(dev_address))
-            return false;
-        buffer += wlen;
-        address += wlen;
-        length -= wlen;
-    }
-    return true;
+    if (length == 0)
+        return true;
+    return unio_run(dev_address, UNIO_OP_WRITE, (uint8_t*)buffer, address, length);
 }
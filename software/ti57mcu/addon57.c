@@ -1,10 +1,12 @@
-#include "stm32f10x.h"
 #include "rcl57mcu.h"
+#include "hal57.h"
 #include "addon57.h"
 #include "mux57.h"
 #include "unio.h"
-#include "usart_utilities.h"
+#include "storage57.h"
+#include "tele57.h"
 #include <stdbool.h>
+#include <string.h>
 
 
 /* "add-on" functionality for rcl57mcu */
@@ -17,7 +19,7 @@
                          D12 decimal point will flash briefly to indicate PS mode
                          pressing any key will return to previous function
 
-    . program-manager -- 20 non-volatile "user program slots" are available for
+    . program-manager -- 15 non-volatile "user program slots" are available for
                          save/recall of programs. Up to 79 "fixed slots" are also
                          available to recall from (stored in flash at compile time)
 
@@ -25,134 +27,220 @@
 
 /////////////
 
-/* read and validate the "status block" from EEPROM. If the contents are
- not valid, the EEPROM is erased and initialized with a default status block.
+/* UNI/O request appending a record to the status journal */
+static unio_request_t journal_request;
+static shadow_status_t journal_record;
+static uint8_t journal_index;       // record holding the current status block
+
+/* CRC-16/CCITT of a status block record, up to its CRC */
+static uint16_t crc16(const uint8_t* data, int count)
+{
+    uint16_t crc = 0xFFFF;
+
+    while (count-- > 0)
+    {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (int i = 0; i < 8; i++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+    }
+    return crc;
+}
+
+/* true if a record of the journal holds a valid status block */
+static bool is_record_valid(const uint8_t* record)
+{
+    uint16_t crc = crc16(record, EE_OFFSET_CRC);
+
+    return (record[EE_OFFSET_VALID] == EE_VALID_SENTINEL) &&
+           (record[EE_OFFSET_LAYOUT] == STORAGE57_LAYOUT_VERSION) &&
+           (record[EE_OFFSET_CRC] == (crc & 0xff)) &&
+           (record[EE_OFFSET_CRC + 1] == (crc >> 8));
+}
+
+/* mark the status block shadow as the next record of the journal */
+static void seal_record(shadow_status_t* stat)
+{
+    uint16_t crc;
+
+    (*stat)[EE_OFFSET_VALID] = EE_VALID_SENTINEL;
+    (*stat)[EE_OFFSET_LAYOUT] = STORAGE57_LAYOUT_VERSION;
+    (*stat)[EE_OFFSET_SEQUENCE] += 1;
+    crc = crc16(*stat, EE_OFFSET_CRC);
+    (*stat)[EE_OFFSET_CRC] = crc & 0xff;
+    (*stat)[EE_OFFSET_CRC + 1] = crc >> 8;
+}
+
+/* read and validate the status journal from EEPROM, and recover the
+ newest valid status block. If no record is valid, the EEPROM is erased
+ and initialized with a default status block - or, for a status block of
+ layout version 1, converted to the current layout keeping its settings.
  This function returns false if there are any issues accessing the EEPROM */
 bool addon57_validate_status_block(shadow_status_t* stat)
 {
     bool rcode;
+    uint8_t area[STORAGE57_STATUS_SIZE];
+    uint8_t* record;
+    int newest = -1;
 
     /* Make SRAM shadow does not contain 0x57 */
-    (*stat)[EE_OFFSET_VALID] = 0;
+    memset(*stat, 0, sizeof(shadow_status_t));
 
     /* Init the UNI/O driver */
     UNIO_init();
 
-    /* Retrieve status block from EEPROM and shadow in SRAM. */
-    rcode = UNIO_read(UNIO_EEPROM_ADDRESS, stat, 0, 24);
+    /* Retrieve the status journal from EEPROM */
+    rcode = UNIO_read(UNIO_EEPROM_ADDRESS, area, STORAGE57_STATUS_OFFSET, sizeof(area));
     if (rcode)
-        UU_PutString(USART1, ":R-stat OK");
+        tele57_text(":R-stat OK");
     else
     {
-        UU_PutString(USART1, ":R-stat NOK:");
-        (*stat)[EE_OFFSET_VALID] = 0;       // no valid EEPROM found
+        tele57_text(":R-stat NOK:");
         (*stat)[EE_OFFSET_BRIGHT] = 15;    // maximum brightness
         return rcode;
     }
 
-    /* Check offset 0 to see if block is valid, if not, init status block */
-    if ((*stat)[EE_OFFSET_VALID] == EE_VALID_SENTINEL)
+    /* find the valid record with the newest sequence number. A record
+       torn by a brownout fails its CRC, and the previous one is used */
+    for (int i = 0; i < EE_JOURNAL_RECORDS; i++)
     {
-        UU_PutString(USART1, ":Valid");
-        //for (int i = 0; i < 24; i++)
-        //    UU_PutHexByte(USART1, (*stat)[i]);
+        record = &area[i * sizeof(shadow_status_t)];
+        if (is_record_valid(record) && ((newest < 0) ||
+                                        ((int8_t)(record[EE_OFFSET_SEQUENCE] - area[newest * sizeof(shadow_status_t) + EE_OFFSET_SEQUENCE]) > 0)))
+            newest = i;
     }
-    else
+    if (newest >= 0)
     {
-        /* erase the EEPROM - first enable writes */
-        rcode = UNIO_enable_write(UNIO_EEPROM_ADDRESS);
-
-        /* if write enable passes, do the erase and wait for it to finish */
-        if (rcode)
-        {
-            UU_PutString(USART1, ":Erasing");
-            UNIO_erase_all(UNIO_EEPROM_ADDRESS);    // clear all locations to zero
-            UNIO_await_write_complete(UNIO_EEPROM_ADDRESS);
-            UU_PutString(USART1, ":Complete");
-        }
-        else
-            /* write enable fails, so return with error code and invalid block */
-        {
-            UU_PutString(USART1, ":Erase NOK:");
-            (*stat)[EE_OFFSET_VALID] = 0;       // no valid EEPROM found
-            (*stat)[EE_OFFSET_BRIGHT] = 15;    // maximum brightness
-            return rcode;
-        }
+        tele57_text(":Valid");
+        memcpy(*stat, &area[newest * sizeof(shadow_status_t)], sizeof(shadow_status_t));
+        journal_index = newest;
+        return rcode;
+    }
 
-        /* after successful erase, initialize the status block contents */
-        (*stat)[EE_OFFSET_VALID] = 0x57;   // mark block as initialized
-        for (int i = 0; i < 20; i++)
-            (*stat)[EE_OFFSET_STATUS_S0 + i] = STAT_SLOT_VACANT;    // mark slots 0-19 as "vacant"
+    if (area[EE_OFFSET_VALID] == EE_VALID_SENTINEL)
+    {
+        /* version 1: keep the settings, clear the rest of the status area
+           and the directory (version 1 never stored programs) */
+        tele57_text(":Upgrade");
+        (*stat)[EE_OFFSET_BRIGHT] = area[EE_V1_OFFSET_BRIGHT];
+        (*stat)[EE_OFFSET_OPTIONS] = area[EE_V1_OFFSET_OPTIONS];
+        (*stat)[EE_OFFSET_SPEED] = area[EE_V1_OFFSET_SPEED];
+
+        memset(area, STAT_SLOT_VACANT, sizeof(area));
+        for (uint16_t a = STORAGE57_STATUS_OFFSET + sizeof(shadow_status_t); (a < STORAGE57_TAIL_OFFSET) && rcode; a += sizeof(shadow_status_t))
+            rcode = UNIO_simple_write(UNIO_EEPROM_ADDRESS, area, a, sizeof(shadow_status_t));
+    }
+    else
+    {
+        /* erase the EEPROM - the UNI/O engine enables writes and waits
+           for the erase to finish */
+        tele57_text(":Erasing");
+        rcode = UNIO_erase_all(UNIO_EEPROM_ADDRESS);    // clear all locations to zero, all slots vacant
 
+        /* default settings */
         (*stat)[EE_OFFSET_BRIGHT] = 15;   // maximum brightness
-        (*stat)[EE_OFFSET_22] = 0;          // unused
-        (*stat)[EE_OFFSET_23] = 0;          // unused
-
-        /* attempt to write status block to EEPROM */
-        rcode = UNIO_simple_write(UNIO_EEPROM_ADDRESS, stat, 0, 24);
-        if (rcode)
-        {
-            UU_PutString(USART1, ":W-stat OK:");
-        }
-        /* if write fails, return with error code and invalid block */
-        else
-        {
-            UU_PutString(USART1, ":W-stat NOK:");
-            (*stat)[EE_OFFSET_VALID] = 0;       // no valid EEPROM found
-            (*stat)[EE_OFFSET_BRIGHT] = 15;    // maximum brightness
-            return rcode;
-        }
+        (*stat)[EE_OFFSET_OPTIONS] = 0;     // default options
+        (*stat)[EE_OFFSET_SPEED] = 0;       // default speed profile
     }
-    return rcode;
-}
 
-/* Function to obtain a 16-bit hash for program sequences.
-   This is used mostly to serve as a program "label".
-   see: https://en.wikipedia.org/wiki/Fletcher%27s_checksum */
+    if (rcode)
+    {
+        tele57_text(":Complete");
+    }
+    else
+        /* erase fails, so return with error code and invalid block */
+    {
+        tele57_text(":Erase NOK:");
+        (*stat)[EE_OFFSET_BRIGHT] = 15;    // maximum brightness
+        return rcode;
+    }
 
-unsigned int fletcher16(unsigned char* data, int count)
-{
-    unsigned int sum1 = 0;
-    unsigned int sum2 = 0;
-    int index;
+    /* after successful erase, initialize the status block contents as
+       the first record of the journal */
+    seal_record(stat);
+    journal_index = 0;
 
-    for (index = 0; index < count; ++index)
+    /* attempt to write status block to EEPROM */
+    rcode = UNIO_simple_write(UNIO_EEPROM_ADDRESS, *stat, STORAGE57_STATUS_OFFSET, sizeof(shadow_status_t));
+    if (rcode)
     {
-        sum1 = (sum1 + data[index]) % 255;
-        sum2 = (sum2 + sum1) % 255;
+        tele57_text(":W-stat OK:");
     }
-
-    return (sum2 << 8) | sum1;
+    /* if write fails, return with error code and invalid block */
+    else
+    {
+        tele57_text(":W-stat NOK:");
+        (*stat)[EE_OFFSET_VALID] = 0;       // no valid EEPROM found
+        (*stat)[EE_OFFSET_BRIGHT] = 15;    // maximum brightness
+    }
+    return rcode;
 }
 
-/* calculate the hash for a user program slot from EEPROM */
-/* returns false if an EEPROM error has occurred, otherwise true */
-bool addon57_calculate_user_slot_hash(unsigned char s, unsigned int* hash)
+/* append the status block shadow to the journal, as a new record in the
+   page after the current one. The write runs in the background, alongside
+   emulation and display scan; until it is done, the current record stays
+   the newest valid one. A previous record still on the bus is waited for,
+   as storage57_flush does, so that no update is lost. Returns false if the
+   status block is not valid */
+bool addon57_append_status_block(shadow_status_t* stat)
 {
-    unsigned char buff[60];
-    int i;
-    bool rcode;
+    uint8_t index = (journal_index + 1) % EE_JOURNAL_RECORDS;
+
+    if ((*stat)[EE_OFFSET_VALID] != EE_VALID_SENTINEL)
+        return false;
+
+    /* the previous record may still be on the bus: let it finish */
+    while (journal_request.status == UNIO_PENDING)
+        hal57_wait_for_interrupt();
+
+    seal_record(stat);
+    memcpy(journal_record, *stat, sizeof(shadow_status_t));
+
+    journal_request.dev_address = UNIO_EEPROM_ADDRESS;
+    journal_request.op = UNIO_OP_WRITE;
+    journal_request.address = STORAGE57_STATUS_OFFSET + index * sizeof(shadow_status_t);
+    journal_request.buffer = journal_record;
+    journal_request.length = sizeof(shadow_status_t);
+    journal_request.done = NULL;
+
+    /* the UNI/O queue is drained by the TIM3 ISR: wait for room */
+    while (UNIO_submit(&journal_request) == false)
+        hal57_wait_for_interrupt();
+    journal_index = index;
+    return true;
+}
 
-    /* trim input index to 0-19 */
-    i = (s > 19) ? 19 : i;
+/* RCL57 options from the status block, RCL57_DEFAULT_OPTIONS if never set */
+int addon57_get_options(shadow_status_t* stat)
+{
+    if (((*stat)[EE_OFFSET_VALID] != EE_VALID_SENTINEL) ||
+            (((*stat)[EE_OFFSET_OPTIONS] & EE_OPTIONS_SET) == 0))
+        return RCL57_DEFAULT_OPTIONS;
 
-    /* calculate the starting address in EEPROM of the steps for slot */
-    i = i * EE_STEPS_PER_SLOT + EE_OFFSET_STEPS_S0;
+    return (*stat)[EE_OFFSET_OPTIONS] & RCL57_OPTIONS_MASK;
+}
 
-    /* retrieve slot steps from EEPROM and shadow in buff array */
-    rcode = UNIO_read(UNIO_EEPROM_ADDRESS, buff, i, 50);
-    if (rcode)
-        UU_PutString(USART1, ":R-slot OK");
-    else
-        UU_PutString(USART1, ":R-slot NOK:");
+/* speed profile from the status block, RCL57_DEFAULT_SPEED if never set */
+sched57_speed_t addon57_get_speed(shadow_status_t* stat)
+{
+    uint8_t speed = (*stat)[EE_OFFSET_SPEED];
 
-    /* so compute hash over buffer contents and save to hash */
-    *hash = fletcher16(buff, 50);
+    if (((*stat)[EE_OFFSET_VALID] != EE_VALID_SENTINEL) ||
+            (speed == 0) || (speed > SCHED57_SPEED_UNTHROTTLED + 1))
+        return RCL57_DEFAULT_SPEED;
 
-    return rcode;
+    return (sched57_speed_t)(speed - 1);
 }
 
+/* update the RCL57 options and speed profile in the status block shadow,
+   and append it to the status journal. Returns false if the status block
+   is not valid */
+bool addon57_set_options(shadow_status_t* stat, int options, sched57_speed_t speed)
+{
+    (*stat)[EE_OFFSET_OPTIONS] = (options & RCL57_OPTIONS_MASK) | EE_OPTIONS_SET;
+    (*stat)[EE_OFFSET_SPEED] = speed + 1;
 
+    return addon57_append_status_block(stat);
+}
 
 /////////////
 
@@ -160,30 +248,53 @@ bool addon57_calculate_user_slot_hash(unsigned char s, unsigned int* hash)
 
 /* This is entered after PSAVE_ENTRY_IDLE_DISP_CYCLES instances of
    DISPlay instructions have been processed with no keyboard input.
-   This function adjusts the SYSTIC timer to a longer interval,
+   The decimal point of digit #12 is illuminated for PSAVE_BLINK_MS.
+
+   With PSAVE_STOP_MODE, all rows of the keypad are then driven and the
+   MCU enters STOP mode: the clocks are stopped until a key pulls one of
+   the K1-K5 column inputs high, which wakes the MCU through EXTI (see
+   hal57_stop_until_key).
+
+   Otherwise, the SYSTIC timer is adjusted to a longer interval,
    PSAVE_IDLE_SYSTICK_PERIOD_US, to reduce the number of MCU wakeups.
    During this idle period, all rows of the keypad are sampled each
    SYSTIC interval. If any keys are activated, the idle interval is
-   terminated immediately. After PSAVE_IDLE_MS has elapsed, or a key
-   was detected, the SYSTIC timer interval is adjusted back to the
-   normal interval, and the decimal point of digit #12 is illuminated
-   for PSAVE_BLINK_MS. If no key was detected during the idle period,
-   the idle-blink intervals repeat. If a key was detected, a brief
-   "debounce" is executed to be sure that all keys are released, then
-   control is returned back to the calling program. */
+   terminated immediately. After PSAVE_IDLE_MS has elapsed, the SYSTIC
+   timer interval is adjusted back to the normal interval, and the
+   decimal point blinks again. If no key was detected during the idle
+   period, the idle-blink intervals repeat.
+
+   Once a key was detected, a brief "debounce" is executed to be sure
+   that all keys are released, then control is returned back to the
+   calling program. */
 void addon57_powersave(void)
 {
     unsigned char scancode = 0;
-    int count;
 
     /* make sure TLC5929 is in PowerSave mode by setting all outputs off */
     hw_digit_driver_load(0);
     hw_digit_driver_update();
 
+#if PSAVE_STOP_MODE
+    /* blink the decimal point at digit 12 on entry to powersave mode */
+    for (int u = PSAVE_BLINK_TICKS; (u > 0) && (scancode == 0); u--)
+    {
+        scancode = hw_display_char_d12(CHAR_CODE_POINT);
+    }
+
+    /* turn OFF the D12 direct output */
+    DIRECT_D12_OFF;
+
+    /* enable all segment drivers to drive all keyboard rows, and stop
+       the MCU until a key is pressed */
+    hw_segment_enable_all();
+    if (scancode == 0)
+        hal57_stop_until_key();
+#else
     while (scancode == 0)
     {
         /* set SysTick back to normal (short) interval during display time */
-        SysTick_Config(SystemCoreClock / SYSTICK_TIMER_FREQ);
+        hal57_systick_config(SYSTICK_PERIOD_US);
 
         /* blink the decimal point at digit 12 while in powersave mode */
         for (int u = PSAVE_BLINK_TICKS; u > 0; u--)
@@ -192,7 +303,7 @@ void addon57_powersave(void)
         }
 
         /* set SysTick to a much slower interval to conserve battery power */
-        SysTick_Config(SystemCoreClock / PSAVE_IDLE_SYSTICK_TIMER_FREQ);
+        hal57_systick_config(PSAVE_IDLE_SYSTICK_PERIOD_US);
 
         /* turn OFF the D12 direct output */
         DIRECT_D12_OFF;
@@ -203,7 +314,7 @@ void addon57_powersave(void)
         /* delay in standby mode between blinks - read all keys between timeouts */
         for (long u = PSAVE_IDLE_TICKS; u > 0; u--)
         {
-            __WFI();
+            hal57_wait_for_interrupt();
             DEBUG_TICK_ON;
             DEBUG_TICK_OFF;
             if (scancode != 0)
@@ -211,9 +322,10 @@ void addon57_powersave(void)
             scancode = hw_read_keyboard_row(0);
         }
     }
+#endif
 
     /* set SysTick back to normal interval during display time */
-    SysTick_Config(SystemCoreClock / SYSTICK_TIMER_FREQ);
+    hal57_systick_config(SYSTICK_PERIOD_US);
 
     /* turn OFF the D12 direct output */
     DIRECT_D12_OFF;
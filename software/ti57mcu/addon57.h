@@ -2,26 +2,55 @@
 #define addon57_h
 
 #include "rcl57mcu.h"
+#include "sched57.h"
+#include "storage57.h"
 #include <stdbool.h>
 
-typedef unsigned char shadow_status_t[24];
+/* status block, one page of the EEPROM. The status area (see storage57.h)
+   is a journal of EE_JOURNAL_RECORDS status blocks, written in rotation:
+   an update is appended to the page after the newest record, with the
+   next sequence number and a CRC, so that it never overwrites the last
+   good record */
+typedef unsigned char shadow_status_t[16];
 
-#define STAT_SLOT_VACANT (0)
-#define STAT_SLOT_OCCUPIED (1)
-#define STAT_SLOT_LOCKED (128+1)
+#define EE_JOURNAL_RECORDS ((int)(STORAGE57_STATUS_SIZE / sizeof(shadow_status_t)))
 
 #define EE_VALID_SENTINEL (0x57)
 #define EE_OFFSET_VALID (0)
-#define EE_OFFSET_STATUS_S0 (1)
-#define EE_OFFSET_BRIGHT (21)
-#define EE_OFFSET_22 (22)
-#define EE_OFFSET_23 (23)
-#define EE_OFFSET_STEPS_S0 (24)
-#define EE_STEPS_PER_SLOT (50)
-
-/** validate EEPROM status block */
+#define EE_OFFSET_LAYOUT (1)
+#define EE_OFFSET_BRIGHT (2)
+#define EE_OFFSET_OPTIONS (3)
+#define EE_OFFSET_SPEED (4)
+#define EE_OFFSET_SEQUENCE (13)     // incremented by every record, modulo 256
+#define EE_OFFSET_CRC (14)          // CRC-16/CCITT of bytes 0-13, lsb first
+
+/* status block of layout version 1, which has no layout byte (offset 1
+   held the status of slot 1, never 2) */
+#define EE_V1_BLOCK_SIZE (24)
+#define EE_V1_OFFSET_BRIGHT (21)
+#define EE_V1_OFFSET_OPTIONS (22)
+#define EE_V1_OFFSET_SPEED (23)
+
+/* status blocks written before the options existed hold 0 in the options
+   and speed bytes: the options byte is only valid with EE_OPTIONS_SET,
+   and the speed byte holds the speed profile + 1 */
+#define EE_OPTIONS_SET (0x80)
+
+/** validate EEPROM status journal, and recover the newest status block */
 bool addon57_validate_status_block(shadow_status_t* stat);
 
+/** append the status block to the EEPROM status journal */
+bool addon57_append_status_block(shadow_status_t* stat);
+
+/** RCL57 options from the status block, RCL57_DEFAULT_OPTIONS if never set */
+int addon57_get_options(shadow_status_t* stat);
+
+/** speed profile from the status block, RCL57_DEFAULT_SPEED if never set */
+sched57_speed_t addon57_get_speed(shadow_status_t* stat);
+
+/** update the RCL57 options and speed profile in the status block, and append it to the journal */
+bool addon57_set_options(shadow_status_t* stat, int options, sched57_speed_t speed);
+
 /** populate EEPROM hash block */
 //bool addon57_populate_hash_block(shadow_status_t* stat, hash_block_t* hash);
 
@@ -39,6 +68,12 @@ void addon57_powersave(void);
  250ms BLINK period (flash the digit 12 DP)
 */
 
+/* sleep in STOP mode until a key is pressed (1), or poll the keyboard
+   on a slow SysTick, blinking the digit 12 DP every IDLE period (0) */
+#ifndef PSAVE_STOP_MODE
+#define PSAVE_STOP_MODE (1)
+#endif
+
 #define PSAVE_ENTRY_IDLE_DISP_CYCLES (94000)
 #define PSAVE_IDLE_SYSTICK_PERIOD_US (10000)
 #define PSAVE_IDLE_SYSTICK_TIMER_FREQ (1000000 / PSAVE_IDLE_SYSTICK_PERIOD_US)
@@ -0,0 +1,375 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#include <string.h>
+#include "cmd57.h"
+#include "rcl57mcu.h"
+#include "hal57.h"
+#include "sched57.h"
+#include "state57.h"
+#include "storage57.h"
+#include "tele57.h"
+#include "prof57.h"
+
+/* Command interface over USART1 */
+/* https://hackaday.io/project/194963 */
+
+/* Private data - shared between USART1 ISR and foreground */
+
+static volatile uint8_t rx_buffer[CMD57_RX_BUFFER_SIZE];
+static volatile uint8_t rx_head = 0;        // next byte written (ISR)
+static volatile uint8_t rx_tail = 0;        // next byte read (foreground)
+static volatile bool is_rx_overflow = false;    // bytes lost since the last line
+static volatile bool is_connected = false;      // a byte was received
+
+/* Private data - only used by the foreground */
+
+static char line[CMD57_LINE_SIZE + 1];
+static uint8_t line_length = 0;
+static bool is_line_too_long = false;
+static bool is_clock_pinned = false;
+
+static kbd57_event_t key_queue[CMD57_KEY_QUEUE_SIZE];   // 'time' is when it is due
+static uint8_t key_head = 0;
+static uint8_t key_tail = 0;
+
+/* dump or list being sent: record type (0 if none), next offset and end */
+static uint8_t block_type = 0;
+static uint8_t block_offset;
+static uint8_t block_end;
+static uint8_t block_bytes[STORAGE57_SNAPSHOT_SIZE];
+
+static uint8_t staged_state[STORAGE57_SNAPSHOT_SIZE];
+
+static uint32_t disps = 0;
+static bool is_profiling = false;
+static uint32_t prof_cycles;
+static uint32_t prof_disps;
+static uint32_t prof_time;
+
+/* enable USART1 reception and its interrupt */
+void cmd57_init(void)
+{
+    hal57_usart_rx_start();
+}
+
+/* queue the bytes received, or flag them as lost if the buffer is full */
+void USART1_IRQHandler(void)
+{
+    uint8_t byte;
+
+    while (hal57_usart_receive(&byte))
+    {
+        if ((uint8_t)(rx_head + 1) == rx_tail)
+            is_rx_overflow = true;
+        else
+        {
+            rx_buffer[rx_head] = byte;
+            rx_head = rx_head + 1;
+        }
+        is_connected = true;
+    }
+}
+
+/* take the oldest injected key event, once it is due */
+bool cmd57_get_event(kbd57_event_t* event)
+{
+    if (key_tail == key_head)
+        return false;
+    if ((int32_t)(tele57_get_time() * (1000 / SYSTICK_PERIOD_US) - key_queue[key_tail].time) < 0)
+        return false;
+    *event = key_queue[key_tail];
+    key_tail = (key_tail + 1) & (CMD57_KEY_QUEUE_SIZE - 1);
+    return true;
+}
+
+/* queue an injected key event, due 'delay_ms' from now. Returns false
+   if the queue is full */
+static bool put_key(uint8_t scancode, bool is_press, uint32_t delay_ms)
+{
+    uint8_t next = (key_head + 1) & (CMD57_KEY_QUEUE_SIZE - 1);
+
+    if (next == key_tail)
+        return false;
+    key_queue[key_head].scancode = scancode;
+    key_queue[key_head].is_press = is_press;
+    /* SysTick periods since kbd57_init, as the keypad events, to the ms */
+    key_queue[key_head].time = (tele57_get_time() + delay_ms) * (1000 / SYSTICK_PERIOD_US);
+    key_head = next;
+    return true;
+}
+
+/* if s starts with the word w, return what follows it (past one space),
+   otherwise NULL */
+static const char* match(const char* s, const char* w)
+{
+    size_t n = strlen(w);
+
+    if (strncmp(s, w, n) != 0)
+        return NULL;
+    if (s[n] == 0)
+        return &s[n];
+    if (s[n] == ' ')
+        return &s[n + 1];
+    return NULL;
+}
+
+static int8_t hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+/* parse two hex digits at *s, skipping the spaces before them */
+static bool parse_hex(const char** s, uint8_t* byte)
+{
+    int8_t high, low;
+
+    while (**s == ' ')
+        *s += 1;
+    high = hex_digit((*s)[0]);
+    if (high < 0)
+        return false;
+    low = hex_digit((*s)[1]);
+    if (low < 0)
+        return false;
+    *byte = (uint8_t)((high << 4) | low);
+    *s += 2;
+    return true;
+}
+
+/* parse the hex bytes at s into bytes[0..max-1]. Returns their count,
+   or -1 if s is not made of whole bytes or holds more than max */
+static int16_t parse_bytes(const char* s, uint8_t* bytes, uint16_t max)
+{
+    uint16_t n = 0;
+
+    for (;;)
+    {
+        while (*s == ' ')
+            s++;
+        if (*s == 0)
+            return n;
+        if (n == max || !parse_hex(&s, &bytes[n]))
+            return -1;
+        n++;
+    }
+}
+
+/* parse a scancode: row 1-8, column 1-5 */
+static bool parse_scancode(const char* s, uint8_t* scancode)
+{
+    if (!parse_hex(&s, scancode) || *s != 0)
+        return false;
+    return (*scancode >> 4) >= 1 && (*scancode >> 4) <= 8 &&
+           (*scancode & 0x0F) >= 1 && (*scancode & 0x0F) <= 5;
+}
+
+/* start sending a dump or a list, one record per call of send_blocks */
+static void start_blocks(uint8_t type, uint8_t end)
+{
+    block_type = type;
+    block_offset = 0;
+    block_end = end;
+}
+
+/* send the blocks of the dump, list or profile that fit in the telemetry
+   buffer, then the "ok". The blocks of a profile are its sections */
+static void send_blocks(void)
+{
+    uint8_t size = (block_type == TELE57_STATE) ? CMD57_DUMP_BLOCK : CMD57_LIST_BLOCK;
+    uint8_t n;
+    prof57_stats_t stats;
+
+    while (block_offset < block_end)
+    {
+        if (block_type == TELE57_SECTION)
+        {
+            if (tele57_has_room(1 + 4 * sizeof(uint32_t)) == false)
+                return;
+            prof57_get_stats((prof57_section_t)block_offset, &stats);
+            tele57_section(block_offset, stats.frames, stats.min, stats.max, stats.total);
+            block_offset += 1;
+            continue;
+        }
+        n = block_end - block_offset;
+        if (n > size)
+            n = size;
+        if (tele57_has_room(1 + n) == false)
+            return;
+        tele57_block(block_type, block_offset, &block_bytes[block_offset], n);
+        block_offset += n;
+    }
+    block_type = 0;
+    tele57_text("ok");
+}
+
+/* execute the line. Returns false if it is not a command or fails */
+static bool execute(rcl57_t* rcl57, uint32_t cycles)
+{
+    ti57_t* ti57 = &rcl57->ti57;
+    const char* args;
+    uint8_t scancode;
+    uint8_t bytes[CMD57_LINE_SIZE / 2];
+    int16_t n;
+    uint8_t first;
+
+    if (strcmp(line, "ping") == 0)
+        return true;
+
+    if ((args = match(line, "key")) != NULL)
+        return parse_scancode(args, &scancode) && put_key(scancode, true, 0) &&
+               put_key(scancode, false, CMD57_KEY_HOLD_MS);
+    if ((args = match(line, "press")) != NULL)
+        return parse_scancode(args, &scancode) && put_key(scancode, true, 0);
+    if ((args = match(line, "release")) != NULL)
+        return parse_scancode(args, &scancode) && put_key(scancode, false, 0);
+
+    if (strcmp(line, "dump") == 0)
+    {
+        storage57_pack_state(block_bytes, ti57);
+        start_blocks(TELE57_STATE, STORAGE57_SNAPSHOT_SIZE);
+        return true;
+    }
+    if ((args = match(line, "load")) != NULL)
+    {
+        if (!parse_hex(&args, &first))
+            return false;
+        n = parse_bytes(args, bytes, sizeof(bytes));
+        if (n <= 0 || first + n > STORAGE57_SNAPSHOT_SIZE)
+            return false;
+        memcpy(&staged_state[first], bytes, n);
+        return true;
+    }
+    if (strcmp(line, "apply") == 0)
+        return storage57_unpack_state(ti57, staged_state);
+
+    if (strcmp(line, "list") == 0)
+    {
+        ti57_get_program_opcodes(ti57, block_bytes);
+        start_blocks(TELE57_PROGRAM, STORAGE57_STEPS);
+        return true;
+    }
+    if ((args = match(line, "prog")) != NULL)
+    {
+        first = 0;
+        if (*args < '0' || *args > '9')
+            return false;
+        while (*args >= '0' && *args <= '9' && first < STORAGE57_STEPS)
+            first = first * 10 + (*args++ - '0');
+        if (*args != ' ')
+            return false;
+        n = parse_bytes(args, bytes, sizeof(bytes));
+        if (n <= 0 || first + n > STORAGE57_STEPS)
+            return false;
+        for (uint8_t i = 0; i < n; i++)
+            ti57_set_program_opcode(ti57, first + i, bytes[i]);
+        return true;
+    }
+
+    if (strcmp(line, "prof start") == 0)
+    {
+        is_profiling = true;
+        prof_cycles = cycles;
+        prof_disps = disps;
+        prof_time = tele57_get_time();
+        prof57_start();
+        return true;
+    }
+    if (strcmp(line, "prof stop") == 0)
+    {
+        if (is_profiling == false)
+            return false;
+        is_profiling = false;
+        prof57_stop();
+        tele57_profile(cycles - prof_cycles, disps - prof_disps, tele57_get_time() - prof_time);
+        start_blocks(TELE57_SECTION, PROF57_SECTION_COUNT);
+        return true;
+    }
+
+    return false;
+}
+
+/* execute the command lines received */
+void cmd57_poll(rcl57_t* rcl57, uint32_t cycles)
+{
+    char c;
+
+    disps += 1;
+
+    /* hold the clock from the first byte on, see cmd57.h */
+    if (is_connected && !is_clock_pinned)
+    {
+        sched57_pin_clock(HAL57_CLOCK_64MHZ);
+        is_clock_pinned = true;
+    }
+
+    /* the next line waits for the dump or list to be sent */
+    if (block_type != 0)
+        send_blocks();
+
+    while (block_type == 0 && rx_tail != rx_head)
+    {
+        c = (char)rx_buffer[rx_tail];
+        rx_tail = rx_tail + 1;
+
+        if (c != '\r' && c != '\n')
+        {
+            if (line_length < CMD57_LINE_SIZE)
+                line[line_length++] = c;
+            else
+                is_line_too_long = true;
+            continue;
+        }
+
+        /* end of line: execute it, unless it lost bytes */
+        line[line_length] = 0;
+        if (is_rx_overflow || is_line_too_long)
+        {
+            is_rx_overflow = false;
+            tele57_text("? overflow");
+        }
+        else if (line_length > 0)
+        {
+            if (execute(rcl57, cycles) == false)
+            {
+                /* "? " and as much of the line as fits in the record */
+                char reply[TELE57_MAX_PAYLOAD + 1] = "? ";
+                uint8_t n = (line_length < TELE57_MAX_PAYLOAD - 2) ? line_length : TELE57_MAX_PAYLOAD - 2;
+                memcpy(&reply[2], line, n);
+                reply[2 + n] = 0;
+                tele57_text(reply);
+            }
+            else if (block_type != 0)
+                send_blocks();
+            else
+                tele57_text("ok");
+        }
+        line_length = 0;
+        is_line_too_long = false;
+    }
+}
@@ -0,0 +1,107 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#ifndef cmd57_h
+#define cmd57_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "kbd57.h"
+#include "rcl57.h"
+
+
+/* Command interface over USART1 */
+
+/* A host drives the calculator with ASCII command lines sent to USART1
+   RXD, at the rate of the telemetry (230400 bps 8N1). On the PCB, RXD is
+   PB7 of the debug header, so the debug pin is given up when the
+   interface is built in (RCL57_USART_COMMANDS in rcl57mcu.h).
+
+   The USART1 ISR only queues the bytes received. Lines are assembled
+   and executed by cmd57_poll() from the main loop, at DISP, where the
+   TI-57 state is consistent. Replies and dumps are telemetry records
+   (tele57.h): a TELE57_TEXT "ok" when a command is done, "? " followed
+   by the line when it is not understood or fails.
+
+   COMMAND              ACTION
+   -------              ------
+   ping                 nothing (the reply tells that the link is up)
+   key RC               press key RC (hex scancode, 72 = '1'), and release
+                        it CMD57_KEY_HOLD_MS later
+   press RC             press key RC, until released
+   release RC           release key RC
+   dump                 send the state as TELE57_STATE records of
+                        CMD57_DUMP_BLOCK bytes, in the layout of
+                        storage57_pack_state
+   load OO HH..         stage state bytes HH.. at offset OO (hex)
+   apply                load the staged state into the TI-57
+   list                 send the 50 program steps as TELE57_PROGRAM records
+   prog SS HH..         set the program steps from step SS (decimal)
+   prof start           start counting TMC1500 cycles and DISPs, and
+                        profiling the firmware sections (prof57.h)
+   prof stop            send the counts since prof start as a
+                        TELE57_PROFILE record, then the cycles of the
+                        sections as TELE57_SECTION records
+
+   Injected keys are queued as keyboard events (cmd57_get_event) and
+   taken by the main loop as the keys of the keypad are.
+
+   The first byte received pins the core clock (sched57_pin_clock): a
+   clock switch masks the interrupts for up to 200us, during which the
+   bytes that arrive would be lost. The first line may still be lost to
+   that switch, so a host starts with "ping" until it gets its "ok", and
+   waits for the reply to a line before sending the next one. */
+
+/* receive buffer size: 256, so that its 8 bit indices wrap around by themselves */
+#define CMD57_RX_BUFFER_SIZE (256)
+
+/* longest command line, without its end of line */
+#define CMD57_LINE_SIZE (80)
+
+/* injected key event queue size - a power of 2 */
+#define CMD57_KEY_QUEUE_SIZE (4)
+
+/* hold time of the keys of the "key" command: the TI-57 ROM debounces
+   the keys over several display cycles */
+#define CMD57_KEY_HOLD_MS (100)
+
+/* state bytes per TELE57_STATE record */
+#define CMD57_DUMP_BLOCK (32)
+
+/* program steps per TELE57_PROGRAM record */
+#define CMD57_LIST_BLOCK (25)
+
+/* enable USART1 reception and its interrupt */
+void cmd57_init(void);
+
+/* USART1 interrupt handler: queue the bytes received */
+void USART1_IRQHandler(void);
+
+/* execute the command lines received - call at DISP. 'cycles' is the
+   running count of TMC1500 cycles, for profiling */
+void cmd57_poll(rcl57_t* rcl57, uint32_t cycles);
+
+/* take the oldest injected key event, once it is due. Returns false if
+   there is none */
+bool cmd57_get_event(kbd57_event_t* event);
+
+#endif /* cmd57_h */
@@ -0,0 +1,156 @@
+#ifndef hal57_h
+#define hal57_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Hardware abstraction for the RCL-57 retrofit PCB V2
+ *
+ * These are the only functions through which the firmware touches the
+ * MCU peripherals: GPIOA/GPIOB, SPI1, ADC1 and USART1 with their DMA channels,
+ * TIM3, SysTick, EXTI, the clock tree, the STOP mode and the DWT cycle
+ * counter. They are
+ * deliberately thin - one pin, one transfer or one timer operation each -
+ * so that all the display, keyboard and UNI/O logic stays in mux57.c,
+ * scan57.c and UNIO.c.
+ *
+ * hal57_stm32.c implements them for the STM32F103 on the PCB. The board
+ * simulator in ../ti57sim implements them against models of the TLC5929,
+ * the segment PMOS drivers, the keypad and the 11AA080 EEPROM, so the
+ * unchanged firmware can be run as a Linux process.
+ *
+ * PCB V2 pin assignment:
+ *   PA0-PA4   K1-K5 keypad column inputs (ADC1 CH0-CH4)
+ *   PA5-PA12  segment PMOS gates D,A,B,C,E,F,G,P (low = segment driven)
+ *   PA15      TLC5929 LATCH
+ *   PB0       11AA080 UNI/O (open drain, 47K pullup)
+ *   PB3,PB5   TLC5929 SCLK, SDATA (SPI1 remapped)
+ *   PB4       digit 12 'direct drive' cathode (open drain)
+ *   PB6       USART1 TXD
+ *   PB7       debug pin, or USART1 RXD once hal57_usart_rx_start is called
+ */
+
+/* When built for the simulator, the simulator owns main() and calls the
+   firmware main() through this name */
+#ifdef HAL57_SIM
+    #define main hal57_firmware_main
+#endif
+
+/** core clock frequencies, from the slowest */
+typedef enum
+{
+    HAL57_CLOCK_8MHZ,       // HSI, PLL off
+    HAL57_CLOCK_24MHZ,      // HSI/2 x 6, as set up by hal57_init
+    HAL57_CLOCK_64MHZ       // HSI/2 x 16, the fastest without a crystal
+} hal57_clock_t;
+
+/** set up the clock tree (24 MHz) and all the peripherals used by the board */
+void hal57_init(void);
+
+/** switch the core clock, and retime SysTick, TIM3, SPI1 and USART1 so
+    that they keep their periods and rates. The ADC1 samples are shortened
+    at 8 MHz so that a key scan still completes within a SysTick period
+    (32.5us, against 22.5us at 24 MHz and 25.3us at 64 MHz). Interrupts are masked for
+    the switch (up to 200us for the PLL to lock), and the display word, key
+    scan and USART byte in flight are let through first. Returns false,
+    leaving the clock unchanged, while TIM3 times a UNI/O transfer or the
+    DMA feeds USART1 */
+bool hal57_set_clock(hal57_clock_t clock);
+
+/** start SysTick interrupts every period_us microseconds */
+void hal57_systick_config(uint32_t period_us);
+
+/** sleep until the next interrupt */
+void hal57_wait_for_interrupt(void);
+
+/** start (true) or stop (false) the cycle counter, which is not reset.
+    While started it also counts in WFI sleep (at some power cost) */
+void hal57_cycle_counter(bool on);
+
+/** read the cycle counter (core clock cycles) */
+uint32_t hal57_cycle_count(void);
+
+/** drive the debug pin (PB7 on PCB, PC14 on Blue Pill) */
+void hal57_debug_pin(bool on);
+
+/** sink (true) or float (false) the digit 12 'direct drive' cathode */
+void hal57_direct_d12(bool on);
+
+/** turn off all segment driver PMOS Q's */
+void hal57_segment_disable_all(void);
+
+/** turn on all segment driver PMOS Q's */
+void hal57_segment_enable_all(void);
+
+/** turn on segment driver PMOS Q for segment s (0-7, TMC1500 numbering) */
+void hal57_segment_enable(uint8_t s);
+
+/** shift a byte, msb first, into the TLC5929 shift register */
+void hal57_digit_driver_shift(uint8_t b);
+
+/** start shifting n bytes, msb first, into the TLC5929 shift register
+    by DMA (SPI1 TX on DMA1 channel 3) and return at once. The bytes must
+    stay unchanged until the transfer is done */
+void hal57_digit_driver_stream(const uint8_t* bytes, uint8_t n);
+
+/** true while streamed bytes are still being shifted */
+bool hal57_digit_driver_busy(void);
+
+/** pulse the TLC5929 LATCH line, once streamed bytes are shifted */
+void hal57_digit_driver_latch(void);
+
+/** convert the K1-K5 key column inputs into k[0..4] (12 bits each).
+    Returns false if the conversion did not complete */
+bool hal57_keyboard_adc(uint16_t k[5]);
+
+/** start converting the K1-K5 key column inputs into k[0..4] (ADC1 scan
+    mode, DMA1 channel 1) and return at once. The conversion takes 23us */
+void hal57_keyboard_adc_start(volatile uint16_t k[5]);
+
+/** true once the conversion started by hal57_keyboard_adc_start is done */
+bool hal57_keyboard_adc_done(void);
+
+/** digital read of the K1-K5 key column inputs, K1 in bit 0 */
+uint8_t hal57_keyboard_inputs(void);
+
+/** start sending n bytes on USART1 TXD by DMA (DMA1 channel 4) and
+    return at once. The bytes must stay unchanged until the transfer is done */
+void hal57_usart_stream(const uint8_t* bytes, uint16_t n);
+
+/** true while streamed bytes are still being fed to USART1 */
+bool hal57_usart_busy(void);
+
+/** enable USART1 reception on PB7 (which stops being the debug pin on
+    the PCB) and its RXNE interrupt (USART1_IRQHandler, preempting
+    SysTick but not TIM3) */
+void hal57_usart_rx_start(void);
+
+/** from USART1_IRQHandler: take the byte received, if any */
+bool hal57_usart_receive(uint8_t* byte);
+
+/** release (true) or pull low (false) the UNI/O bus */
+void hal57_unio_set(bool high);
+
+/** read the UNI/O bus level */
+bool hal57_unio_get(void);
+
+/** start TIM3 counting at 1us/tick, and raise its compare interrupt
+    (TIM3_IRQHandler, preempting SysTick) us microseconds from now */
+void hal57_timer_alarm_start(uint16_t us);
+
+/** from TIM3_IRQHandler: acknowledge the compare interrupt and raise the
+    next one us microseconds after the one being handled, so that the
+    interrupt latency does not add up */
+void hal57_timer_alarm_next(uint16_t us);
+
+/** stop TIM3 and acknowledge its compare interrupt */
+void hal57_timer_alarm_stop(void);
+
+/** enter STOP mode until a key pulls one of the K1-K5 column inputs
+    high (EXTI0-4 rising edge), so the rows to watch must be driven.
+    SysTick is held meanwhile, and the clock set by hal57_set_clock is
+    restored on wake up. Returns at once if a column input is high already */
+void hal57_stop_until_key(void);
+
+#endif /* hal57_h */
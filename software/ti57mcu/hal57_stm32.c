@@ -0,0 +1,840 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#include "stm32f10x.h"
+#include "rcl57mcu.h"
+#include "hal57.h"
+
+/* Hardware abstraction for RCL-57 retrofit PCB V2 on STM32F103TBU6 */
+/* https://hackaday.io/project/194963 */
+
+/* STM32F103 peripheral initialization prototypes */
+static void InitGPIO();
+static void InitUSART();
+static void InitTIM3();
+static void InitSPI();
+static void InitSPIDMA();
+static void InitUSARTDMA();
+static void InitADC();
+
+#define ADC_EOC_TIMEOUT (1000U)
+#define USART_BAUD_RATE (230400U)
+
+/* core clock set by hal57_set_clock, restored after STOP mode */
+static hal57_clock_t core_clock;
+
+/* SysTick period, kept by hal57_set_clock */
+static uint32_t systick_period_us;
+
+/* PB7 is USART1 RXD instead of the debug pin */
+static bool is_rx_on = false;
+
+/////////////
+
+/* this function sets SYSCLK = HCLK = APB2 = 8 MHz (HSI, PLL off), 24 MHz
+   (HSI/2 * 6) or 64 MHz (HSI/2 * 16), APB1 = HCLK up to 36 MHz and HCLK/2
+   above, and the ADC clock at 14 MHz at most. Flash access is 0WS up to
+   24 MHz and 2WS above, with the CPU prefetch buffer enabled. The clock
+   tree runs from HSI while the PLL is reconfigured */
+static void SystemCoreClockConfigure(hal57_clock_t clock)
+{
+
+    RCC->CR |= ((uint32_t)RCC_CR_HSION);                     // Enable HSI
+    while ((RCC->CR & RCC_CR_HSIRDY) == 0);                  // Wait for HSI Ready
+
+    RCC->CFGR = (RCC->CFGR & ~RCC_CFGR_SW) | RCC_CFGR_SW_HSI;    // HSI is system clock
+    while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_HSI);  // Wait for HSI used as system clock
+
+    RCC->CR &= ~RCC_CR_PLLON;                                // Disable PLL
+
+    FLASH->ACR  = FLASH_ACR_PRFTBE;                          // Enable Prefetch Buffer
+    if (clock == HAL57_CLOCK_64MHZ)
+        FLASH->ACR |= FLASH_ACR_LATENCY_2;                   // Flash 2 wait states
+    else
+        FLASH->ACR |= FLASH_ACR_LATENCY_0;                   // Flash 0 wait state
+
+    RCC->CFGR &= ~(RCC_CFGR_HPRE | RCC_CFGR_PPRE1 | RCC_CFGR_PPRE2 | RCC_CFGR_ADCPRE);
+    RCC->CFGR |= RCC_CFGR_HPRE_DIV1;                         // HCLK = SYSCLK
+    RCC->CFGR |= RCC_CFGR_PPRE2_DIV1;                        // APB2 = HCLK
+    if (clock == HAL57_CLOCK_64MHZ)
+    {
+        RCC->CFGR |= RCC_CFGR_PPRE1_DIV2;                    // APB1 = HCLK/2
+        RCC->CFGR |= RCC_CFGR_ADCPRE_DIV6;                   // ADC = 10.7 MHz
+    }
+    else
+    {
+        RCC->CFGR |= RCC_CFGR_PPRE1_DIV1;                    // APB1 = HCLK
+        RCC->CFGR |= RCC_CFGR_ADCPRE_DIV2;                   // ADC = 4 or 12 MHz
+    }
+
+    if (clock == HAL57_CLOCK_8MHZ)
+        return;
+
+    //  PLL configuration:  = HSI/2 * 6 = 24 MHz or HSI/2 * 16 = 64 MHz
+    RCC->CFGR &= ~(RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL);
+    if (clock == HAL57_CLOCK_64MHZ)
+        RCC->CFGR |= (RCC_CFGR_PLLSRC_HSI_Div2 | RCC_CFGR_PLLMULL16);
+    else
+        RCC->CFGR |= (RCC_CFGR_PLLSRC_HSI_Div2 | RCC_CFGR_PLLMULL6);
+
+    RCC->CR |= RCC_CR_PLLON;                                 // Enable PLL
+    while ((RCC->CR & RCC_CR_PLLRDY) == 0)
+        __NOP();           // Wait till PLL is ready
+
+    RCC->CFGR &= ~RCC_CFGR_SW;                               // Select PLL as system clock source
+    RCC->CFGR |=  RCC_CFGR_SW_PLL;
+    while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL);  // Wait till PLL is system clock src
+}
+
+/* set up clock tree and all the peripherals used by the board */
+void hal57_init(void)
+{
+    /* initialize MCU clock tree to 24 MHz, 0WS, prefetch on */
+    SystemCoreClockConfigure(HAL57_CLOCK_24MHZ);
+    SystemCoreClockUpdate();
+    core_clock = HAL57_CLOCK_24MHZ;
+
+    /* initialize MCU peripherals: GPIO, USART (and DMA), TIM3, SPI (and DMA), ADC */
+    InitGPIO();
+    InitUSART();
+    InitUSARTDMA();
+    InitTIM3();
+    InitSPI();
+    InitSPIDMA();
+    InitADC();
+}
+
+/* switch the core clock, and retime the peripherals to it */
+bool hal57_set_clock(hal57_clock_t clock)
+{
+    uint32_t mhz;
+
+    /* TIM3 only runs during a UNI/O transfer, whose bit timing it keeps,
+       and a USART1 stream would be sent at two baud rates */
+    if ((TIM3->CR1 & TIM_CR1_CEN) || hal57_usart_busy())
+        return false;
+
+    __disable_irq();
+
+    /* let the display word, the key scan and the USART byte in flight complete */
+    while (hal57_digit_driver_busy());
+    while ((DMA1_Channel1->CCR & DMA_CCR1_EN) && (DMA1_Channel1->CNDTR != 0));
+    while ((USART1->SR & USART_SR_TC) == 0);
+
+    SystemCoreClockConfigure(clock);
+    SystemCoreClockUpdate();
+    core_clock = clock;
+    mhz = SystemCoreClock / 1000000;
+
+    /* same SysTick period, restarted */
+    SysTick->LOAD = mhz * systick_period_us - 1;
+    SysTick->VAL = 0;
+
+    /* TIM3 is clocked at HCLK (APB1 x2 when divided): 1us/tick, loaded now */
+    TIM3->PSC = mhz - 1;
+    TIM3->EGR = TIM_EGR_UG;
+    TIM3->SR = 0;
+
+    /* SPI1 at 4, 3 or 4 MHz */
+    SPI1->CR1 &= ~SPI_CR1_SPE;
+    SPI1->CR1 &= ~SPI_CR1_BR;
+    if (clock == HAL57_CLOCK_64MHZ)
+        SPI1->CR1 |= SPI_BaudRatePrescaler_16;
+    else if (clock == HAL57_CLOCK_24MHZ)
+        SPI1->CR1 |= SPI_BaudRatePrescaler_8;
+    else
+        SPI1->CR1 |= SPI_BaudRatePrescaler_2;
+    SPI1->CR1 |= SPI_CR1_SPE;
+
+    /* USART1 is clocked at APB2 = HCLK */
+    USART1->BRR = (SystemCoreClock + USART_BAUD_RATE / 2) / USART_BAUD_RATE;
+
+    /* ADC1 CH0-CH4 sample time: the ADC clock is only 4 MHz at 8 MHz, where
+       41.5 cycles would make the scan 67.5us, longer than the SysTick period
+       scan57 gives it. 13.5 cycles sample as long as 41.5 cycles at 12 MHz */
+    ADC1->SMPR2 &= ~(ADC_SMPR2_SMP0 | ADC_SMPR2_SMP1 | ADC_SMPR2_SMP2 |
+                     ADC_SMPR2_SMP3 | ADC_SMPR2_SMP4);
+    if (clock == HAL57_CLOCK_8MHZ)
+        ADC1->SMPR2 |= ADC_SampleTime_13Cycles5 * 0x1249;   // in each 3-bit field of CH0-CH4
+    else
+        ADC1->SMPR2 |= ADC_SampleTime_41Cycles5 * 0x1249;
+
+    __enable_irq();
+    return true;
+}
+
+/* configure the SysTick timer for a period of period_us microseconds */
+void hal57_systick_config(uint32_t period_us)
+{
+    systick_period_us = period_us;
+    SysTick_Config((SystemCoreClock / 1000000) * period_us);
+}
+
+/* sleep until the next interrupt */
+void hal57_wait_for_interrupt(void)
+{
+    __WFI();
+}
+
+/* DWT CYCCNT, kept counting in sleep mode by DBG_SLEEP (HCLK stays on) */
+void hal57_cycle_counter(bool on)
+{
+    if (on)
+    {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    else
+    {
+        DWT->CTRL &= ~DWT_CTRL_CYCCNTENA_Msk;
+        DBGMCU->CR &= ~DBGMCU_CR_DBG_SLEEP;
+    }
+}
+
+/* read the DWT cycle counter */
+uint32_t hal57_cycle_count(void)
+{
+    return DWT->CYCCNT;
+}
+
+/* drive the debug pin */
+void hal57_debug_pin(bool on)
+{
+#ifdef RCL57_PCB
+    /* PB7 is USART1 RXD once reception is on */
+    if (is_rx_on)
+        return;
+    if (on)
+        GPIOB->BSRR = GPIO_Pin_7;
+    else
+        GPIOB->BRR = GPIO_Pin_7;
+#else
+    if (on)
+        GPIOC->BSRR = GPIO_Pin_14;
+    else
+        GPIOC->BRR = GPIO_Pin_14;
+#endif
+}
+
+/* drive the 'direct drive' digit 12 cathode low (on) or float it (off) */
+void hal57_direct_d12(bool on)
+{
+    if (on)
+        GPIOB->BRR = GPIO_Pin_4;
+    else
+        GPIOB->BSRR = GPIO_Pin_4;
+}
+
+/*************************************/
+/* Segment driver specific functions */
+/*************************************/
+
+/* disable all segment drive outputs (drive high to turn off PMOS gate) */
+void hal57_segment_disable_all(void)
+{
+    GPIOA->BSRR = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12;
+}
+
+/* enable all segment drive outputs (drive low to turn on PMOS gate) */
+void hal57_segment_enable_all(void)
+{
+    GPIOA->BRR = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12;
+}
+
+/* enable one specific segment output, 0-7 -->
+ *   SEG # --  0   1   2   3   4   5   6   7
+ *   LED   --  E   F   B   G   C   A   D   DP */
+void hal57_segment_enable(uint8_t s)
+{
+    switch (s)
+    {
+    case 0:
+        GPIOA->BRR = GPIO_Pin_9;
+        break;      //e
+    case 1:
+        GPIOA->BRR = GPIO_Pin_10;
+        break;      //f
+    case 2:
+        GPIOA->BRR = GPIO_Pin_7;
+        break;      //b
+    case 3:
+        GPIOA->BRR = GPIO_Pin_11;
+        break;      //g
+    case 4:
+        GPIOA->BRR = GPIO_Pin_8;
+        break;      //c
+    case 5:
+        GPIOA->BRR = GPIO_Pin_6;
+        break;      //a
+    case 6:
+        GPIOA->BRR = GPIO_Pin_5;
+        break;      //d
+    case 7:
+        GPIOA->BRR = GPIO_Pin_12;
+        break;      //dp
+    }
+}
+
+/*******************************************/
+/* TLC5929 Digit Driver specific functions */
+/*******************************************/
+
+/* shift a byte into the TLC5929 over SPI1 */
+void hal57_digit_driver_shift(uint8_t b)
+{
+    SPI_I2S_SendData(SPI1, b);
+    while (SPI_I2S_GetFlagStatus(SPI1, SPI_I2S_FLAG_BSY));
+}
+
+/* start a DMA transfer of n bytes to the TLC5929 over SPI1 */
+void hal57_digit_driver_stream(const uint8_t* bytes, uint8_t n)
+{
+    /* the channel must be disabled to be reloaded */
+    DMA1_Channel3->CCR &= ~DMA_CCR3_EN;
+    DMA1->IFCR = DMA1_IT_GL3;
+    DMA1_Channel3->CMAR = (uint32_t)bytes;
+    DMA1_Channel3->CNDTR = n;
+    DMA1_Channel3->CCR |= DMA_CCR3_EN;
+}
+
+/* true until the DMA has fed the last byte and SPI1 has shifted it out */
+bool hal57_digit_driver_busy(void)
+{
+    return (DMA1_Channel3->CNDTR != 0) || !(SPI1->SR & SPI_SR_TXE) || (SPI1->SR & SPI_SR_BSY);
+}
+
+/* toggle the TLC5929 LATCH signal */
+void hal57_digit_driver_latch(void)
+{
+    /* a streamed word must be complete before it is latched */
+    while (hal57_digit_driver_busy());
+
+    /* Assert LATCH */
+    GPIOA->BSRR = GPIO_Pin_15;
+    /* delay for some uncritical hold time before negating LATCH */
+    __NOP();
+    __NOP();
+    GPIOA->BRR = GPIO_Pin_15;
+}
+
+/*******************************/
+/* Keyboard specific functions */
+/*******************************/
+
+/* start a scan of the K1-K5 inputs (ADC CH0-CH4), stored by DMA into k */
+void hal57_keyboard_adc_start(volatile uint16_t k[5])
+{
+    /* the channel must be disabled to be reloaded */
+    DMA1_Channel1->CCR &= ~DMA_CCR1_EN;
+    DMA1->IFCR = DMA1_IT_GL1;
+    DMA1_Channel1->CMAR = (uint32_t)k;
+    DMA1_Channel1->CNDTR = 5;
+    DMA1_Channel1->CCR |= DMA_CCR1_EN;
+
+    /* start the regular conversion sequence CH0-CH4 */
+    ADC_SoftwareStartConvCmd(ADC1, ENABLE);
+}
+
+/* the DMA has stored the 5th conversion */
+bool hal57_keyboard_adc_done(void)
+{
+    return !!(DMA1->ISR & DMA1_FLAG_TC1);
+}
+
+/* convert the K1-K5 inputs and wait for the results */
+bool hal57_keyboard_adc(uint16_t k[5])
+{
+    static volatile uint16_t results[5];
+    uint16_t adc_timeout;
+
+    hal57_keyboard_adc_start(results);
+
+    /* wait for the sequence to complete */
+    for (adc_timeout = ADC_EOC_TIMEOUT; adc_timeout > 0; --adc_timeout)
+    {
+        if (hal57_keyboard_adc_done())
+            break;
+    }
+    /* if conversion did not complete, report failure */
+    if (adc_timeout == 0)
+        return false;
+
+    for (uint8_t i = 0; i < 5; i++)
+        k[i] = results[i];
+
+    return true;
+}
+
+/* read the K1-K5 switch inputs as digital levels */
+uint8_t hal57_keyboard_inputs(void)
+{
+    return (GPIO_ReadInputData(GPIOA) & 0x001f);
+}
+
+/********************************/
+/* USART1 telemetry, fed by DMA */
+/********************************/
+
+/* start a DMA transfer of n bytes to USART1 TX */
+void hal57_usart_stream(const uint8_t* bytes, uint16_t n)
+{
+    /* the channel must be disabled to be reloaded */
+    DMA1_Channel4->CCR &= ~DMA_CCR4_EN;
+    DMA1->IFCR = DMA1_IT_GL4;
+    DMA1_Channel4->CMAR = (uint32_t)bytes;
+    DMA1_Channel4->CNDTR = n;
+    DMA1_Channel4->CCR |= DMA_CCR4_EN;
+}
+
+/* true until the DMA has fed the last byte to the USART1 data register */
+bool hal57_usart_busy(void)
+{
+    return (DMA1_Channel4->CCR & DMA_CCR4_EN) && (DMA1_Channel4->CNDTR != 0);
+}
+
+/* turn PB7 into USART1 RXD (remapped with TXD), and interrupt on each byte */
+void hal57_usart_rx_start(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+
+    is_rx_on = true;
+
+    /* input with pullup, so that an unconnected RXD idles high */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_7;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPU;
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+    USART1->CR1 |= USART_CR1_RE | USART_CR1_RXNEIE;
+
+    /* below TIM3, which times the UNI/O bits, above SysTick */
+    NVIC_SetPriority(USART1_IRQn, 1);
+    NVIC_EnableIRQ(USART1_IRQn);
+}
+
+/* reading DR clears RXNE, and an overrun after reading SR */
+bool hal57_usart_receive(uint8_t* byte)
+{
+    if ((USART1->SR & (USART_SR_RXNE | USART_SR_ORE)) == 0)
+        return false;
+    *byte = (uint8_t)USART1->DR;
+    return true;
+}
+
+/****************************/
+/* UNI/O specific functions */
+/****************************/
+
+/* UNI/O is on B0, open drain with external pullup */
+void hal57_unio_set(bool high)
+{
+    if (high)
+        GPIOB->BSRR = GPIO_Pin_0;
+    else
+        GPIOB->BRR = GPIO_Pin_0;
+}
+
+bool hal57_unio_get(void)
+{
+    return !!(GPIOB->IDR & GPIO_IDR_IDR0);
+}
+
+/* TIM3 counts up at 1us/tick, and raises its CC1 interrupt on compare */
+void hal57_timer_alarm_start(uint16_t us)
+{
+    /* reset the counter and the prescaler */
+    TIM3->CR1 &= ~(TIM_CR1_CEN);
+    TIM3->EGR = TIM_EGR_UG;
+
+    /* load the compare register with target tick value */
+    TIM3->CCR1 = us;
+    TIM3->SR = (uint16_t)~TIM_SR_CC1IF;
+    TIM3->DIER |= TIM_DIER_CC1IE;
+
+    /* start the timer */
+    TIM3->CR1 |= TIM_CR1_CEN;
+}
+
+void hal57_timer_alarm_next(uint16_t us)
+{
+    TIM3->SR = (uint16_t)~TIM_SR_CC1IF;
+    TIM3->CCR1 += us;
+}
+
+void hal57_timer_alarm_stop(void)
+{
+    TIM3->CR1 &= ~(TIM_CR1_CEN);
+    TIM3->DIER &= ~(TIM_DIER_CC1IE);
+    TIM3->SR = (uint16_t)~TIM_SR_CC1IF;
+}
+
+/*****************************/
+/* STOP mode, woken by a key */
+/*****************************/
+
+#define KEY_COLUMN_PINS (GPIO_Pin_0 | GPIO_Pin_1 | GPIO_Pin_2 | GPIO_Pin_3 | GPIO_Pin_4)
+#define KEY_COLUMN_LINES (EXTI_Line0 | EXTI_Line1 | EXTI_Line2 | EXTI_Line3 | EXTI_Line4)
+
+/* K1-K5 become digital inputs with pulldown, and their rising edges
+   EXTI wake up events (not interrupts: the core wakes up from WFE) */
+void hal57_stop_until_key(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    uint32_t systick_ctrl = SysTick->CTRL;
+
+    GPIO_InitStructure.GPIO_Pin = KEY_COLUMN_PINS;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPD;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    /* EXTI0-4 on port A */
+    AFIO->EXTICR[0] = 0;
+    AFIO->EXTICR[1] &= ~AFIO_EXTICR2_EXTI4;
+    EXTI->IMR &= ~KEY_COLUMN_LINES;
+    EXTI->FTSR &= ~KEY_COLUMN_LINES;
+    EXTI->RTSR |= KEY_COLUMN_LINES;
+    EXTI->PR = KEY_COLUMN_LINES;
+    EXTI->EMR |= KEY_COLUMN_LINES;
+
+    /* hold SysTick, whose interrupt would end the sleep */
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    /* a key pressed already raises no edge */
+    if ((GPIOA->IDR & KEY_COLUMN_PINS) == 0)
+    {
+        /* STOP mode, with the regulator in low power mode */
+        RCC->APB1ENR |= RCC_APB1ENR_PWREN;
+        PWR->CR &= ~PWR_CR_PDDS;
+        PWR->CR |= PWR_CR_LPDS;
+        SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+
+        /* the first WFE consumes the event register set by SEV */
+        __SEV();
+        __WFE();
+        __WFE();
+
+        SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+        /* the MCU wakes up on HSI (8 MHz), with the PLL off */
+        SystemCoreClockConfigure(core_clock);
+    }
+
+    EXTI->EMR &= ~KEY_COLUMN_LINES;
+    EXTI->RTSR &= ~KEY_COLUMN_LINES;
+    EXTI->PR = KEY_COLUMN_LINES;
+
+    /* back to analog inputs for ADC1 */
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    SysTick->VAL = 0;
+    SysTick->CTRL = systick_ctrl;
+}
+
+/////////////
+
+/* STM32F103 GPIO Initialization */
+static void InitGPIO()
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+
+    /* GPIO are all on APB2 */
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
+
+    /* enable the AFIO to allow remaps as well */
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
+
+    /* configure C13 and C14 as GPIO output pins */
+    /* Blue Pill Debug pins! LED on C13 (0 = lit) */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_13 | GPIO_Pin_14;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+    GPIO_Init(GPIOC, &GPIO_InitStructure);
+
+    /* GPIO Configuration for RCL-57 Emulator PCB V2*/
+
+    /* Configure PA0-PA4 as analog inputs */
+    /* These are the K1,K2,K3,K4,K5 keypad column input lines */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0 | GPIO_Pin_1 | GPIO_Pin_2 | GPIO_Pin_3 | GPIO_Pin_4;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    /* Configure PA5-12 as PP outputs*/
+    /* These are the D,A,B,C,E,F,G,P segment control outputs --> init to 1 */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8
+                                  | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+    GPIO_SetBits(GPIOA, GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8
+                 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12);
+
+    /* configure A15 as GPIO output */
+    /* This is TLC5925 LATCH control output --> init to 0 */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_15;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+    GPIO_Init(GPIOA, &GPIO_InitStructure);
+
+    /* Configure PB0 as OD GPIO */
+    /* This is 11AA080 UNI/O signal input-output with 47K pullup */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+    GPIO_ResetBits(GPIOB, GPIO_Pin_0);
+
+    /* Configure PB4 as OD GPIO */
+    /* This is a 'direct drive' for digit #12 cathode */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_4;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+    GPIO_SetBits(GPIOB, GPIO_Pin_4);
+
+    /* Configure PB3 and PB5 as PP GPIO */
+    /* These are TLC5925 SCLK and SDATA outputs, respectively */
+    /* Step 1 - disable JTAG interface (uses PB3) */
+    GPIO_PinRemapConfig(GPIO_Remap_SWJ_JTAGDisable, ENABLE);
+    /* Step 2 - Release PB3/TRACESWO and PB4/NJTRST from control of the
+    debug port so they can be used as GPIO pins. This info was
+    well-hidden in an ST forum posting. */
+    DBGMCU->CR &= ~DBGMCU_CR_TRACE_IOEN;
+    RCC->APB2ENR |= RCC_APB2ENR_AFIOEN;
+    AFIO->MAPR |= AFIO_MAPR_SWJ_CFG_JTAGDISABLE;
+    /* Step 3 - Enable SPI remap to RB3/RB5*/
+    GPIO_PinRemapConfig(GPIO_Remap_SPI1, ENABLE);
+    /* Step 4 - Configure PB3 and PB5 as AF GPIO */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_3 | GPIO_Pin_5;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+
+    /* configure PB6 as USART1 TXD and PB7 as output */
+    /* These are brought out to debug header on V2 PCB */
+    /* configure PB6 as AF GPIO */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_6;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+    /* Remap USART1 to PB6 */
+    GPIO_PinRemapConfig(GPIO_Remap_USART1, ENABLE);
+
+    /* configure PB7 as GPIO output */
+    /* this becomes USART1 RXD with hal57_usart_rx_start */
+    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_7;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+    GPIO_Init(GPIOB, &GPIO_InitStructure);
+}
+
+/* STM32F103 USART1 initialization */
+static void InitUSART()
+{
+    USART_InitTypeDef USART_InitStructure;
+
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, ENABLE);
+
+    /* 230400 bps, 8N1, no flow control, TX only: hal57_usart_rx_start()
+       adds RX on PB7 when the command interface is built in */
+    USART_InitStructure.USART_BaudRate = USART_BAUD_RATE;
+    USART_InitStructure.USART_WordLength = USART_WordLength_8b;
+    USART_InitStructure.USART_StopBits = USART_StopBits_1;
+    USART_InitStructure.USART_Parity = USART_Parity_No;
+    USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
+    USART_InitStructure.USART_Mode = USART_Mode_Tx;
+
+    USART_Init(USART1, &USART_InitStructure);
+    USART_Cmd(USART1, ENABLE);
+}
+
+/* Initialize DMA1 channel 4 to feed USART1 TX from memory, one byte at a time */
+static void InitUSARTDMA(void)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+
+    /* enable the DMA1 clock */
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    /* memory to USART1 data register, memory address incremented, bytes.
+       Address and count are loaded by hal57_usart_stream() */
+    DMA_DeInit(DMA1_Channel4);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&USART1->DR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = 0;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+    DMA_InitStructure.DMA_BufferSize = 0;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel4, &DMA_InitStructure);
+
+    /* USART1 requests a byte from DMA whenever its TX buffer is empty */
+    USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
+}
+
+/* STM32F103 TIM3 Initialization */
+static void InitTIM3()
+{
+    TIM_TimeBaseInitTypeDef TimeBaseInitStructure;
+
+    /* Enable the TIM3 clock.   */
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
+
+    /* De-init TIM3 to get it back to default values */
+    TIM_DeInit(TIM3);
+
+    /* Init the TimeBaseInitStructure with 1us/tick values */
+    TimeBaseInitStructure.TIM_Prescaler = (SystemCoreClock / 1000000) - 1;
+    TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TimeBaseInitStructure.TIM_Period = 0xFFFF;
+    TIM_TimeBaseInit(TIM3, &TimeBaseInitStructure);
+
+    /* CC1 is a free running compare (frozen output), its interrupt clocks
+       the UNI/O engine. It preempts SysTick, which has the lowest priority */
+    NVIC_SetPriority(TIM3_IRQn, 0);
+    NVIC_EnableIRQ(TIM3_IRQn);
+}
+
+/* Initialize the STM32F103 SPI peripheral */
+static void InitSPI(void)
+{
+    SPI_InitTypeDef  SPI_InitStructure;
+
+    /* enable the SPI1 peripheral clock */
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SPI1, ENABLE);
+
+    /* Load SPI1 InitStructure with config options for CAT4016 */
+    SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;
+    SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
+
+    /* 8-bit data word, MODE = 00, MSB first */
+    SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
+    SPI_InitStructure.SPI_CPOL = SPI_CPOL_Low;
+    SPI_InitStructure.SPI_CPHA = SPI_CPHA_1Edge;
+    SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
+
+    /* no hardware SS handling */
+    SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
+
+    /* SPI clock configuration APB2 clock / 8 */
+    SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_8;
+
+    /* initialize and enable the SPI peripheral */
+    SPI_Init(SPI1, &SPI_InitStructure);
+    SPI_Cmd(SPI1, ENABLE);
+}
+
+/* Initialize DMA1 channel 3 to feed SPI1 TX from memory, one byte at a time */
+static void InitSPIDMA(void)
+{
+    DMA_InitTypeDef DMA_InitStructure;
+
+    /* enable the DMA1 clock */
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    /* memory to SPI1 data register, memory address incremented, bytes.
+       Address and count are loaded by hal57_digit_driver_stream() */
+    DMA_DeInit(DMA1_Channel3);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&SPI1->DR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = 0;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+    DMA_InitStructure.DMA_BufferSize = 0;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel3, &DMA_InitStructure);
+
+    /* SPI1 requests a byte from DMA whenever its TX buffer is empty */
+    SPI_I2S_DMACmd(SPI1, SPI_I2S_DMAReq_Tx, ENABLE);
+}
+
+static void InitADC(void)
+{
+    ADC_InitTypeDef ADC_InitStructure;
+    DMA_InitTypeDef DMA_InitStructure;
+
+    /* Enable the ADC and DMA1 clocks.   */
+    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, ENABLE);
+    RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+    /* Set the ADC clock prescalar to div-2 (12 MHz) */
+    RCC_ADCCLKConfig(RCC_PCLK2_Div2);
+
+    /* DMA1 channel 1 stores the 5 results of a scan: ADC1 data register
+       to memory, 16 bits. Address is loaded by hal57_keyboard_adc_start() */
+    DMA_DeInit(DMA1_Channel1);
+    DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t)&ADC1->DR;
+    DMA_InitStructure.DMA_MemoryBaseAddr = 0;
+    DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+    DMA_InitStructure.DMA_BufferSize = 5;
+    DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+    DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+    DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+    DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+    DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+    DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+    DMA_Init(DMA1_Channel1, &DMA_InitStructure);
+
+    /* ADC1 configuration: one software triggered scan of CH0-CH4 */
+    ADC_InitStructure.ADC_Mode = ADC_Mode_Independent;
+    ADC_InitStructure.ADC_ScanConvMode = ENABLE;
+    ADC_InitStructure.ADC_ContinuousConvMode = DISABLE;
+    ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
+    ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;
+    ADC_InitStructure.ADC_NbrOfChannel = 5;
+    ADC_Init(ADC1, &ADC_InitStructure);
+
+    /* ADC1 regular sequence: K1-K5 */
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_0, 1, ADC_SampleTime_41Cycles5);
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_1, 2, ADC_SampleTime_41Cycles5);
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_2, 3, ADC_SampleTime_41Cycles5);
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_3, 4, ADC_SampleTime_41Cycles5);
+    ADC_RegularChannelConfig(ADC1, ADC_Channel_4, 5, ADC_SampleTime_41Cycles5);
+
+    /* software start of the regular sequence, results through DMA */
+    ADC_ExternalTrigConvCmd(ADC1, ENABLE);
+    ADC_DMACmd(ADC1, ENABLE);
+
+    /* Enable ADC1 - it stays enabled, ready for the next scan */
+    ADC_Cmd(ADC1, ENABLE);
+
+    /* Enable ADC1 reset calibration register */
+    ADC_ResetCalibration(ADC1);
+    /* Check the end of ADC1 reset calibration register */
+    while (ADC_GetResetCalibrationStatus(ADC1));
+
+    /* Start ADC1 calibration */
+    ADC_StartCalibration(ADC1);
+    /* Check the end of ADC1 calibration */
+    while (ADC_GetCalibrationStatus(ADC1));
+}
@@ -0,0 +1,149 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+
+#include "kbd57.h"
+
+/* Debounced keyboard events for RCL-57 */
+/* https://hackaday.io/project/194963 */
+
+/* Private data - only used by the SysTick ISR */
+
+static uint8_t open_samples[8][5];      // consecutive open samples of each pressed key
+static uint32_t now = 0;                // SysTick periods since kbd57_init()
+
+/* Private data - shared between SysTick ISR and foreground */
+
+static volatile uint8_t pressed[8];     // debounced state, K1 in bit 0, per row
+static kbd57_event_t queue[KBD57_QUEUE_SIZE];
+static volatile uint8_t head = 0;       // next event written (ISR)
+static volatile uint8_t tail = 0;       // next event read (foreground)
+static volatile uint32_t overflow_count = 0;
+
+/* queue an event, or count it as lost if the queue is full */
+static void put_event(uint8_t scancode, bool is_press)
+{
+    uint8_t next = (head + 1) & (KBD57_QUEUE_SIZE - 1);
+
+    if (next == tail)
+    {
+        overflow_count += 1;
+        return;
+    }
+    queue[head].scancode = scancode;
+    queue[head].is_press = is_press;
+    queue[head].time = now;
+    head = next;
+}
+
+/* release all keys and empty the event queue */
+void kbd57_init(void)
+{
+    for (uint8_t r = 0; r < 8; r++)
+    {
+        pressed[r] = 0;
+        for (uint8_t c = 0; c < 5; c++)
+            open_samples[r][c] = 0;
+    }
+    head = 0;
+    tail = 0;
+    overflow_count = 0;
+    now = 0;
+}
+
+/* advance the time by one SysTick period */
+void kbd57_tick(void)
+{
+    now += 1;
+}
+
+/* debounce the column inputs sampled on a row */
+void kbd57_scan_row(uint8_t row, uint8_t columns)
+{
+    uint8_t r = (row - 1) & 0x7;
+    uint8_t state = pressed[r];
+
+    for (uint8_t c = 0; c < 5; c++)
+    {
+        uint8_t bit = 1 << c;
+
+        if (columns & bit)
+        {
+            /* closed: a press right away, or a pressed key still held */
+            open_samples[r][c] = 0;
+            if (!(state & bit))
+            {
+                state |= bit;
+                put_event((row << 4) | (c + 1), true);
+            }
+        }
+        else if (state & bit)
+        {
+            /* open: release once it has been open long enough */
+            if (++open_samples[r][c] >= KBD57_RELEASE_SAMPLES)
+            {
+                state &= ~bit;
+                put_event((row << 4) | (c + 1), false);
+            }
+        }
+    }
+    pressed[r] = state;
+}
+
+/* report a failed conversion of a row */
+void kbd57_fault(void)
+{
+    put_event(KBD57_FAULT, true);
+}
+
+/* take the oldest event from the queue */
+bool kbd57_get_event(kbd57_event_t* event)
+{
+    if (tail == head)
+        return false;
+
+    *event = queue[tail];
+    tail = (tail + 1) & (KBD57_QUEUE_SIZE - 1);
+    return true;
+}
+
+/* true if exactly the n keys of scancodes are held down */
+bool kbd57_is_chord(const uint8_t* scancodes, uint8_t n)
+{
+    uint8_t chord[8] = {0};
+
+    for (uint8_t i = 0; i < n; i++)
+        chord[((scancodes[i] >> 4) - 1) & 0x7] |= 1 << ((scancodes[i] & 0x0f) - 1);
+
+    for (uint8_t r = 0; r < 8; r++)
+    {
+        if (pressed[r] != chord[r])
+            return false;
+    }
+    return true;
+}
+
+/* number of events lost because the queue was full */
+uint32_t kbd57_get_overflow_count(void)
+{
+    return overflow_count;
+}
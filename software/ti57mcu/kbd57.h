@@ -0,0 +1,66 @@
+#ifndef kbd57_h
+#define kbd57_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Debounced keyboard events for RCL-57
+ *
+ * The display scan (scan57.c) samples the 5 columns of a keyboard row
+ * during each segment slot and hands them to kbd57_scan_row(), from the
+ * SysTick ISR. Every key has its own debouncing state:
+ *   - a press is reported on the first sample that finds the key closed,
+ *     so the latency of a press is one segment slot at most
+ *   - a release is reported once the key is found open in
+ *     KBD57_RELEASE_SAMPLES consecutive samples (one per display cycle),
+ *     which rides over contact bounce
+ *
+ * Presses and releases are queued as timestamped events, consumed by the
+ * foreground with kbd57_get_event(). All the keys are tracked, so chords
+ * such as 2ND + INV + CLR are checked with kbd57_is_chord().
+ *
+ * The queue has a single producer (the ISR) and a single consumer (the
+ * foreground), each writing its own index, so no interrupt masking is
+ * needed.
+ */
+
+/** consecutive open samples (display cycles) before a release is reported */
+#define KBD57_RELEASE_SAMPLES (2)
+
+/** event queue size - a power of 2 */
+#define KBD57_QUEUE_SIZE (16)
+
+/** scancode of the event reported when a keyboard conversion fails */
+#define KBD57_FAULT (0xFF)
+
+/** key press or release */
+typedef struct
+{
+    uint8_t scancode;   // row (1-8) in the high nibble, column (1-5) in the low one
+    bool is_press;      // press or release
+    uint32_t time;      // SysTick periods since kbd57_init()
+} kbd57_event_t;
+
+/** release all keys and empty the event queue */
+void kbd57_init(void);
+
+/** advance the time by one SysTick period - call from the SysTick ISR */
+void kbd57_tick(void);
+
+/** debounce the column inputs (K1 in bit 0) sampled on row 1-8 - ISR */
+void kbd57_scan_row(uint8_t row, uint8_t columns);
+
+/** report a failed conversion of a row - ISR */
+void kbd57_fault(void);
+
+/** take the oldest event from the queue. Returns false if it is empty */
+bool kbd57_get_event(kbd57_event_t* event);
+
+/** true if exactly the n keys of scancodes are held down */
+bool kbd57_is_chord(const uint8_t* scancodes, uint8_t n);
+
+/** number of events lost because the queue was full */
+uint32_t kbd57_get_overflow_count(void);
+
+#endif /* kbd57_h */
@@ -0,0 +1,52 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#include "lib57.h"
+
+bool lib57_is_occupied(uint8_t slot)
+{
+    uint8_t i;
+
+    if (slot < LIB57_FIRST_SLOT || slot > LIB57_LAST_SLOT)
+        return false;
+    i = slot - LIB57_FIRST_SLOT;
+    return LIB57_OFFSETS[i + 1] > LIB57_OFFSETS[i];
+}
+
+uint16_t lib57_get_hash(uint8_t slot)
+{
+    if (!lib57_is_occupied(slot))
+        return 0;
+    return LIB57_HASHES[slot - LIB57_FIRST_SLOT];
+}
+
+bool lib57_load(uint8_t slot, ti57_t* ti57)
+{
+    uint8_t i;
+
+    if (!lib57_is_occupied(slot))
+        return false;
+    i = slot - LIB57_FIRST_SLOT;
+    ti57_set_program_opcodes(ti57, &LIB57_STEPS[LIB57_OFFSETS[i]],
+                             LIB57_OFFSETS[i + 1] - LIB57_OFFSETS[i]);
+    return true;
+}
@@ -0,0 +1,64 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+#ifndef lib57_h
+#define lib57_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "state57.h"
+
+
+/* TI-57 program library in flash */
+
+/* Slots 21-99 of the program manager hold a library of programs, read
+   only. The library is written as listings of mnemonics in lib57.txt and
+   compiled by libgen57.c into the tables of libdata57.c:
+
+     libgen57 < lib57.txt > libdata57.c
+
+   Only the steps up to the last non-zero one are stored, back to back in
+   LIB57_STEPS; slot s occupies LIB57_STEPS[LIB57_OFFSETS[i]] up to
+   LIB57_STEPS[LIB57_OFFSETS[i + 1]], with i = s - LIB57_FIRST_SLOT, so an
+   empty slot takes 4 bytes. The Fletcher-16 hash of the 50 steps, the
+   program "label", is computed by libgen57 as well. */
+
+#define LIB57_FIRST_SLOT 21
+#define LIB57_LAST_SLOT 99
+#define LIB57_SLOT_COUNT (LIB57_LAST_SLOT - LIB57_FIRST_SLOT + 1)
+
+/* generated tables, see libdata57.c */
+extern const uint8_t LIB57_STEPS[];
+extern const uint16_t LIB57_OFFSETS[LIB57_SLOT_COUNT + 1];
+extern const uint16_t LIB57_HASHES[LIB57_SLOT_COUNT];
+
+/** true if library slot 21-99 holds a program */
+bool lib57_is_occupied(uint8_t slot);
+
+/** Fletcher-16 hash of the steps of library slot 21-99 */
+uint16_t lib57_get_hash(uint8_t slot);
+
+/** load library slot 21-99 into the program steps (Y registers).
+    Returns false if the slot is empty */
+bool lib57_load(uint8_t slot, ti57_t* ti57);
+
+#endif /* lib57_h */
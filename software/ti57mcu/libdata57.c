@@ -0,0 +1,42 @@
+/**
+ * Program library of the RCL-57, in slots 21-99.
+ *
+ * Generated by libgen57.c from lib57.txt. Do not edit.
+ */
+
+#include "lib57.h"
+
+const uint8_t LIB57_STEPS[] = {
+    // 21
+    0xF0, 0x01, 0xF1, 0x26, 0xB0, 0xE1, 0x64, 0x2E, 0xB1, 0x17,
+    0x16,
+    // 22
+    0x55, 0x03, 0x02, 0x57, 0x54, 0x05, 0x53, 0x09, 0x57, 0x17,
+    0x16,
+    // 23
+    0x31, 0xF1, 0x17, 0x31, 0xD1, 0xB1, 0x41, 0x17, 0x16,
+};
+
+const uint16_t LIB57_OFFSETS[LIB57_SLOT_COUNT + 1] = {
+       0,   11,   22,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+      31,   31,   31,   31,   31,   31,   31,   31,   31,   31,
+};
+
+const uint16_t LIB57_HASHES[LIB57_SLOT_COUNT] = {
+    0x630E, 0x02EB, 0xEE5D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
@@ -0,0 +1,163 @@
+/**
+ * Compiles the program library listings into libdata57.c, the flash tables
+ * of lib57.h.
+ *
+ * A listing is a "slot n" line (n in 21..99) followed by one line per step,
+ * written as the ASCII mnemonic of the step (OPS57_ASCII in ops57.h), for
+ * example "INV STO 2", "LBL 1", "DSZ" or "7". Text after '#' is a comment.
+ *
+ * Usage:
+ *   libgen57 < lib57.txt > libdata57.c
+ *
+ * Build on the host with the operation tables, from the software directory:
+ *   gcc -std=gnu11 -Iti57mcu -Iti57console -o libgen57 ti57mcu/libgen57.c ti57console/ops57.c
+ */
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ops57.h"
+
+#define FIRST_SLOT 21
+#define LAST_SLOT 99
+#define SLOT_COUNT (LAST_SLOT - FIRST_SLOT + 1)
+#define STEP_COUNT 50
+
+static unsigned char steps[SLOT_COUNT][STEP_COUNT];
+static int step_counts[SLOT_COUNT];     // -1: slot not in the listings
+
+/** Returns the opcode of a mnemonic (the lowest one if several match), or -1. */
+static int find_opcode(const char *mnemonic)
+{
+    for (int i = 0; i <= 0xff; i++) {
+        if (strcmp(OPS57_ASCII[i], mnemonic) == 0) return i;
+    }
+    return -1;
+}
+
+/** Fletcher-16 checksum, as storage57_fletcher16() (storage57.c is not built on the host). */
+static unsigned fletcher16(const unsigned char *data, int count)
+{
+    unsigned sum1 = 0, sum2 = 0;
+
+    for (int i = 0; i < count; i++) {
+        sum1 = (sum1 + data[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    return (sum2 << 8) | sum1;
+}
+
+static void fail(int line_number, const char *message, const char *text)
+{
+    fprintf(stderr, "libgen57: line %d: %s \"%s\"\n", line_number, message, text);
+    exit(1);
+}
+
+/** Strips the comment and the surrounding spaces, and collapses inner spaces. */
+static void normalize(char *line)
+{
+    char *out = line;
+    bool is_space = true;
+
+    for (char *c = line; *c && *c != '#'; c++) {
+        if (isspace((unsigned char)*c)) {
+            is_space = true;
+            continue;
+        }
+        if (is_space && out != line) *out++ = ' ';
+        is_space = false;
+        *out++ = *c;
+    }
+    *out = 0;
+}
+
+static void read_listings(FILE *f)
+{
+    char line[256];
+    int line_number = 0;
+    int slot = -1;
+
+    memset(step_counts, 0xff, sizeof(step_counts));
+    while (fgets(line, sizeof(line), f)) {
+        line_number++;
+        normalize(line);
+        if (!line[0]) continue;
+
+        if (strncmp(line, "slot ", 5) == 0) {
+            char *end;
+            long n = strtol(line + 5, &end, 10);
+            if (*end || n < FIRST_SLOT || n > LAST_SLOT) fail(line_number, "bad slot", line);
+            slot = n - FIRST_SLOT;
+            if (step_counts[slot] >= 0) fail(line_number, "duplicate slot", line);
+            step_counts[slot] = 0;
+            continue;
+        }
+        if (slot < 0) fail(line_number, "step outside of a slot", line);
+        int opcode = find_opcode(line);
+        if (opcode < 0) fail(line_number, "unknown step", line);
+        if (step_counts[slot] == STEP_COUNT) fail(line_number, "more than 50 steps at", line);
+        steps[slot][step_counts[slot]++] = opcode;
+    }
+}
+
+int main(void)
+{
+    int offsets[SLOT_COUNT + 1];
+    int offset = 0;
+    int program_count = 0;
+
+    read_listings(stdin);
+
+    printf("/**\n"
+           " * Program library of the RCL-57, in slots %d-%d.\n"
+           " *\n"
+           " * Generated by libgen57.c from lib57.txt. Do not edit.\n"
+           " */\n"
+           "\n"
+           "#include \"lib57.h\"\n", FIRST_SLOT, LAST_SLOT);
+
+    // Steps up to the last non-zero one: the remaining steps load as 0.
+    printf("\nconst uint8_t LIB57_STEPS[] = {\n");
+    for (int s = 0; s < SLOT_COUNT; s++) {
+        int count = STEP_COUNT;
+        while (count > 0 && steps[s][count - 1] == 0) {
+            count--;
+        }
+        offsets[s] = offset;
+        offset += count;
+        if (count > 0) {
+            program_count++;
+            printf("    // %d\n", s + FIRST_SLOT);
+        }
+        for (int i = 0; i < count; i++) {
+            printf("%s0x%02X,%s", i % 10 ? " " : "    ", steps[s][i],
+                   i % 10 == 9 || i == count - 1 ? "\n" : "");
+        }
+    }
+    offsets[SLOT_COUNT] = offset;
+    if (offset == 0) {
+        printf("    0x00,  // empty library\n");
+    }
+    printf("};\n");
+
+    printf("\nconst uint16_t LIB57_OFFSETS[LIB57_SLOT_COUNT + 1] = {\n");
+    for (int s = 0; s <= SLOT_COUNT; s++) {
+        printf("%s%4d,%s", s % 10 ? " " : "    ", offsets[s],
+               s % 10 == 9 || s == SLOT_COUNT ? "\n" : "");
+    }
+    printf("};\n");
+
+    printf("\nconst uint16_t LIB57_HASHES[LIB57_SLOT_COUNT] = {\n");
+    for (int s = 0; s < SLOT_COUNT; s++) {
+        unsigned hash = offsets[s + 1] > offsets[s] ? fletcher16(steps[s], STEP_COUNT) : 0;
+        printf("%s0x%04X,%s", s % 8 ? " " : "    ", hash,
+               s % 8 == 7 || s == SLOT_COUNT - 1 ? "\n" : "");
+    }
+    printf("};\n");
+
+    fprintf(stderr, "libgen57: %d programs, %d bytes of steps\n", program_count, offset);
+    return 0;
+}
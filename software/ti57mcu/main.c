@@ -19,29 +19,27 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 
-#include "stm32f10x.h"
-#include "ti57.h"
+#include "rcl57.h"
 #include "rcl57mcu.h"
+#include "hal57.h"
 #include "mux57.h"
+#include "scan57.h"
+#include "sched57.h"
+#include "kbd57.h"
 #include "addon57.h"
+#include "storage57.h"
+#include "tele57.h"
+#include "cmd57.h"
+#include "prof57.h"
 
-/* Target: STM32F103TBU6 at 24 MHz on RCL57 V2 PCB */
+/* Target: STM32F103TBU6 at 8-64 MHz (sched57.h) on RCL57 V2 PCB */
 /* https://hackaday.io/project/194963 */
 
-/* STM32F103 peripheral initialization prototypes*/
-void InitGPIO();
-void InitUSART();
-void InitSysTick();
-void InitTIM3();
-void InitSPI();
-void InitADC();
-
-/* SysTick interrupt handler & Delay function */
+/* SysTick interrupt handler */
 void SysTick_Handler(void);
-void Delay(__IO uint32_t nTime);
 
 /* globals */
-static __IO uint32_t TimingDelay;   // Delay() function counter
+static volatile uint32_t TimingDelay;   // Delay() function counter
 shadow_status_t ee_status_shadow;   // RAM copy of EEPROM status block
 
 /* varoius strings for 'splash' displays and USART messages */
@@ -55,66 +53,72 @@ shadow_status_t ee_status_shadow;   // RAM copy of EEPROM status block
 #endif
 const uint8_t str_ee_fail[] = "   EE FAIL  ";
 
-/////////////
-
-/* this function sets SYSCLK = HCLK = APB1 = APB2 = HSI/2 * 6 = 24 MHz */
-/* it also sets flash access to 0WS and enables the CPU prefetch buffer */
-void SystemCoreClockConfigure(void)
-{
-
-    RCC->CR |= ((uint32_t)RCC_CR_HSION);                     // Enable HSI
-    while ((RCC->CR & RCC_CR_HSIRDY) == 0);                  // Wait for HSI Ready
-
-    RCC->CFGR = RCC_CFGR_SW_HSI;                             // HSI is system clock
-    while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_HSI);  // Wait for HSI used as system clock
+/* 2ND + INV + CLR held together enters Program Manager */
+const uint8_t chord_progman[] = {0x11, 0x12, 0x15};
 
-    FLASH->ACR  = FLASH_ACR_PRFTBE;                          // Enable Prefetch Buffer
-    FLASH->ACR &= ~FLASH_ACR_LATENCY;                                                // Flash 0 wait state
-    FLASH->ACR |= FLASH_ACR_LATENCY_0;
+/* 2ND + INV + a digit held together changes a setting, kept in the EEPROM
+   status block: 1, 2 or 3 selects the 1x, 4x or unthrottled speed profile,
+   4 to 7 toggles the short pause, faster trace, quick stop or run indicator
+   option. Keys 1 to 7, in that order */
+const uint8_t settings_keys[] = {0x72, 0x73, 0x74, 0x62, 0x63, 0x64, 0x52};
+#define SETTINGS_SPEEDS (3)
 
-    RCC->CFGR |= RCC_CFGR_HPRE_DIV1;                         // HCLK = SYSCLK
-    RCC->CFGR |= RCC_CFGR_PPRE1_DIV1;                        // APB1 = HCLK
-    RCC->CFGR |= RCC_CFGR_PPRE2_DIV1;                        // APB2 = HCLK
+/* run indicator, shown in RUN mode instead of the DISP frames. Character
+   code 12 (A-D-E-F) doubles as '[' */
+const uint8_t str_run_indicator[] = "C           ";
 
-    RCC->CR &= ~RCC_CR_PLLON;                                // Disable PLL
-
-    //  PLL configuration:  = HSI/2 * 6 = 24 MHz
-    RCC->CFGR &= ~(RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL);
-    RCC->CFGR |= (RCC_CFGR_PLLSRC_HSI_Div2 | RCC_CFGR_PLLMULL6);
+/////////////
 
-    RCC->CR |= RCC_CR_PLLON;                                 // Enable PLL
-    while ((RCC->CR & RCC_CR_PLLRDY) == 0)
-        __NOP();           // Wait till PLL is ready
+/* the setting of the 2ND + INV + digit chord completed by pressing
+   scancode, -1 if it is not one */
+static int8_t settings_chord(uint8_t scancode)
+{
+    uint8_t chord[3] = {0x11, 0x12, 0};
 
-    RCC->CFGR &= ~RCC_CFGR_SW;                               // Select PLL as system clock source
-    RCC->CFGR |=  RCC_CFGR_SW_PLL;
-    while ((RCC->CFGR & RCC_CFGR_SWS) != RCC_CFGR_SWS_PLL);  // Wait till PLL is system clock src
+    for (uint8_t i = 0; i < sizeof(settings_keys); i++)
+    {
+        if (settings_keys[i] == scancode)
+        {
+            chord[2] = scancode;
+            return kbd57_is_chord(chord, sizeof(chord)) ? (int8_t)i : -1;
+        }
+    }
+    return -1;
 }
 
 int main()
 {
-    ti57_t ti57;
-    uint8_t scancode = 0; // row/col of keypress; e.g. 2ND = 0x11 or 0x99 for ProgMan entry
+    rcl57_t rcl57;
+    ti57_t* ti57 = &rcl57.ti57;
+    uint8_t scancode = 0; // row/col of the key held down; e.g. 2ND = 0x11
+    kbd57_event_t key_event;    // key press or release from the debouncer
     int16_t cycle_cost = 0;               // "cost" of instruction in terms of TMS1500 cycles (1 for all but DISP which is 32)
     uint32_t num_cycles = 0;     // total running cycles counter
     uint32_t idle_disp_cycles = 0;    // cycles elapsed since last keyboard activity
 
     bool rcode;        // boolean return code
+    bool is_run_indicator = false;    // run indicator shown instead of DISP frames
+    bool is_indicator_held = false;   // run indicator frame held by the scan ISR
+    int8_t setting;                   // setting changed by a key chord
     uint32_t temp_int;
+    prof57_mark_t prof_mark;    // start of a profiled section
+
+    display_data_t run_codes, run_masks;  // run indicator frame
 
-    uint8_t codes[16], masks[16];
+    /* initialize MCU clock tree (24 MHz) and peripherals: GPIO, USART, TIM3, SPI, ADC */
+    hal57_init();
 
-    /* initialize MCU clock tree to 24 MHz, 0WS, prefetch on */
-    SystemCoreClockConfigure();
-    SystemCoreClockUpdate();
+    /* reset the display scan state machine, the keyboard debouncer and
+       the telemetry time before SysTick starts calling them */
+    scan57_init();
+    kbd57_init();
+    tele57_init();
 
-    /* initialize MCU peripherals: GPIO, USART, SysTick, TIM3 */
-    InitGPIO();
-    InitUSART();
-    InitSysTick();
-    InitTIM3();
-    InitSPI();
-    InitADC();
+    /* reset the instruction budget, select the speed profile */
+    sched57_init(RCL57_DEFAULT_SPEED);
+
+    /* start the SysTick interrupt */
+    hal57_systick_config(SYSTICK_PERIOD_US);
 
     /* disable all segment driver outputs */
     hw_segment_disable_all();
@@ -126,341 +130,240 @@ int main()
     DIRECT_D12_OFF;
 
     /* output a welcome string on USART */
-    UU_PutString(USART1, str_version);
+    tele57_text((const char*)str_version);
 
-    /* Display a "splash screen" */
-    mux57_splash(str_splash, 300);
+#if RCL57_USART_COMMANDS
+    /* take commands from a host on USART1 RXD */
+    cmd57_init();
+#endif
 
     /* Load and validate the EEPROM status block */
-    if (addon57_validate_status_block(ee_status_shadow) == false)
+    rcode = addon57_validate_status_block(&ee_status_shadow);
+    if (rcode == false)
     {
         /* alert that EEPROM is not found/not accessible */
         mux57_splash(str_ee_fail, 300);
     }
 
+    /* load the program slots in the background */
+    storage57_init(rcode);
+
     /* Set TCL5929 digit driver intensity to value from status shadow */
     hw_digit_driver_intensity(ee_status_shadow[EE_OFFSET_BRIGHT]);
 
-    /* initialize TI-57 emulator */
-    ti57_init(&ti57);
+    /* initialize RCL-57 emulator with the options and speed from EEPROM */
+    rcl57_init(&rcl57);
+    rcl57.options = addon57_get_options(&ee_status_shadow);
+    sched57_set_speed(addon57_get_speed(&ee_status_shadow));
+    mux57_paint_digits(str_run_indicator, &run_codes, &run_masks);
+
+    /* resume from the state saved when the calculator last entered power
+       save. Otherwise the TI-57 starts from its power up sequence, behind
+       a "splash screen". The snapshot is then invalidated: it only
+       holds while in power save */
+    if (storage57_restore_snapshot(ti57) == false)
+        mux57_splash(str_splash, 300);
+    storage57_invalidate_snapshot();
 
     while (1)
     {
+        /* sleep until the speed profile allows the next instruction */
+        sched57_wait();
+
         // DEBUG instruction duration tick on
+        PROF57_BEGIN(prof_mark);
         DEBUG_TICK_ON;
 
         /* execute the next TMC1500 instruction */
-        cycle_cost = ti57_next(&ti57);
+        cycle_cost = rcl57_next(&rcl57);
         num_cycles += cycle_cost;
 
         // DEBUG instruction duration tick off
         DEBUG_TICK_OFF;
+        PROF57_END(prof_mark, PROF57_EMULATION);
+
+        /* charge the instruction against the budget */
+        sched57_charge(&rcl57, cycle_cost);
+
+        /* in RUN mode, hold the run indicator on the display - retried
+           until the scan ISR has picked up the previous frame */
+        is_run_indicator = rcl57_is_run_indicator(&rcl57);
+        if (is_run_indicator && !is_indicator_held)
+        {
+            is_indicator_held = scan57_publish_held(&run_codes, &run_masks);
+        }
+        else if (!is_run_indicator && is_indicator_held)
+        {
+            scan57_release();
+            is_indicator_held = false;
+        }
 
         // DEBUG press the 1/x key after 18500 cycles
         //if (num_cycles > 18500 && num_cycles < 18600)
         //{
-        //      ti57.is_key_pressed = true;
-        //      ti57.col = 5;
-        //      ti57.row = 2;       // this is 1/x which will cause error displey
+        //      ti57->is_key_pressed = true;
+        //      ti57->col = 5;
+        //      ti57->row = 2;       // this is 1/x which will cause error displey
         //}
 
         /* check if display action is required */
-        if (ti57.display_update == true)
+        if (ti57->display_update == true)
         {
-            /* DEBUG dump the display to USART1 - this increases the display cycle duration!! */
-            //UU_PutString(USART1, mux57_display_to_str(ti57.dA, ti57.dB));
+            /* send the display if it changed, and the cycle count every
+               second, then whatever is left in the telemetry buffer */
+            tele57_display(ti57->dA, ti57->dB);
+            tele57_cycles(num_cycles);
+            tele57_poll();
+
+#if RCL57_USART_COMMANDS
+            /* execute the commands received from the host */
+            cmd57_poll(&rcl57, num_cycles);
+#endif
 
             /* The TI-57 ROM always issues 2x DISP instructions due to
                original hardware limitations. Here, the first DISP will check
                the flag, which is not set, and then in this display update
                sequence the flag will be set/clear depending on K inputs. The
                second DISP will catch the flag and process it. */
-            ti57.is_key_pressed = false;
+            ti57->is_key_pressed = false;
+
+            /* hand the display over to the SysTick scan ISR. If the frame
+               changed and the frame of the previous DISP has not been picked
+               up yet, sleep until it is: this paces changing frames to one
+               per 6.4ms display cycle, as on the TI-57. An unchanged frame
+               is only retained by the ISR, so that DISP just reads the
+               keyboard, as it does in RUN mode with the run indicator. The
+               pace of key polling is kept by the speed profile */
+            if (is_run_indicator == false)
+            {
+                PROF57_BEGIN(prof_mark);
+                while (scan57_publish(&ti57->dA, &ti57->dB) == false)
+                    hal57_wait_for_interrupt();
+                PROF57_END(prof_mark, PROF57_IDLE);
+            }
 
-            /* do the 6.4ms display cycle, collect keyboard scan codes */
-            scancode = hw_display_cycle(ti57.dA, ti57.dB);
+            /* write the next changed EEPROM page, if any */
+            storage57_poll();
+
+            /* take at most one key event per DISP, so that the TI-57 sees
+               every press even if it is released before the next DISP.
+               'scancode' holds the key held down since its press event.
+               Keys injected by the host come after those of the keypad */
+            rcode = kbd57_get_event(&key_event);
+#if RCL57_USART_COMMANDS
+            if (rcode == false)
+                rcode = cmd57_get_event(&key_event);
+#endif
+            if (rcode)
+            {
+                /* report the event, ADC faults included */
+                tele57_key(key_event.scancode, key_event.is_press);
+
+                if (key_event.scancode == KBD57_FAULT)
+                {
+                    /* not a key */
+                }
+                /* if 2ND+INV+CLR is pressed, enter PROGRAM MANAGER */
+                else if (key_event.is_press && kbd57_is_chord(chord_progman, sizeof(chord_progman)))
+                {
+                    scancode = 0;
+                    //mode_progman();
+                }
+                /* if 2ND+INV+digit is pressed, change the speed profile or
+                   an option, and append them to the status journal */
+                else if (key_event.is_press && ((setting = settings_chord(key_event.scancode)) >= 0))
+                {
+                    scancode = 0;
+                    if (setting < SETTINGS_SPEEDS)
+                        sched57_set_speed((sched57_speed_t)setting);
+                    else
+                        rcl57.options ^= 1 << (setting - SETTINGS_SPEEDS);
+                    addon57_set_options(&ee_status_shadow, rcl57.options, sched57_get_speed());
+                }
+                else if (key_event.is_press)
+                    scancode = key_event.scancode;
+                else if (key_event.scancode == scancode)
+                    scancode = 0;
+
+                /* clear the idle keyboard counter. A fault is not keyboard
+                   activity: a stuck ADC must not keep the calculator out
+                   of power save */
+                if (key_event.scancode != KBD57_FAULT)
+                    idle_disp_cycles = 0;
+            }
 
-            /* increment the idle keyboard cycle counter if no keys detected */
+            /* increment the idle keyboard cycle counter if no keys are held */
             if (scancode == 0)
             {
                 idle_disp_cycles += 1;
             }
-            /* if any single keys were pressed during this display cycle,
-               copy the keypress information into ti57 structure and let
-                           the TI-57 emulation take care of what to do */
-            else if (scancode < 0x8F)
+            /* while a key is held, copy the keypress information into ti57
+               structure and let the TI-57 emulation take care of what to do */
+            else
             {
-                /* DEBUG dump keypress row,col to UART */
-                UU_PutChar(USART1, '#');
-                UU_PutHexByte(USART1, scancode);
-
                 /* copy row and column info to ti57 structure */
-                ti57.row = scancode >> 4;
-                ti57.col = scancode & 0x0F;
-                ti57.is_key_pressed = true;
+                ti57->row = scancode >> 4;
+                ti57->col = scancode & 0x0F;
+                ti57->is_key_pressed = true;
 
                 /* clear the idle keyboard counter */
                 idle_disp_cycles = 0;
             }
-            /* if 2ND+INV+CLR is pressed, enter PROGRAM MANAGER */
-            else if (scancode == SCANCODE_PROGMAN_ENTRY)
-            {
-                idle_disp_cycles = 0;       // clear the idle keyboard counter
-                scancode = 0;
-                //mode_progman();
-            }
-            else if (scancode == 0xFF)
-                UU_PutString(USART1, ":ADCfault");
 
             /* has the keyboard been idle too long? if so, go to powersave */
             if (idle_disp_cycles > PSAVE_ENTRY_IDLE_DISP_CYCLES)
             {
+                /* save the calculator state, so that it resumes from here
+                   if the power is lost during power save */
+                storage57_save_snapshot(ti57);
+                storage57_flush();
+
+                /* powersave drives the display itself - let the scan ISR finish first */
+                scan57_release();
+                while (scan57_is_idle() == false)
+                    hal57_wait_for_interrupt();
                 addon57_powersave();
+                storage57_invalidate_snapshot();
                 idle_disp_cycles = 0;       // clear the idle keyboard counter
                 scancode = 0;
             }
         }
-
-        /* wait for remainder of SysTick interval in SLEEP mode */
-        __WFI();
     }
 }
 
 
-/* STM32F103 GPIO Initialization */
-void InitGPIO()
-{
-    GPIO_InitTypeDef GPIO_InitStructure;
-
-    /* GPIO are all on APB2 */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOC, ENABLE);
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOB, ENABLE);
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_GPIOA, ENABLE);
-
-    /* enable the AFIO to allow remaps as well */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_AFIO, ENABLE);
-
-    /* configure C13 and C14 as GPIO output pins */
-    /* Blue Pill Debug pins! LED on C13 (0 = lit) */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_13 | GPIO_Pin_14;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
-    GPIO_Init(GPIOC, &GPIO_InitStructure);
-
-    /* GPIO Configuration for RCL-57 Emulator PCB V2*/
-
-    /* Configure PA0-PA4 as analog inputs */
-    /* These are the K1,K2,K3,K4,K5 keypad column input lines */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0 | GPIO_Pin_1 | GPIO_Pin_2 | GPIO_Pin_3 | GPIO_Pin_4;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AIN;
-    GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-    /* Configure PA5-12 as PP outputs*/
-    /* These are the D,A,B,C,E,F,G,P segment control outputs --> init to 1 */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8
-                                  | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
-    GPIO_Init(GPIOA, &GPIO_InitStructure);
-    GPIO_SetBits(GPIOA, GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8
-                 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12);
-
-    /* configure A15 as GPIO output */
-    /* This is TLC5925 LATCH control output --> init to 0 */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_15;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
-    GPIO_Init(GPIOA, &GPIO_InitStructure);
-
-    /* Configure PB0 as OD GPIO */
-    /* This is 11AA080 UNI/O signal input-output with 47K pullup */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_0;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;
-    GPIO_Init(GPIOB, &GPIO_InitStructure);
-    GPIO_ResetBits(GPIOB, GPIO_Pin_0);
-
-    /* Configure PB4 as OD GPIO */
-    /* This is a 'direct drive' for digit #12 cathode */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_4;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_OD;
-    GPIO_Init(GPIOB, &GPIO_InitStructure);
-    GPIO_SetBits(GPIOB, GPIO_Pin_4);
-
-    /* Configure PB3 and PB5 as PP GPIO */
-    /* These are TLC5925 SCLK and SDATA outputs, respectively */
-    /* Step 1 - disable JTAG interface (uses PB3) */
-    GPIO_PinRemapConfig(GPIO_Remap_SWJ_JTAGDisable, ENABLE);
-    /* Step 2 - Release PB3/TRACESWO and PB4/NJTRST from control of the
-    debug port so they can be used as GPIO pins. This info was
-    well-hidden in an ST forum posting. */
-    DBGMCU->CR &= ~DBGMCU_CR_TRACE_IOEN;
-    RCC->APB2ENR |= RCC_APB2ENR_AFIOEN;
-    AFIO->MAPR |= AFIO_MAPR_SWJ_CFG_JTAGDISABLE;
-    /* Step 3 - Enable SPI remap to RB3/RB5*/
-    GPIO_PinRemapConfig(GPIO_Remap_SPI1, ENABLE);
-    /* Step 4 - Configure PB3 and PB5 as AF GPIO */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_3 | GPIO_Pin_5;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
-    GPIO_Init(GPIOB, &GPIO_InitStructure);
-
-    /* configure PB6 as USART1 TXD and PB7 as output */
-    /* These are brought out to debug header on V2 PCB */
-    /* configure PB6 as AF GPIO */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_6;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_AF_PP;
-    GPIO_Init(GPIOB, &GPIO_InitStructure);
-    /* Remap USART1 to PB6 */
-    GPIO_PinRemapConfig(GPIO_Remap_USART1, ENABLE);
-
-    /* configure PB7 as GPIO output */
-    /* this could be USART1 RXD if needed */
-    GPIO_InitStructure.GPIO_Pin = GPIO_Pin_7;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_10MHz;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
-    GPIO_Init(GPIOB, &GPIO_InitStructure);
-}
-
-/* STM32F103 USART1 initialization */
-void InitUSART()
-{
-    USART_InitTypeDef USART_InitStructure;
-
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_USART1, ENABLE);
-
-    /* 230400 bps, 8N1, no flow control, TX only */
-    USART_InitStructure.USART_BaudRate = 230400;
-    USART_InitStructure.USART_WordLength = USART_WordLength_8b;
-    USART_InitStructure.USART_StopBits = USART_StopBits_1;
-    USART_InitStructure.USART_Parity = USART_Parity_No;
-    USART_InitStructure.USART_HardwareFlowControl = USART_HardwareFlowControl_None;
-    USART_InitStructure.USART_Mode = USART_Mode_Tx;
-
-    USART_Init(USART1, &USART_InitStructure);
-    USART_Cmd(USART1, ENABLE);
-}
-
-/* STM32F103 TIM3 Initialization */
-void InitTIM3()
-{
-    TIM_TimeBaseInitTypeDef TimeBaseInitStructure;
-
-    /* Enable the TIM3 clock.   */
-    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM3, ENABLE);
-
-    /* De-init TIM3 to get it back to default values */
-    TIM_DeInit(TIM3);
-
-    /* Init the TimeBaseInitStructure with 1us/tick values */
-    TimeBaseInitStructure.TIM_Prescaler = (SystemCoreClock / 1000000) - 1;
-    TimeBaseInitStructure.TIM_CounterMode = TIM_CounterMode_Up;
-    TimeBaseInitStructure.TIM_Period = 100;
-    TIM_TimeBaseInit(TIM3, &TimeBaseInitStructure);
-    TIM_SelectOnePulseMode(TIM3, TIM_OPMode_Single);
-}
-
-/* Initialize the STM32F103 SPI peripheral */
-void InitSPI(void)
-{
-    SPI_InitTypeDef  SPI_InitStructure;
-
-    /* enable the SPI1 peripheral clock */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_SPI1, ENABLE);
-
-    /* Load SPI1 InitStructure with config options for CAT4016 */
-    SPI_InitStructure.SPI_Direction = SPI_Direction_2Lines_FullDuplex;
-    SPI_InitStructure.SPI_Mode = SPI_Mode_Master;
-
-    /* 8-bit data word, MODE = 00, MSB first */
-    SPI_InitStructure.SPI_DataSize = SPI_DataSize_8b;
-    SPI_InitStructure.SPI_CPOL = SPI_CPOL_Low;
-    SPI_InitStructure.SPI_CPHA = SPI_CPHA_1Edge;
-    SPI_InitStructure.SPI_FirstBit = SPI_FirstBit_MSB;
-
-    /* no hardware SS handling */
-    SPI_InitStructure.SPI_NSS = SPI_NSS_Soft;
-
-    /* SPI clock configuration APB2 clock / 8 */
-    SPI_InitStructure.SPI_BaudRatePrescaler = SPI_BaudRatePrescaler_8;
-
-    /* initialize and enable the SPI peripheral */
-    SPI_Init(SPI1, &SPI_InitStructure);
-    SPI_Cmd(SPI1, ENABLE);
-}
-
-void InitADC(void)
+/* SysTick interrupt handler - for Delay() function, display scan and instruction budget */
+void SysTick_Handler(void)
 {
-    ADC_InitTypeDef ADC_InitStructure;
-
-    /* Enable the ADC clock.   */
-    RCC_APB2PeriphClockCmd(RCC_APB2Periph_ADC1, ENABLE);
-
-    /* Set the ADC clock prescalar to div-2 (12 MHz) */
-    RCC_ADCCLKConfig(RCC_PCLK2_Div2);
-
-    /* ADC1 configuration ------------------------------------------------------*/
-    ADC_InitStructure.ADC_Mode = ADC_Mode_Independent;
-    ADC_InitStructure.ADC_ScanConvMode = ENABLE;
-    ADC_InitStructure.ADC_ContinuousConvMode = DISABLE;
-    ADC_InitStructure.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
-    ADC_InitStructure.ADC_DataAlign = ADC_DataAlign_Right;
-    ADC_InitStructure.ADC_NbrOfChannel = 1;
-    ADC_Init(ADC1, &ADC_InitStructure);
-
-    /* ADC1 regular channel 1 configuration */
-    ADC_RegularChannelConfig(ADC1, ADC_Channel_0, 1, ADC_SampleTime_41Cycles5);
-
-    /* Set injected sequencer length */
-    ADC_InjectedSequencerLengthConfig(ADC1, 4);
-
-    /* ADC1 injected channel Configuration */
-    ADC_InjectedChannelConfig(ADC1, ADC_Channel_1, 1, ADC_SampleTime_41Cycles5);
-    ADC_InjectedChannelConfig(ADC1, ADC_Channel_2, 2, ADC_SampleTime_41Cycles5);
-    ADC_InjectedChannelConfig(ADC1, ADC_Channel_3, 3, ADC_SampleTime_41Cycles5);
-    ADC_InjectedChannelConfig(ADC1, ADC_Channel_4, 4, ADC_SampleTime_41Cycles5);
-
-    /* ADC1 injected external trigger configuration */
-    ADC_ExternalTrigInjectedConvConfig(ADC1, ADC_ExternalTrigInjecConv_None);
-
-    /* Enable injected external trigger conversion on ADC1 */
-    ADC_ExternalTrigInjectedConvCmd(ADC1, ENABLE);
-
-    /* Enable ADC1 */
-    ADC_Cmd(ADC1, ENABLE);
+    prof57_mark_t handler_mark, scan_mark;
 
-    /* Enable ADC1 reset calibration register */
-    ADC_ResetCalibration(ADC1);
-    /* Check the end of ADC1 reset calibration register */
-    while (ADC_GetResetCalibrationStatus(ADC1));
+    PROF57_BEGIN(handler_mark);
 
-    /* Start ADC1 calibration */
-    ADC_StartCalibration(ADC1);
-    /* Check the end of ADC1 calibration */
-    while (ADC_GetCalibrationStatus(ADC1));
-}
-
-/* configure the SysTick timer for correct period */
-void InitSysTick()
-{
-    SysTick_Config(SystemCoreClock / SYSTICK_TIMER_FREQ);
-}
-
-/* SysTick interrupt handler - for Delay() function */
-void SysTick_Handler(void)
-{
     if (TimingDelay != 0x00)
     {
         TimingDelay--;
     }
 
+    /* advance the key event time, and the display and keyboard scan */
+    kbd57_tick();
+    PROF57_BEGIN(scan_mark);
+    scan57_tick();
+    PROF57_END(scan_mark, PROF57_SCAN);
+
+    /* credit one SysTick period to the instruction budget */
+    sched57_tick();
+
+    /* advance the telemetry time, and the profile frame */
+    tele57_tick();
+    PROF57_TICK();
+
+    PROF57_END(handler_mark, PROF57_SYSTICK);
 }
 
 /* simple Delay function, in SysTick increments */
-void Delay(__IO uint32_t nTime)
+void Delay(volatile uint32_t nTime)
 {
     TimingDelay = nTime;
-    while (TimingDelay != 0);
+    while (TimingDelay != 0)
+        hal57_wait_for_interrupt();
 }
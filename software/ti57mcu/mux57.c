@@ -20,9 +20,9 @@ OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 
 #include "mux57.h"
-#include "stm32f10x.h"
 #include "rcl57mcu.h"
-#include "usart_utilities.h"
+#include "hal57.h"
+#include "scan57.h"
 
 /* Multiplex LED and keyboard support for RCL-57 retrofit PCB V2 */
 /* https://hackaday.io/project/194963 */
@@ -35,15 +35,6 @@ void hw_digit_driver_send_word(uint8_t r, uint16_t d);
 /* raw keyboard K1-K5 data for each row */
 static uint8_t raw_keyboard_inputs[8];
 
-/* determine key scancode from K1-K5 inputs and specified segment */
-uint8_t hw_read_keyboard_row(uint8_t seg);
-
-/* determine key scancode from K1-K5 ADC results and specified segment */
-uint8_t hw_read_keyboard_adc_row(uint8_t seg);
-
-/* return the "raw" K1-K5 key column inputs obtained during hw_display_cycle */
-uint8_t hw_raw_keyboard_row(uint8_t s);
-
 /* Private data */
 
 /* map of segments required for each of the LED characters */
@@ -174,7 +165,7 @@ void mux57_paint_digits(const uint8_t* ins, display_data_t* digits, display_data
 /* convert array of digit and mask codes to null-terminated string */
 uint8_t* mux57_display_to_str(display_data_t* digits, display_data_t* mask)
 {
-    const uint8_t DIGITS[] = "0123456789AbCdEFGHJLnoPrtUY'].- ";
+    static const uint8_t DIGITS[] = "0123456789AbCdEFGHJLnoPrtUY'].- ";
     static uint8_t str[25];
     int16_t k = 0;
 
@@ -368,7 +359,7 @@ uint8_t hw_display_cycle(display_data_t* digits, display_data_t* mask)
     DIRECT_D12_OFF;
 
     /* Wait for SysTick to start segment scan sequence */
-    //__WFI();
+    //hal57_wait_for_interrupt();
 
     /* loop through the 8 segments, 800us per segment */
     for (segment = 0; segment < 8; segment++)
@@ -388,7 +379,7 @@ uint8_t hw_display_cycle(display_data_t* digits, display_data_t* mask)
 
             /* give time for the LED segment in selected digit(s) to illuminate */
             for (int u = SEGMENT_ACTIVE_TICKS; u > 0; u--)
-                __WFI();
+                hal57_wait_for_interrupt();
 
             /* read this segment's keyboard scancode. Save it if no scancode already held */
             if (scancode == 0)
@@ -404,8 +395,8 @@ uint8_t hw_display_cycle(display_data_t* digits, display_data_t* mask)
             hw_segment_enable(segment);
 
             /* wait for 2 ticks (100us) with the segment driver active */
-            __WFI();
-            __WFI();
+            hal57_wait_for_interrupt();
+            hal57_wait_for_interrupt();
 
             /* read this segment's keyboard scancode. Save it if no scancode already held */
             if (scancode == 0)
@@ -416,7 +407,7 @@ uint8_t hw_display_cycle(display_data_t* digits, display_data_t* mask)
 
             /* wait for all but 2 of SEGMENT ACTIVE TICKS with segment deactivated */
             for (int u = SEGMENT_ACTIVE_TICKS - 2; u > 0; u--)
-                __WFI();
+                hal57_wait_for_interrupt();
         }
 
         /* determine which digit pattern to preload for next segment */
@@ -431,7 +422,7 @@ uint8_t hw_display_cycle(display_data_t* digits, display_data_t* mask)
 
         /* wait for remainder of segment interval */
         for (int u = SEGMENT_INACTIVE_TICKS; u > 0; u--)
-            __WFI();
+            hal57_wait_for_interrupt();
     }
 
     /* disable all segment drive outputs - just in case */
@@ -455,7 +446,7 @@ uint8_t hw_display_char_d12(uint8_t c)
     uint8_t scancode = 0; // keyboard scancode
 
     /* Wait for SysTick to start segment scan sequence */
-    __WFI();
+    hal57_wait_for_interrupt();
 
     /* loop through the 8 segments, 800us per segment */
     for (segment = 0; segment < 8; segment++)
@@ -478,7 +469,7 @@ uint8_t hw_display_char_d12(uint8_t c)
 
             /* allow the LED segment in selected digit(s) to illuminate */
             for (uint8_t u = SEGMENT_ACTIVE_TICKS; u > 0; u--)
-                __WFI();
+                hal57_wait_for_interrupt();
 
             /* read this segment's keyboard scancode. Save it if no scancode already held */
             if (scancode == 0)
@@ -491,8 +482,8 @@ uint8_t hw_display_char_d12(uint8_t c)
             /* case 2: segment not illuminuated in digit 12 - drive for 100us only (for key read)*/
         {
             /* wait for 2 ticks (100us) with the segment driver active */
-            __WFI();
-            __WFI();
+            hal57_wait_for_interrupt();
+            hal57_wait_for_interrupt();
 
             /* read this segment's keyboard scancode. Save it if no scancode already held */
             if (scancode == 0)
@@ -503,7 +494,7 @@ uint8_t hw_display_char_d12(uint8_t c)
 
             /* wait out the remainder of SEGMENT ACTIVE TICKS with segment deactivated */
             for (uint8_t u = SEGMENT_ACTIVE_TICKS - 2; u > 0; u--)
-                __WFI();
+                hal57_wait_for_interrupt();
 
         }
     }
@@ -521,16 +512,22 @@ uint8_t hw_display_char_d12(uint8_t c)
 void mux57_splash(const uint8_t* ins, uint32_t n)
 {
     display_data_t codes, masks;
+    uint32_t start;
 
     /* paint the string to the codes and masks arrays */
-    mux57_paint_digits(ins, codes, masks);
-
-    for (uint32_t i = n; i > 0; --i)
-    {
-        DEBUG_TICK_ON;
-        hw_display_cycle(codes, masks);
-        DEBUG_TICK_OFF;
-    }
+    mux57_paint_digits(ins, &codes, &masks);
+
+    /* hold the frame for n display cycles */
+    while (scan57_publish_held(&codes, &masks) == false)
+        hal57_wait_for_interrupt();
+    start = scan57_get_frame_count();
+    while (scan57_get_frame_count() - start < n)
+        hal57_wait_for_interrupt();
+
+    /* wait for the last frame to be scanned */
+    scan57_release();
+    while (scan57_is_idle() == false)
+        hal57_wait_for_interrupt();
 }
 
 
@@ -538,66 +535,30 @@ void mux57_splash(const uint8_t* ins, uint32_t n)
 /* Segment driver specific functions */
 /*************************************/
 
-/* disable all segment drive outputs (drive high to turn off PMOS gate)
-   !!MCU GPIO assignment dependent - PCB V2 here!! */
+/* disable all segment drive outputs (drive high to turn off PMOS gate) */
 void hw_segment_disable_all(void)
 {
-    GPIOA->BSRR = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12;
+    hal57_segment_disable_all();
 }
 
-/* enable all segment drive outputs (drive low to turn on PMOS gate)
-   !!MCU GPIO assignment dependent - PCB V2 here!! */
+/* enable all segment drive outputs (drive low to turn on PMOS gate) */
 void hw_segment_enable_all(void)
 {
-    GPIOA->BRR = GPIO_Pin_5 | GPIO_Pin_6 | GPIO_Pin_7 | GPIO_Pin_8 | GPIO_Pin_9 | GPIO_Pin_10 | GPIO_Pin_11 | GPIO_Pin_12;
+    hal57_segment_enable_all();
 }
 
 /* enable one specific segment output, 0-7 -->
  *   SEG # --  0   1   2   3   4   5   6   7
- *   LED   --  E   F   B   G   C   A   D   DP
-  !! MCU GPIO assignment dependent - PCB V2 !! */
+ *   LED   --  E   F   B   G   C   A   D   DP */
 void hw_segment_enable(uint8_t s)
 {
-    switch (s)
-    {
-    case 0:
-        GPIOA->BRR = GPIO_Pin_9;
-        break;      //e
-    case 1:
-        GPIOA->BRR = GPIO_Pin_10;
-        break;      //f
-    case 2:
-        GPIOA->BRR = GPIO_Pin_7;
-        break;      //b
-    case 3:
-        GPIOA->BRR = GPIO_Pin_11;
-        break;      //g
-    case 4:
-        GPIOA->BRR = GPIO_Pin_8;
-        break;      //c
-    case 5:
-        GPIOA->BRR = GPIO_Pin_6;
-        break;      //a
-    case 6:
-        GPIOA->BRR = GPIO_Pin_5;
-        break;      //d
-    case 7:
-        GPIOA->BRR = GPIO_Pin_12;
-        break;      //dp
-    }
+    hal57_segment_enable(s);
 }
 
 /*******************************************/
 /* TLC5929 Digit Driver specific functions */
 /*******************************************/
 
-/* reset the TLC5929 digit driver LATCH signal */
-void hw_digit_driver_reset(void)
-{
-    /* Negate LATCH */
-    GPIOA->BRR = GPIO_Pin_15;
-}
-
 /* Initialize the TLC5929 digit driver IC by turning all outputs off,
  *  setting Global Brightness level to 50%, and enabling Power Save */
 void hw_digit_driver_initialize(void)
@@ -612,7 +573,7 @@ void hw_digit_driver_initialize(void)
  * table to attempt to make the brightness steps more linear */
 void hw_digit_driver_intensity(uint8_t i)
 {
-    unsigned const char DIMMING[16] =
+    static const unsigned char DIMMING[16] =
     {
         5,    9,  12,  18,  23,  31,  38,  44,
         51,  58,  67,  76,  86,  96, 109, 127
@@ -625,32 +586,18 @@ void hw_digit_driver_intensity(uint8_t i)
 /* send output data to the TLC5929 */
 void hw_digit_driver_send_word(uint8_t r, uint16_t d)
 {
-    /* Enable the SPI interface */
-    SPI_Cmd(SPI1, ENABLE);
-
     /* send bits 23-16 -- only bit 16 is held by TLC5929 */
-    SPI_I2S_SendData(SPI1, r);
-    while (SPI_I2S_GetFlagStatus(SPI1, SPI_I2S_FLAG_BSY));
+    hal57_digit_driver_shift(r);
     /* send bits 15-8 */
-    SPI_I2S_SendData(SPI1, (d >> 8) & 0xff);
-    while (SPI_I2S_GetFlagStatus(SPI1, SPI_I2S_FLAG_BSY));
+    hal57_digit_driver_shift((d >> 8) & 0xff);
     /* send bits 7-0 */
-    SPI_I2S_SendData(SPI1, (d & 0xff));
-    while (SPI_I2S_GetFlagStatus(SPI1, SPI_I2S_FLAG_BSY));
-
-    /* Disable the SPI interface */
-    SPI_Cmd(SPI1, ENABLE);
+    hal57_digit_driver_shift(d & 0xff);
 }
 
 /* Update the TLC5929 driver outputs by toggling the LATCH signal */
 void hw_digit_driver_update(void)
 {
-    /* Assert LATCH */
-    GPIOA->BSRR = GPIO_Pin_15;
-    /* delay for some uncritical hold time before negating LATCH */
-    __NOP();
-    __NOP();
-    GPIOA->BRR = GPIO_Pin_15;
+    hal57_digit_driver_latch();
 }
 
 /* Shift a serial word into the TLC5929 output driver register */
@@ -659,12 +606,17 @@ void hw_digit_driver_load(uint16_t d)
     hw_digit_driver_send_word(0, d);
 }
 
+/* Start shifting a serial word into the TLC5929 by DMA */
+void hw_digit_driver_stream(const uint8_t word[3])
+{
+    hal57_digit_driver_stream(word, 3);
+}
+
 /*******************************/
 /* Keyboard specific functions */
 /*******************************/
 
 #define COLUMN_ADC_THRESHOLD (3000U)
-#define ADC_EOC_TIMEOUT (1000U)
 #define ADC_ERROR_CODE (0xFF)
 
 /* encode the K1-K5 key column ADC results and active segment into a scancode */
@@ -673,63 +625,23 @@ uint8_t hw_read_keyboard_adc_row(uint8_t seg)
     uint8_t code = 0;
     uint8_t kb_row = 0;
     uint8_t kb_col = 0;
-    uint16_t k_result;
-    uint16_t adc_timeout;
-
-    /* Enable the ADC */
-    ADC_Cmd(ADC1, ENABLE);
+    uint16_t k_results[5];
 
     /* clear "raw data" in this segment's row */
     raw_keyboard_inputs[seg & 0x7] = 0;
 
-    /* Start ADC "Regular Conversion" on CH0  */
-    ADC_SoftwareStartConvCmd(ADC1, ENABLE);
-    /* Start ADC "Injected Conversion Sequence" on CH1-4  */
-    ADC_SoftwareStartInjectedConvCmd(ADC1, ENABLE);
-
-    /* wait for both normal and injected conversions to complete */
-    for (adc_timeout = ADC_EOC_TIMEOUT; adc_timeout > 0; --adc_timeout)
-    {
-        if ((ADC1->SR & ADC_SR_EOC) && (ADC1->SR & ADC_SR_JEOC))
-            break;
-    }
-    /* if conversion did not complete, return an error code */
-    if (adc_timeout == 0)
+    /* convert the K1-K5 inputs - if conversion did not complete, return an error code */
+    if (hal57_keyboard_adc(k_results) == false)
         return ADC_ERROR_CODE;
 
-    /* Clear the end-of-conversion flags */
-    ADC_ClearFlag(ADC1, ADC_FLAG_EOC);
-    ADC_ClearFlag(ADC1, ADC_FLAG_JEOC);
-
     /* iterate through results for columns 5-1 */
     for (uint8_t k = 5; k > 0; --k)
     {
         /* shift raw readings left to make room for new lsb */
         raw_keyboard_inputs[seg & 0x7] = raw_keyboard_inputs[seg & 0x7] << 1;
 
-        /* retrieve correct ADC result for a given column */
-        switch (k)
-        {
-        case 1:
-            k_result = ADC1->DR;
-            break;      //ADC DR holds 'K1'
-        case 2:
-            k_result = ADC1->JDR1;
-            break;      //ADC JDR1 holds 'K2'
-        case 3:
-            k_result = ADC1->JDR2;
-            break;      //ADC JDR2 holds 'K3'
-        case 4:
-            k_result = ADC1->JDR3;
-            break;      //ADC JDR3 holds 'K4'
-        case 5:
-        default:
-            k_result = ADC1->JDR4;
-            break;      //ADC JDR1 holds 'K5'
-        }
-
         /* if the ADC results exceeds a threshold, keyswitch in that column is closed */
-        if (k_result > COLUMN_ADC_THRESHOLD)
+        if (k_results[k - 1] > COLUMN_ADC_THRESHOLD)
         {
             /* set bit for column in "raw reading" */
             raw_keyboard_inputs[seg & 0x7] |= 1;
@@ -740,15 +652,39 @@ uint8_t hw_read_keyboard_adc_row(uint8_t seg)
         }
     }
 
-    /* Disable the ADC */
-    ADC_Cmd(ADC1, DISABLE);
-
     /* code will be 0 (no key) or a key scancode (11..85) or an ADC error (FF) */
     code = ((kb_row << 4) | kb_col);
     return code;
 }
 
 
+/* K1-K5 ADC results of the conversion started by hw_start_keyboard_adc() */
+static volatile uint16_t adc_results[5];
+
+/* start converting the K1-K5 key column inputs, without waiting */
+void hw_start_keyboard_adc(void)
+{
+    hal57_keyboard_adc_start(adc_results);
+}
+
+/* K1-K5 key columns closed (K1 in bit 0) according to the conversion
+   started by hw_start_keyboard_adc(), or -1 if it has not completed */
+int16_t hw_get_keyboard_adc_columns(void)
+{
+    int16_t columns = 0;
+
+    if (hal57_keyboard_adc_done() == false)
+        return -1;
+
+    for (uint8_t k = 5; k > 0; --k)
+    {
+        columns = columns << 1;
+        if (adc_results[k - 1] > COLUMN_ADC_THRESHOLD)
+            columns |= 1;
+    }
+    return columns;
+}
+
 /* encode the K1-K5 key column inputs and active segment into a scancode */
 uint8_t hw_read_keyboard_row(uint8_t s)
 {
@@ -758,7 +694,7 @@ uint8_t hw_read_keyboard_row(uint8_t s)
     uint16_t k_inputs;
 
     /* read the K1-K5 switch inputs */
-    k_inputs = (GPIO_ReadInputData(GPIOA) & 0x001f);
+    k_inputs = hal57_keyboard_inputs();
 
     /* save to "raw data" array */
     raw_keyboard_inputs[s & 0x7] = k_inputs;
@@ -801,13 +737,13 @@ void hw_wait_for_key_release(uint32_t t)
     uint16_t k_inputs;
 
     /* get an initial read of key inputs */
-    k_inputs = (GPIO_ReadInputData(GPIOA) & 0x001f);
+    k_inputs = hal57_keyboard_inputs();
     count = t;
 
     while ((k_inputs != 0) || (count > 0))
     {
         Delay(10000 / 50);
-        k_inputs = (GPIO_ReadInputData(GPIOA) & 0x001f);
+        k_inputs = hal57_keyboard_inputs();
         if (k_inputs == 0)
             count = count - 1;
         else
@@ -125,16 +125,35 @@ uint8_t hw_display_cycle(display_data_t* digits, display_data_t* mask);
 /** do a complete display cycle of a single character at digit 12 and return key scancode */
 uint8_t hw_display_char_d12(uint8_t c);
 
+/** return the "raw" K1-K5 key column inputs of segment s, from the last row read */
+uint8_t hw_raw_keyboard_row(uint8_t s);
+
+/** encode the K1-K5 key column ADC results and segment seg into a scancode */
+uint8_t hw_read_keyboard_adc_row(uint8_t seg);
+
+/** start converting the K1-K5 key column inputs, without waiting */
+void hw_start_keyboard_adc(void);
+
+/** K1-K5 key columns closed (K1 in bit 0) according to the conversion
+    started by hw_start_keyboard_adc(), or -1 if it has not completed */
+int16_t hw_get_keyboard_adc_columns(void);
+
+/** encode the K1-K5 key column digital inputs and segment s into a scancode */
+uint8_t hw_read_keyboard_row(uint8_t s);
+
 /** wait for key release - t * 10ms "debounce" */
 void hw_wait_for_key_release(uint32_t t);
 
 /* convert null-terminated string to arrays of display digit and mask codes */
 void mux57_paint_digits(const uint8_t* ins, display_data_t* digits, display_data_t* mask);
 
+/* TLC5929 output word for segment s of the display described by digits and mask */
+uint16_t mux57_which_outputs(display_data_t* digits, display_data_t* mask, uint8_t s);
+
 /* convert digit display and mask codes to null-terminated string */
 uint8_t* mux57_display_to_str(display_data_t* digits, display_data_t* mask);
 
-/* display a string to LED for n-display cycles */
+/* display a string to LED for n-display cycles (uses scan57) */
 void mux57_splash(const uint8_t* ins, unsigned int n);
 
 /**************************************************/
@@ -176,6 +195,10 @@ void hw_digit_driver_initialize(void);
 /** Shift a serial word into the TLC5929 output driver register */
 void hw_digit_driver_load(uint16_t d);
 
+/** Start shifting a serial word, as 3 bytes (bit 16 in word[0]), into
+ *  the TLC5929 by DMA - the word must stay unchanged until latched */
+void hw_digit_driver_stream(const uint8_t word[3]);
+
 /** Shift a serial word into the TLC5929 configuration register */
 void hw_digit_driver_config(uint16_t d);
 
@@ -0,0 +1,117 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#include "prof57.h"
+#include "rcl57mcu.h"
+#include "hal57.h"
+
+/* Cycle counter profiling of the firmware subsystems */
+/* https://hackaday.io/project/194963 */
+
+#define FRAME_TICKS (PROF57_FRAME_US / SYSTICK_PERIOD_US)
+
+/* Private data - each total written by the context that ends its section */
+
+static volatile bool is_on = false;
+static volatile uint32_t nested = 0;        // cycles charged to all sections
+static volatile uint32_t totals[PROF57_SECTION_COUNT];
+
+/* Private data - only used by the SysTick ISR while profiling */
+
+static uint8_t ticks;
+static uint32_t frame_start;                // cycle count at the start of the frame
+static uint32_t frame_totals[PROF57_SECTION_COUNT];    // totals at the start of the frame
+static prof57_stats_t stats[PROF57_SECTION_COUNT];
+
+void prof57_start(void)
+{
+    prof57_stop();
+    hal57_cycle_counter(true);
+    for (uint8_t s = 0; s < PROF57_SECTION_COUNT; s++)
+    {
+        frame_totals[s] = totals[s];
+        stats[s].frames = 0;
+        stats[s].min = UINT32_MAX;
+        stats[s].max = 0;
+        stats[s].total = 0;
+    }
+    ticks = 0;
+    frame_start = hal57_cycle_count();
+    is_on = true;
+}
+
+void prof57_stop(void)
+{
+    is_on = false;
+    hal57_cycle_counter(false);
+}
+
+/* close the frame every FRAME_TICKS */
+void prof57_tick(void)
+{
+    uint32_t now, cycles;
+
+    if (!is_on || ++ticks < FRAME_TICKS)
+        return;
+    ticks = 0;
+
+    now = hal57_cycle_count();
+    totals[PROF57_FRAME] += now - frame_start;
+    frame_start = now;
+
+    for (uint8_t s = 0; s < PROF57_SECTION_COUNT; s++)
+    {
+        cycles = totals[s] - frame_totals[s];
+        frame_totals[s] += cycles;
+        stats[s].frames += 1;
+        stats[s].total += cycles;
+        if (cycles < stats[s].min)
+            stats[s].min = cycles;
+        if (cycles > stats[s].max)
+            stats[s].max = cycles;
+    }
+}
+
+void prof57_begin(prof57_mark_t* mark)
+{
+    mark->nested = nested;
+    mark->start = hal57_cycle_count();
+}
+
+/* charge the cycles since the mark, less those charged meanwhile to the
+   sections that preempted or nested in this one */
+void prof57_end(prof57_mark_t* mark, prof57_section_t section)
+{
+    uint32_t cycles = hal57_cycle_count() - mark->start - (nested - mark->nested);
+
+    if (!is_on)
+        return;
+    totals[section] += cycles;
+    nested += cycles;
+}
+
+void prof57_get_stats(prof57_section_t section, prof57_stats_t* s)
+{
+    *s = stats[section];
+    if (s->frames == 0)
+        s->min = 0;
+}
@@ -0,0 +1,125 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#ifndef prof57_h
+#define prof57_h
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "rcl57mcu.h"
+
+
+/* Cycle counter profiling of the firmware subsystems */
+
+/* The sections of code that make up a subsystem are bracketed with
+   PROF57_BEGIN and PROF57_END, which read the MCU cycle counter (DWT
+   CYCCNT through hal57_cycle_count, a virtual counter in the board
+   simulator). A section is charged its own cycles only: those of the
+   sections that preempt or nest in it (an ISR in the emulation, the
+   keyboard in the display scan) are charged to them. Cycles outside of
+   any section - the rest of the main loop, exception entry and exit -
+   are only counted in PROF57_FRAME.
+
+   Counts are kept per frame of PROF57_FRAME_US, closed by the SysTick
+   ISR, into the min, max and total cycles per frame of each section.
+   Profiling runs between prof57_start and prof57_stop (the "prof"
+   commands of cmd57.h, which send the counts as TELE57_SECTION records).
+   Meanwhile the cycle counter also counts in WFI sleep (DBG_SLEEP), so
+   that idle time is measured, at some power cost. The cycles are those
+   of the core clock of the moment, which the clock governor (sched57.h)
+   changes: profile at a steady pace, or build without the governor, to
+   compare frames.
+
+   Each section is only ended from one context (foreground, SysTick or
+   TIM3), which alone writes its counts. The cycles charged to nested
+   sections are summed across contexts without masking the interrupts,
+   so a TIM3 interrupt that hits the few instructions where SysTick adds
+   to that sum is charged to the foreground section it preempted too. */
+
+/* sections, and the whole frame (PROF57_FRAME) */
+typedef enum
+{
+    PROF57_FRAME,       // every cycle of the frame
+    PROF57_EMULATION,   // rcl57_next
+    PROF57_SCAN,        // display scan (scan57_tick), keyboard excluded
+    PROF57_KEYBOARD,    // keyboard row conversion and debouncing
+    PROF57_UNIO,        // UNI/O engine (TIM3 ISR)
+    PROF57_SYSTICK,     // the rest of the SysTick ISR
+    PROF57_IDLE,        // WFI, waiting for the budget or the display scan
+    PROF57_SECTION_COUNT
+} prof57_section_t;
+
+/* profile frame: one display cycle */
+#define PROF57_FRAME_US (DISPLAY_PERIOD_US)
+
+/* sections are bracketed when built with PROF57_ENABLE, by default with
+   the command interface: only its "prof start" turns the profile on */
+#ifndef PROF57_ENABLE
+    #define PROF57_ENABLE (RCL57_USART_COMMANDS)
+#endif
+
+/* start of a section, kept by its caller */
+typedef struct
+{
+    uint32_t start;     // cycle count at the start
+    uint32_t nested;    // cycles charged to sections so far
+} prof57_mark_t;
+
+/* counts of a section over the frames profiled */
+typedef struct
+{
+    uint32_t frames;    // frames closed
+    uint32_t min;       // cycles per frame
+    uint32_t max;
+    uint32_t total;     // cycles of all the frames
+} prof57_stats_t;
+
+#if PROF57_ENABLE
+    #define PROF57_BEGIN(mark) prof57_begin(&(mark))
+    #define PROF57_END(mark, section) prof57_end(&(mark), (section))
+    #define PROF57_TICK() prof57_tick()
+#else
+    #define PROF57_BEGIN(mark) ((void)(mark))
+    #define PROF57_END(mark, section) ((void)(mark))
+    #define PROF57_TICK() ((void)0)
+#endif
+
+/* clear the counts, start the cycle counter and the first frame */
+void prof57_start(void);
+
+/* stop counting (the counts are kept for prof57_get_stats) */
+void prof57_stop(void);
+
+/* advance the time by one SysTick period, closing the frame when it is
+   over - call from the SysTick ISR */
+void prof57_tick(void);
+
+/* start a section */
+void prof57_begin(prof57_mark_t* mark);
+
+/* end a section started with mark, charging its cycles to section */
+void prof57_end(prof57_mark_t* mark, prof57_section_t section);
+
+/* counts of a section, or of the whole frames */
+void prof57_get_stats(prof57_section_t section, prof57_stats_t* stats);
+
+#endif /* prof57_h */
@@ -2,6 +2,7 @@
 #define rcl57mcu_h
 
 #include <stdint.h>
+#include "hal57.h"
 
 // choose which ROM to use - TI55 or TI57
 //#define TI55_ROM
@@ -11,25 +12,30 @@
 #define RCL57_PCB
 
 /*  Some macros to activate a debug pin, and the direct digit
-    #12 enable line (open drain output) */
-
-#ifdef RCL57_PCB
-    #define DEBUG_TICK_ON  do {GPIOB->BSRR = GPIO_Pin_7;} while (0)
-    #define DEBUG_TICK_OFF  do {GPIOB->BRR = GPIO_Pin_7;} while (0)
-#else
-    #define DEBUG_TICK_ON do {GPIOC->BSRR = GPIO_Pin_14;} while (0)
-    #define DEBUG_TICK_OFF do {GPIOC->BRR = GPIO_Pin_14;} while (0)
-#endif
+    #12 enable line (open drain output) - see hal57.h */
+
+#define DEBUG_TICK_ON  hal57_debug_pin(true)
+#define DEBUG_TICK_OFF hal57_debug_pin(false)
+
+#define DIRECT_D12_ON  hal57_direct_d12(true)
+#define DIRECT_D12_OFF hal57_direct_d12(false)
 
-#define DIRECT_D12_ON  do {GPIOB->BRR = GPIO_Pin_4;} while (0)
-#define DIRECT_D12_OFF do {GPIOB->BSRR = GPIO_Pin_4;} while (0)
+/*  Command interface on USART1 RXD (cmd57.h): remote key injection,
+    state dump and load, profiling. On the PCB RXD is PB7, so the debug
+    pin above is given up: off by default, so that DEBUG_TICK_ON/OFF
+    keep driving PB7 */
+
+#ifndef RCL57_USART_COMMANDS
+    #define RCL57_USART_COMMANDS (0)
+#endif
 
 /*  TMC1500 instruction period is 200us, and the DISPlay
     cycle is 32x longer, or 6.4ms. For this retrofit
-    I go for 4x the speed instruction rate of TI-57
-    but keep the display cycle duration the same to
+    the display cycle duration is kept the same to
     preserve the LED display characteristics and other
-    TI-57 ROM timing. */
+    TI-57 ROM timing. The display is scanned by the
+    SysTick ISR (scan57.c), and all other instructions
+    execute at the pace of the speed profile (sched57.c). */
 
 #define SYSTICK_PERIOD_US (50)
 #define SYSTICK_TIMER_FREQ (1000000 / SYSTICK_PERIOD_US)
@@ -40,8 +46,24 @@
 #define SEGMENT_ACTIVE_TICKS (SEGMENT_TICKS - SEGMENT_INACTIVE_TICKS)
 #define SECONDS_TO_USECS (1000000)
 
-#define SCANCODE_PROGMAN_ENTRY (0x99)
+/*  Speed profile (sched57.h) until changed in the EEPROM
+    status block: SCHED57_SPEED_1X, SCHED57_SPEED_4X or
+    SCHED57_SPEED_UNTHROTTLED */
+
+#ifndef RCL57_DEFAULT_SPEED
+    #define RCL57_DEFAULT_SPEED (SCHED57_SPEED_UNTHROTTLED)
+#endif
+
+/*  RCL57 options at power up (rcl57.h), until changed in the
+    EEPROM status block */
+
+#ifndef RCL57_DEFAULT_OPTIONS
+    #define RCL57_DEFAULT_OPTIONS (RCL57_QUICK_STOP_FLAG | RCL57_SHOW_RUN_INDICATOR_FLAG)
+#endif
+
 
+/* SysTick based delay, in SysTick periods (main.c) */
+void Delay(volatile uint32_t nTime);
 
 /* types used within rcl57mcu */
 
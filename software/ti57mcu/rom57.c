@@ -1,260 +0,0 @@
-#include "rom57.h"
-
-unsigned short ROM57[] = {
-    0x120f, 0x1122, 0x13f2, 0x1b8b, 0x0cae, 0x1808, 0x16b5, 0x15fc,
-    0x16ad, 0x1b8b, 0x1122, 0x0cae, 0x1ee7, 0x140c, 0x071e, 0x1a8e,
-    0x0a28, 0x05d9, 0x198b, 0x1947, 0x19f2, 0x193e, 0x1af3, 0x1b1b,
-    0x1a04, 0x0cae, 0x1da3, 0x1124, 0x19f8, 0x1122, 0x1602, 0x1b8b,
-    0x1122, 0x163c, 0x1b8b, 0x180a, 0x18f8, 0x0cae, 0x1d0a, 0x1124,
-    0x0c72, 0x0c7d, 0x1e4b, 0x0c7a, 0x1f8a, 0x0da7, 0x0c70, 0x1a4b,
-    0x0fe1, 0x1a77, 0x189c, 0x1aed, 0x18b7, 0x0cae, 0x1c69, 0x1122,
-    0x1a70, 0x1124, 0x0cae, 0x1fb6, 0x0c72, 0x1e27, 0x0f27, 0x1a1e,
-    0x0827, 0x185c, 0x187a, 0x1aea, 0x18b8, 0x1122, 0x0cae, 0x1c95,
-    0x1840, 0x1124, 0x0cae, 0x1fcc, 0x0c72, 0x1e51, 0x0c93, 0x1a57,
-    0x0cbd, 0x1a8f, 0x1a17, 0x1af0, 0x1a63, 0x0cd8, 0x1860, 0x0cd8,
-    0x18a7, 0x1122, 0x0cae, 0x1fcd, 0x0ca6, 0x1a91, 0x0c74, 0x1a7e,
-    0x0c28, 0x0cae, 0x1a6a, 0x0cda, 0x0ce0, 0x18aa, 0x1122, 0x0c91,
-    0x1b8a, 0x0cb2, 0x186d, 0x0c7a, 0x19a5, 0x1122, 0x18f9, 0x081f,
-    0x08c1, 0x140d, 0x081f, 0x0757, 0x0e04, 0x070e, 0x1b8b, 0x13e2,
-    0x0d01, 0x1b8b, 0x1124, 0x0cae, 0x1c84, 0x0c75, 0x0c72, 0x1e1e,
-    0x0cb2, 0x0ca5, 0x1b8f, 0x0e03, 0x140c, 0x0701, 0x0c7a, 0x18b5,
-    0x13f8, 0x08e0, 0x08e0, 0x0cee, 0x1890, 0x0e00, 0x0701, 0x0e06,
-    0x08e1, 0x0e0a, 0x0cee, 0x1e17, 0x1885, 0x15af, 0x1587, 0x0c7a,
-    0x1f8b, 0x075f, 0x15d3, 0x1b8b, 0x1122, 0x0c7a, 0x1c04, 0x1668,
-    0x0cae, 0x1b8b, 0x0324, 0x1f8b, 0x16b5, 0x1603, 0x1b8b, 0x0c24,
-    0x0cae, 0x1a6a, 0x0d1f, 0x1124, 0x140c, 0x0c39, 0x0c3d, 0x0ce2,
-    0x1cb5, 0x0c38, 0x0cda, 0x1cb5, 0x0c3c, 0x1472, 0x1b8f, 0x0cec,
-    0x0cb2, 0x1da6, 0x1122, 0x1532, 0x0cae, 0x18bf, 0x0ca0, 0x0c7a,
-    0x18c6, 0x0ce8, 0x0ce2, 0x18c6, 0x0cae, 0x1c6f, 0x08df, 0x0dff,
-    0x149c, 0x0e08, 0x0ddf, 0x08ff, 0x0f25, 0x1a77, 0x0ce2, 0x18d2,
-    0x0ca2, 0x1c70, 0x0c2e, 0x1e77, 0x0820, 0x0c2a, 0x18dd, 0x0c2e,
-    0x1cdd, 0x0c26, 0x0c24, 0x18df, 0x0c23, 0x0c2b, 0x0ce4, 0x0807,
-    0x0e0a, 0x1412, 0x0717, 0x07c7, 0x0ce2, 0x1cf6, 0x0cee, 0x18ec,
-    0x0ca2, 0x1875, 0x146e, 0x1875, 0x0cea, 0x0c39, 0x18f0, 0x0c38,
-    0x0ca2, 0x18f4, 0x1604, 0x18f5, 0x15d1, 0x1412, 0x146d, 0x1a8f,
-    0x0cae, 0x0ce0, 0x18b7, 0x1080, 0x1400, 0x1410, 0x0a0d, 0x1906,
-    0x0a61, 0x1416, 0x0a60, 0x1423, 0x0a61, 0x18fd, 0x0ad9, 0x1423,
-    0x194b, 0x1461, 0x1080, 0x1403, 0x0a27, 0x0c30, 0x0c34, 0x0a45,
-    0x1906, 0x0a60, 0x1416, 0x0a61, 0x1423, 0x0a60, 0x190c, 0x0c72,
-    0x0e08, 0x191b, 0x1442, 0x0c99, 0x0717, 0x15a1, 0x0f4f, 0x0e03,
-    0x0cae, 0x1937, 0x0cb2, 0x1917, 0x0cb2, 0x0ca5, 0x191f, 0x0ca1,
-    0x05e1, 0x0a3f, 0x0c7a, 0x192d, 0x0c2c, 0x0cae, 0x1932, 0x0f67,
-    0x0c78, 0x0f08, 0x0ac7, 0x1403, 0x1423, 0x0ca2, 0x1d4b, 0x0ca1,
-    0x1400, 0x1410, 0x0a0d, 0x1a16, 0x0a20, 0x1945, 0x1080, 0x0cae,
-    0x1d27, 0x1410, 0x0ca1, 0x0a21, 0x1d4b, 0x0e04, 0x194b, 0x0cae,
-    0x1f9f, 0x0cb2, 0x1e16, 0x0e08, 0x0cb0, 0x1403, 0x0a21, 0x1d52,
-    0x0220, 0x194e, 0x032d, 0x0404, 0x0328, 0x1959, 0x0e05, 0x0a01,
-    0x1945, 0x16c2, 0x07c7, 0x0e09, 0x1416, 0x0f25, 0x1c10, 0x0c2e,
-    0x1964, 0x0c2d, 0x0ced, 0x04e7, 0x0f67, 0x0c78, 0x0f09, 0x0f25,
-    0x197b, 0x0cdc, 0x0f08, 0x1487, 0x0f25, 0x197e, 0x071f, 0x0425,
-    0x0501, 0x022d, 0x08c7, 0x0ca0, 0x0ca4, 0x1dec, 0x0cde, 0x19e9,
-    0x17e5, 0x179d, 0x198e, 0x0f09, 0x0f25, 0x1d6a, 0x0a1f, 0x17a8,
-    0x05ff, 0x05e8, 0x0c3e, 0x198b, 0x0c3a, 0x0c36, 0x198b, 0x0c3a,
-    0x0c32, 0x1dc7, 0x0f01, 0x1570, 0x05f8, 0x071f, 0x1528, 0x0268,
-    0x0268, 0x0368, 0x0368, 0x0425, 0x1d96, 0x0467, 0x0949, 0x16c2,
-    0x0368, 0x0368, 0x15b9, 0x0ca2, 0x1b8f, 0x0568, 0x0ca6, 0x1b8f,
-    0x0ca1, 0x1465, 0x1a32, 0x1080, 0x0cec, 0x0cb8, 0x0ca5, 0x0ca0,
-    0x0091, 0x0c7a, 0x19ac, 0x00a7, 0x0da7, 0x0c9c, 0x0c94, 0x0cae,
-    0x19b2, 0x0da0, 0x0ce2, 0x1db8, 0x0cee, 0x1d28, 0x0da0, 0x0da0,
-    0x0c98, 0x1928, 0x0ca2, 0x1932, 0x0ca1, 0x0cba, 0x1ddd, 0x0c2e,
-    0x1d32, 0x0d97, 0x0f3f, 0x00a5, 0x1d32, 0x0c2c, 0x1932, 0x0a27,
-    0x0a20, 0x0c34, 0x0cf2, 0x1dcf, 0x0fe1, 0x0c38, 0x0f20, 0x0cf6,
-    0x1dd3, 0x0f20, 0x0cf9, 0x0cfa, 0x1dd6, 0x0f20, 0x0ca0, 0x0ca4,
-    0x0cee, 0x0ced, 0x197f, 0x04e7, 0x197f, 0x05df, 0x0a3f, 0x0cb9,
-    0x0c9a, 0x192f, 0x0c96, 0x19e6, 0x0c2c, 0x192f, 0x0c92, 0x1dc5,
-    0x1932, 0x17e6, 0x17ca, 0x198e, 0x0cde, 0x0520, 0x1978, 0x17e3,
-    0x17d0, 0x198e, 0x0cb2, 0x1d20, 0x0cae, 0x1d09, 0x0cb4, 0x1a02,
-    0x0cbe, 0x1e00, 0x07cf, 0x1528, 0x0e07, 0x0e07, 0x1dfc, 0x075f,
-    0x0cb6, 0x1f8f, 0x0cbf, 0x1b8f, 0x0cae, 0x0ce0, 0x1f1b, 0x1124,
-    0x140f, 0x0a01, 0x0e04, 0x140d, 0x0c31, 0x0c35, 0x18b5, 0x0191,
-    0x0101, 0x0e0a, 0x0e04, 0x08a0, 0x0e06, 0x1a11, 0x0cb1, 0x1124,
-    0x0101, 0x0891, 0x0149, 0x01d9, 0x0e0a, 0x0e04, 0x0701, 0x1528,
-    0x0c70, 0x040e, 0x0268, 0x040e, 0x0d91, 0x0f25, 0x1e38, 0x0c92,
-    0x1e2e, 0x0c90, 0x02a7, 0x02a0, 0x02a8, 0x0250, 0x0c95, 0x1b8f,
-    0x0528, 0x13f6, 0x0530, 0x1b8f, 0x0cb2, 0x1dba, 0x0c72, 0x1a1e,
-    0x0c96, 0x1e30, 0x0225, 0x1a3e, 0x0c92, 0x1a47, 0x02cf, 0x02e8,
-    0x07e8, 0x07e8, 0x0cd2, 0x1b8f, 0x040e, 0x0268, 0x040e, 0x0807,
-    0x043f, 0x0228, 0x1b8f, 0x0c7a, 0x1e2e, 0x0c7c, 0x0c94, 0x0549,
-    0x1b8f, 0x0c96, 0x1a57, 0x0cec, 0x1465, 0x0478, 0x138f, 0x0849,
-    0x0860, 0x0768, 0x004f, 0x0f37, 0x0c32, 0x1e58, 0x0c5f, 0x0861,
-    0x1f8f, 0x1574, 0x1a5f, 0x1122, 0x0cae, 0x1c77, 0x0c2c, 0x0c7a,
-    0x1a6a, 0x0cd8, 0x1122, 0x1783, 0x0ca6, 0x1e77, 0x0ca4, 0x1a91,
-    0x1407, 0x0ca4, 0x0f20, 0x0c3e, 0x1a79, 0x0c36, 0x1a79, 0x0c74,
-    0x1b8a, 0x1472, 0x1b8e, 0x1604, 0x081f, 0x1783, 0x0fe1, 0x1a91,
-    0x0fd9, 0x0e0a, 0x0821, 0x0825, 0x0a01, 0x1e87, 0x081f, 0x0717,
-    0x0e04, 0x1b8e, 0x0f25, 0x1ea3, 0x0f21, 0x08e5, 0x0e04, 0x011f,
-    0x1b8b, 0x1407, 0x0867, 0x0f25, 0x0825, 0x1a97, 0x0847, 0x0865,
-    0x1e9f, 0x085d, 0x1a8a, 0x0fe0, 0x0e0a, 0x0cfa, 0x1c30, 0x011f,
-    0x0f01, 0x0c21, 0x1a88, 0x075f, 0x070e, 0x0c5a, 0x1aa8, 0x0c38,
-    0x0848, 0x1eae, 0x0848, 0x1e7b, 0x15d1, 0x1a7c, 0x081f, 0x0e04,
-    0x07cf, 0x070e, 0x0225, 0x1ebe, 0x15a1, 0x1668, 0x070e, 0x0e05,
-    0x1604, 0x16ad, 0x145d, 0x07cf, 0x08c7, 0x1a7c, 0x0c52, 0x1ac1,
-    0x17ec, 0x0265, 0x1aba, 0x17f9, 0x15b0, 0x15a1, 0x1aba, 0x140c,
-    0x0f4f, 0x0c12, 0x08ff, 0x1acd, 0x0ca0, 0x075f, 0x1603, 0x13f8,
-    0x0c75, 0x15fc, 0x071e, 0x15fc, 0x163b, 0x0c76, 0x1ad8, 0x0ce4,
-    0x13f8, 0x0f01, 0x16e1, 0x0747, 0x140d, 0x0265, 0x1ee4, 0x15fc,
-    0x13f8, 0x0717, 0x15fb, 0x1b8b, 0x156d, 0x070e, 0x1874, 0x0c7a,
-    0x1ec7, 0x0ca8, 0x0c30, 0x0cae, 0x1820, 0x0c34, 0x0cae, 0x1801,
-    0x0cae, 0x181d, 0x16df, 0x0cb2, 0x1af7, 0x0cae, 0x19a5, 0x1122,
-    0x0cae, 0x1b3d, 0x140f, 0x0225, 0x0c16, 0x1f05, 0x13f4, 0x0d47,
-    0x0c55, 0x15cf, 0x0c7b, 0x0e04, 0x1b0c, 0x0701, 0x1b02, 0x140c,
-    0x15ce, 0x0ce2, 0x1b0c, 0x0c12, 0x0225, 0x1f0f, 0x0ca0, 0x0c7a,
-    0x1b12, 0x0ca3, 0x079f, 0x0ca2, 0x1b8a, 0x0cbe, 0x0cb6, 0x1b8a,
-    0x1410, 0x0a20, 0x1b89, 0x0cb2, 0x1b20, 0x0cae, 0x0c7a, 0x19a4,
-    0x1122, 0x0cae, 0x1f07, 0x140c, 0x0c7a, 0x1f7c, 0x0cbe, 0x0cb6,
-    0x1f2c, 0x0c31, 0x0c35, 0x1b37, 0x0c36, 0x1e77, 0x0f20, 0x0e04,
-    0x0e71, 0x145b, 0x0e71, 0x0e04, 0x1410, 0x070f, 0x0e61, 0x1472,
-    0x0cb6, 0x1f5a, 0x0ca8, 0x0cbe, 0x1f5a, 0x1532, 0x149c, 0x0f25,
-    0x1b7a, 0x0cae, 0x1b5a, 0x092d, 0x0dc7, 0x149c, 0x0f25, 0x0ddf,
-    0x05ff, 0x05e8, 0x0807, 0x0e08, 0x05f8, 0x1b7a, 0x1410, 0x0a01,
-    0x0caa, 0x1b54, 0x0ca9, 0x0cbc, 0x05dc, 0x1e77, 0x05e1, 0x1f89,
-    0x0a20, 0x1b56, 0x096d, 0x096d, 0x05df, 0x0a7f, 0x07d9, 0x08d9,
-    0x0ddf, 0x143f, 0x0a45, 0x0a0d, 0x05e0, 0x1b75, 0x0e09, 0x0128,
-    0x0128, 0x0e08, 0x08e0, 0x0cee, 0x1b62, 0x0de0, 0x0cde, 0x1f78,
-    0x0cda, 0x1b5f, 0x0cd6, 0x1f60, 0x1b5f, 0x0968, 0x0968, 0x1b4e,
-    0x0968, 0x0968, 0x0891, 0x1a77, 0x0c32, 0x0c33, 0x0c36, 0x0c35,
-    0x1850, 0x0e04, 0x0e51, 0x145b, 0x0e51, 0x0e04, 0x0e71, 0x145e,
-    0x0e61, 0x0e04, 0x0717, 0x0caa, 0x0891, 0x1edb, 0x1532, 0x0cb6,
-    0x1b95, 0x0cbe, 0x0cbd, 0x1f95, 0x0cb5, 0x149c, 0x0e09, 0x0f25,
-    0x08d9, 0x1e34, 0x0cd9, 0x0901, 0x05e0, 0x05e4, 0x0e02, 0x1122,
-    0x0c7a, 0x1fa5, 0x1532, 0x1442, 0x1485, 0x0c12, 0x1ba8, 0x08e7,
-    0x0c11, 0x1476, 0x0c7a, 0x1bae, 0x1485, 0x1baf, 0x15c6, 0x1476,
-    0x0c7a, 0x1bb3, 0x15c6, 0x1465, 0x0d30, 0x1b8b, 0x1122, 0x0ce4,
-    0x140c, 0x15fb, 0x0e31, 0x145d, 0x146a, 0x0e61, 0x1467, 0x13f2,
-    0x0e71, 0x1467, 0x140d, 0x0ce6, 0x0ce7, 0x1fbd, 0x15b0, 0x0e41,
-    0x1467, 0x0e51, 0x1467, 0x1b8a, 0x0ce0, 0x1122, 0x0c7a, 0x1fd1,
-    0x0ce4, 0x0e61, 0x1412, 0x1410, 0x0ce2, 0x1ca5, 0x07c7, 0x070f,
-    0x15fc, 0x070e, 0x1603, 0x0e71, 0x0747, 0x1412, 0x15d3, 0x070e,
-    0x18a5, 0x0787, 0x0301, 0x17cd, 0x17ca, 0x17d3, 0x17d8, 0x17e0,
-    0x17ca, 0x179d, 0x17d7, 0x17d5, 0x16c2, 0x03c7, 0x0300, 0x0347,
-    0x0300, 0x0e03, 0x07c7, 0x15fb, 0x0749, 0x0067, 0x0807, 0x0e03,
-    0x145d, 0x0e04, 0x070f, 0x0e03, 0x0000, 0x0000, 0x0000, 0x0000,
-    0x0a67, 0x0f60, 0x1bfc, 0x1410, 0x0a47, 0x0701, 0x0e03, 0x0f1f,
-    0x0e0a, 0x01c7, 0x0e05, 0x0e03, 0x07c7, 0x0e41, 0x180a, 0x07c7,
-    0x0e51, 0x180a, 0x0ce6, 0x1c5e, 0x0e00, 0x185f, 0x0cdd, 0x1824,
-    0x0cde, 0x1821, 0x0a1f, 0x0d65, 0x182b, 0x0e06, 0x024f, 0x0a7f,
-    0x0e03, 0x0ac7, 0x181e, 0x0cdc, 0x0a4f, 0x027f, 0x0d49, 0x0a0f,
-    0x1432, 0x0861, 0x1c18, 0x1570, 0x0577, 0x0128, 0x0d60, 0x0508,
-    0x1c1d, 0x1829, 0x0a00, 0x0c3a, 0x183d, 0x0c36, 0x183d, 0x0825,
-    0x1c3d, 0x0c2a, 0x1ffc, 0x0f20, 0x0801, 0x0847, 0x0f07, 0x0e0a,
-    0x0e00, 0x0e03, 0x044c, 0x0ca5, 0x0c71, 0x0d01, 0x1c49, 0x0c14,
-    0x15c2, 0x026d, 0x0467, 0x0460, 0x0268, 0x0061, 0x1c56, 0x004c,
-    0x1c54, 0x0061, 0x19a1, 0x0c10, 0x0228, 0x184c, 0x0268, 0x15bf,
-    0x0065, 0x1c56, 0x19a1, 0x0e05, 0x0e61, 0x0747, 0x0e05, 0x070e,
-    0x0e03, 0x152f, 0x0a20, 0x0c3e, 0x1861, 0x08df, 0x0e03, 0x07c7,
-    0x1412, 0x071f, 0x0f0f, 0x15d1, 0x1412, 0x0717, 0x0ce6, 0x1c72,
-    0x0e06, 0x1873, 0x0e04, 0x071f, 0x0a07, 0x0e03, 0x15a1, 0x15af,
-    0x1587, 0x071e, 0x15ce, 0x071e, 0x0749, 0x0c54, 0x0c58, 0x076d,
-    0x0c54, 0x0567, 0x0f0f, 0x0c3b, 0x1aaa, 0x15bf, 0x19bf, 0x0c2a,
-    0x1895, 0x0c36, 0x1c8d, 0x0c32, 0x1c95, 0x0f21, 0x0820, 0x0c2e,
-    0x18bd, 0x0c36, 0x1c95, 0x0f01, 0x0a2d, 0x0e03, 0x0a01, 0x0e04,
-    0x0c74, 0x0cbd, 0x0cb5, 0x031f, 0x0c78, 0x0cad, 0x0c7b, 0x0cbe,
-    0x0cb6, 0x1cc4, 0x03cf, 0x0e07, 0x0e07, 0x1ca3, 0x1523, 0x0e07,
-    0x0e07, 0x18a6, 0x0a3f, 0x0c3a, 0x18ae, 0x0c35, 0x152c, 0x1474,
-    0x05ff, 0x1487, 0x0c3a, 0x0f25, 0x1d31, 0x0825, 0x1931, 0x0c32,
-    0x189e, 0x0c36, 0x1d31, 0x0caf, 0x189f, 0x0820, 0x0c2e, 0x1c94,
-    0x0f20, 0x0f20, 0x0f20, 0x18bd, 0x03c7, 0x0e09, 0x0c76, 0x1c99,
-    0x0cb6, 0x1cdd, 0x0e07, 0x0e07, 0x18dd, 0x0a3f, 0x0c36, 0x0c3a,
-    0x1cdd, 0x0820, 0x0c2e, 0x18d6, 0x0821, 0x18fb, 0x0820, 0x0c22,
-    0x0c26, 0x1cdd, 0x0c2a, 0x18dd, 0x1461, 0x1410, 0x0a20, 0x0e04,
-    0x0a21, 0x1432, 0x0c76, 0x1c96, 0x0861, 0x1ce8, 0x0128, 0x18e4,
-    0x0f25, 0x1cfb, 0x0c2e, 0x18ee, 0x0c2d, 0x0c78, 0x1570, 0x0d3f,
-    0x0d67, 0x0c58, 0x0d09, 0x0d25, 0x0d07, 0x1cfb, 0x0f37, 0x0d09,
-    0x0d25, 0x1911, 0x0cac, 0x1473, 0x05ff, 0x0f25, 0x1d31, 0x1487,
-    0x0f25, 0x1931, 0x0cae, 0x0c7a, 0x1d06, 0x138f, 0x1117, 0x0c7a,
-    0x1d0b, 0x031f, 0x1323, 0x0cae, 0x1d0e, 0x135a, 0x08e7, 0x0cec,
-    0x1070, 0x08d9, 0x0891, 0x0c12, 0x1d17, 0x0d21, 0x08a7, 0x0c1a,
-    0x191a, 0x0ce0, 0x0c16, 0x1d1d, 0x0cec, 0x0c7a, 0x1920, 0x0ce8,
-    0x071f, 0x1117, 0x10d2, 0x0c76, 0x192f, 0x0a20, 0x0c32, 0x192c,
-    0x0349, 0x0e08, 0x0361, 0x1d2f, 0x0e09, 0x035f, 0x0e08, 0x0e07,
-    0x0e07, 0x0e03, 0x0e08, 0x15a1, 0x0e41, 0x145d, 0x0749, 0x0c54,
-    0x1574, 0x07d9, 0x0c12, 0x193d, 0x0d67, 0x0847, 0x0c7e, 0x1d46,
-    0x05c7, 0x03e0, 0x03e0, 0x03ed, 0x05e5, 0x1d7d, 0x0cd4, 0x0821,
-    0x1572, 0x1572, 0x0c2e, 0x1949, 0x0404, 0x195f, 0x1573, 0x02c7,
-    0x0220, 0x04e4, 0x1955, 0x02ed, 0x1951, 0x02e5, 0x1960, 0x0221,
-    0x03c7, 0x0717, 0x15bd, 0x0324, 0x1934, 0x031f, 0x1960, 0x1573,
-    0x0865, 0x1966, 0x0425, 0x1966, 0x0465, 0x1d5f, 0x0228, 0x0268,
-    0x0cd6, 0x1978, 0x0c16, 0x1979, 0x0460, 0x0cd2, 0x1971, 0x0c13,
-    0x0f07, 0x0e03, 0x0821, 0x022d, 0x076d, 0x0c50, 0x0c5c, 0x0e03,
-    0x0561, 0x0461, 0x0e03, 0x15bf, 0x022d, 0x0c16, 0x1d7b, 0x0525,
-    0x1d47, 0x026d, 0x15c7, 0x0821, 0x197f, 0x0801, 0x197f, 0x0716,
-    0x0349, 0x0c61, 0x0c16, 0x1da1, 0x03ad, 0x15c7, 0x0c16, 0x1d9c,
-    0x0368, 0x0265, 0x1d94, 0x0c60, 0x1597, 0x0228, 0x198d, 0x0215,
-    0x1dcd, 0x0211, 0x0360, 0x1997, 0x15bf, 0x03a8, 0x0c16, 0x1da1,
-    0x1597, 0x0c39, 0x19a7, 0x0025, 0x19aa, 0x0228, 0x15c7, 0x0225,
-    0x19a3, 0x0701, 0x0c3a, 0x0c39, 0x1fa9, 0x0787, 0x19c2, 0x07d7,
-    0x13f4, 0x030f, 0x0d01, 0x0501, 0x0c38, 0x19a3, 0x0547, 0x0849,
-    0x0501, 0x0561, 0x1fa9, 0x032d, 0x19b9, 0x0201, 0x0027, 0x0c16,
-    0x1be9, 0x0521, 0x0525, 0x19c5, 0x0c15, 0x0e03, 0x15c7, 0x0c16,
-    0x1fe9, 0x0521, 0x19c5, 0x0527, 0x0c14, 0x0e03, 0x075f, 0x0c38,
-    0x070e, 0x0c3a, 0x19d4, 0x0c13, 0x058f, 0x0c39, 0x0c56, 0x1df1,
-    0x0c16, 0x0513, 0x1df6, 0x05a5, 0x19d0, 0x0791, 0x0c12, 0x19e7,
-    0x0c52, 0x1de9, 0x020d, 0x1dd0, 0x0209, 0x075f, 0x19a1, 0x0c52,
-    0x1de2, 0x0208, 0x1a1f, 0x022d, 0x036d, 0x15be, 0x0324, 0x1de5,
-    0x1a1f, 0x0c16, 0x19d0, 0x0513, 0x1dd0, 0x05a5, 0x0265, 0x1ddd,
-    0x022d, 0x15bf, 0x19d4, 0x075f, 0x0c39, 0x1a09, 0x15b1, 0x0517,
-    0x0c52, 0x19a1, 0x13f4, 0x0c38, 0x0c3a, 0x19fc, 0x0225, 0x1ff3,
-    0x0c17, 0x078f, 0x0247, 0x0d0a, 0x0c11, 0x0c52, 0x1a10, 0x0c10,
-    0x0c91, 0x0d12, 0x0c96, 0x1e29, 0x0508, 0x1feb, 0x0201, 0x0591,
-    0x0549, 0x15c2, 0x02a5, 0x1de5, 0x0c3a, 0x1e31, 0x022d, 0x04a1,
-    0x19e9, 0x02ad, 0x02a5, 0x1de5, 0x0065, 0x1a1e, 0x0368, 0x15c7,
-    0x1a1f, 0x050d, 0x1a2d, 0x0c17, 0x050e, 0x0509, 0x1a16, 0x0389,
-    0x0220, 0x038d, 0x1a2f, 0x0025, 0x19e5, 0x036d, 0x0228, 0x0225,
-    0x1a31, 0x15c7, 0x1a31, 0x15d4, 0x17fa, 0x0701, 0x02a5, 0x1da1,
-    0x13f4, 0x05a1, 0x1e4b, 0x05a1, 0x1e47, 0x0520, 0x1a41, 0x0c96,
-    0x1a4a, 0x0520, 0x026d, 0x0c91, 0x0849, 0x0507, 0x0978, 0x0501,
-    0x0591, 0x1a61, 0x036d, 0x032d, 0x1a60, 0x0381, 0x0381, 0x0308,
-    0x0385, 0x1a55, 0x0309, 0x0312, 0x1a5d, 0x00a5, 0x1a52, 0x03a8,
-    0x036d, 0x0365, 0x1a56, 0x15b2, 0x0d17, 0x094f, 0x053f, 0x19e5,
-    0x0f01, 0x17fa, 0x0501, 0x0c10, 0x0225, 0x1fec, 0x15b6, 0x0349,
-    0x0c32, 0x1a75, 0x0067, 0x0225, 0x1dfe, 0x031e, 0x0301, 0x080f,
-    0x0821, 0x1ec5, 0x0821, 0x1ecf, 0x0821, 0x1ed6, 0x0821, 0x1edb,
-    0x0027, 0x17a4, 0x031e, 0x0c32, 0x1a90, 0x031d, 0x1e95, 0x0319,
-    0x028f, 0x0216, 0x17a4, 0x0216, 0x0250, 0x1a85, 0x0217, 0x0358,
-    0x0287, 0x17a4, 0x0216, 0x0212, 0x1a8e, 0x0860, 0x02ed, 0x02e5,
-    0x1a75, 0x0c32, 0x1dfe, 0x16b6, 0x07c7, 0x0209, 0x15b2, 0x071e,
-    0x0c96, 0x1aa3, 0x0c10, 0x0767, 0x0597, 0x007f, 0x05ad, 0x026d,
-    0x0597, 0x007f, 0x070e, 0x1604, 0x19d4, 0x0c30, 0x16b5, 0x1587,
-    0x0d00, 0x0c62, 0x1feb, 0x058f, 0x1a6e, 0x0747, 0x0701, 0x17da,
-    0x17d8, 0x0328, 0x17da, 0x17d3, 0x17ca, 0x17d3, 0x0328, 0x17e0,
-    0x17d8, 0x0328, 0x0328, 0x0328, 0x0e03, 0x17d2, 0x17d8, 0x179d,
-    0x0328, 0x179d, 0x17cd, 0x17e0, 0x17ca, 0x16c2, 0x1a82, 0x17df,
-    0x17d3, 0x0328, 0x17d8, 0x17d8, 0x0328, 0x1acc, 0x17de, 0x17d3,
-    0x16c2, 0x17da, 0x1acd, 0x17dd, 0x17d3, 0x16c1, 0x1a82, 0x1122,
-    0x08ff, 0x0c75, 0x15a1, 0x0c7a, 0x1f53, 0x0c38, 0x17aa, 0x13e2,
-    0x0c75, 0x0300, 0x1587, 0x1775, 0x15b6, 0x13e1, 0x0300, 0x0c12,
-    0x1af2, 0x0313, 0x0d01, 0x13e2, 0x038d, 0x0355, 0x1efa, 0x0ca3,
-    0x0c36, 0x1b08, 0x0385, 0x1f00, 0x0381, 0x0c36, 0x1b00, 0x0c13,
-    0x0c32, 0x0f25, 0x1b4e, 0x038d, 0x1f08, 0x0313, 0x0c13, 0x0ca3,
-    0x039d, 0x1f0c, 0x0353, 0x0c38, 0x0317, 0x0dc7, 0x031e, 0x0349,
-    0x0391, 0x00a7, 0x0c7a, 0x1f16, 0x1788, 0x1b17, 0x17a3, 0x03c5,
-    0x1f28, 0x03c3, 0x031e, 0x0c7a, 0x1b22, 0x17a4, 0x0312, 0x1788,
-    0x030a, 0x1b12, 0x17a3, 0x0308, 0x030e, 0x17a4, 0x0381, 0x1b12,
-    0x0860, 0x02e5, 0x1b12, 0x030f, 0x0c3a, 0x1b33, 0x0c7a, 0x1b32,
-    0x13e1, 0x0353, 0x0316, 0x15b2, 0x156d, 0x0c7a, 0x1f65, 0x0716,
-    0x15b2, 0x0757, 0x1603, 0x0c11, 0x156d, 0x0c36, 0x1b47, 0x13f2,
-    0x0c35, 0x163b, 0x1602, 0x156d, 0x0c76, 0x1b47, 0x15a9, 0x0cd1,
-    0x0ca2, 0x1b4b, 0x0cd0, 0x08df, 0x0f7f, 0x138b, 0x038d, 0x1f51,
-    0x0313, 0x0353, 0x1b08, 0x1775, 0x0dc7, 0x0c36, 0x1b5d, 0x13f2,
-    0x15d3, 0x163c, 0x0c76, 0x1f64, 0x1603, 0x0c16, 0x0225, 0x1f62,
-    0x1602, 0x0c38, 0x15b6, 0x1b0e, 0x128f, 0x0c32, 0x1b6c, 0x13e1,
-    0x15b1, 0x0757, 0x15d3, 0x0c11, 0x0787, 0x0ca2, 0x1b73, 0x13e2,
-    0x0d01, 0x0757, 0x15d4, 0x17aa, 0x1b4b, 0x0291, 0x03a8, 0x0390,
-    0x02a5, 0x1dad, 0x0c16, 0x19ad, 0x0c7a, 0x1f65, 0x0c32, 0x1b4b,
-    0x07c7, 0x15b0, 0x1b4b, 0x0c19, 0x0cda, 0x19ad, 0x0c18, 0x19ad,
-    0x0301, 0x080f, 0x0821, 0x1f95, 0x0821, 0x1f9f, 0x0027, 0x0821,
-    0x1ba4, 0x17dc, 0x17e0, 0x17cf, 0x1bcd, 0x17df, 0x17cf, 0x17ca,
-    0x17d0, 0x17d3, 0x17da, 0x17d5, 0x17e0, 0x0328, 0x1be9, 0x17dd,
-    0x17cf, 0x17cf, 0x1b9c, 0x0317, 0x080f, 0x032d, 0x0821, 0x1ba5,
-    0x0820, 0x0e03, 0x1570, 0x087f, 0x140c, 0x092d, 0x080e, 0x0a28,
-    0x0c6e, 0x1fc1, 0x0c6a, 0x1c73, 0x17d3, 0x17cd, 0x17da, 0x17d2,
-    0x17cc, 0x17d2, 0x179d, 0x17d8, 0x0d01, 0x0328, 0x179d, 0x0757,
-    0x1a04, 0x17d7, 0x17cf, 0x179d, 0x17e0, 0x17cc, 0x17da, 0x17d8,
-    0x17cd, 0x1bbc, 0x0328, 0x1be2, 0x17cd, 0x0328, 0x1be3, 0x17d0,
-    0x0328, 0x1be4, 0x17e0, 0x0328, 0x1be5, 0x0328, 0x1be6, 0x17d0,
-    0x0328, 0x1be7, 0x0328, 0x1be8, 0x17e0, 0x17e0, 0x17e0, 0x17e0,
-    0x0328, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320, 0x0320,
-    0x0320, 0x0520, 0x19c5, 0x0c16, 0x0301, 0x1ff1, 0x0321, 0x0c15,
-    0x1ff7, 0x0521, 0x1ff6, 0x0265, 0x0d0f, 0x1bec, 0x0027, 0x0c74,
-    0x19a1, 0x0c3a, 0x0c12, 0x1bfd, 0x0c74, 0x0e03, 0x0000, 0x0000,
-};
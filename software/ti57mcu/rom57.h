@@ -1,10 +0,0 @@
-/**
- * The actual ROM of the TI-57.
- */
-
-#ifndef rom57_h
-#define rom57_h
-
-extern unsigned short ROM57[2048];
-
-#endif  /* !rom57_h */
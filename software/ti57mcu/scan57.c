@@ -0,0 +1,258 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#include "scan57.h"
+#include "kbd57.h"
+#include "prof57.h"
+#include "rcl57mcu.h"
+#include <string.h>
+
+/* Interrupt driven display and keyboard scan for RCL-57 retrofit PCB V2 */
+/* https://hackaday.io/project/194963 */
+
+/* TLC5929 output words for the 8 segments of a frame, and the same as
+   3 byte serial words (bit 16 first) streamed to the TLC5929 by DMA */
+typedef struct
+{
+    uint16_t outputs[8];
+    uint8_t words[8][3];
+} scan57_frame_t;
+
+/* serial word loaded at the end of a frame: all outputs off */
+static const uint8_t WORD_OFF[3] = {0, 0, 0};
+
+/* Private data - shared between SysTick ISR and foreground */
+
+static scan57_frame_t frames[2];        // front (scanned) and back (published) frames
+static volatile uint8_t front = 0;      // index of the frame being scanned
+static volatile bool scanning = false;  // front frame is being scanned
+static volatile bool pending = false;   // back frame waits to be scanned
+static volatile uint8_t retain = 0;     // frames the front frame is scanned again
+
+/* Private data - only used by the foreground */
+
+static display_data_t last_digits;      // digits and mask of the last published frame
+static display_data_t last_mask;
+
+/* Private data - only used by the SysTick ISR */
+
+static uint8_t segment = 0;             // segment being scanned, 0-7
+static uint8_t tick = 0;                // tick within segment, 0 to SEGMENT_TICKS-1
+static uint8_t read_tick = 0;           // tick at which keyboard row is read
+static bool is_preloaded = false;       // segment 0 word of the front frame streamed
+
+/* Published results */
+
+static volatile uint32_t frame_count = 0;
+
+/* reset the scan state machine - no frame, display dark */
+void scan57_init(void)
+{
+    scanning = false;
+    pending = false;
+    retain = 0;
+    front = 0;
+    is_preloaded = false;
+    frame_count = 0;
+}
+
+/* publish a frame, scanned again for 'retention' display cycles - false
+   if back frame still pending */
+static bool publish(display_data_t* digits, display_data_t* mask, uint8_t retention)
+{
+    scan57_frame_t* back;
+
+    /* same frame as the last one published: retain it for longer. The
+       retention is set before checking that the frame is still scanned,
+       so that the ISR either sees it or has already gone dark */
+    if ((memcmp(digits, last_digits, sizeof(display_data_t)) == 0) &&
+            (memcmp(mask, last_mask, sizeof(display_data_t)) == 0))
+    {
+        retain = retention;
+        if (scanning || pending)
+            return true;
+    }
+
+    if (pending)
+        return false;
+
+    /* the ISR never touches the back frame while 'pending' is clear */
+    back = &frames[front ^ 1];
+    for (uint8_t s = 0; s < 8; s++)
+    {
+        uint16_t outputs = mux57_which_outputs(digits, mask, s);
+        back->outputs[s] = outputs;
+        back->words[s][0] = 0;
+        back->words[s][1] = outputs >> 8;
+        back->words[s][2] = outputs & 0xff;
+    }
+
+    memcpy(last_digits, digits, sizeof(display_data_t));
+    memcpy(last_mask, mask, sizeof(display_data_t));
+    retain = retention;
+    pending = true;
+    return true;
+}
+
+/* publish a frame to be scanned next - false if back frame still pending */
+bool scan57_publish(display_data_t* digits, display_data_t* mask)
+{
+    return publish(digits, mask, SCAN57_RETAIN_FRAMES);
+}
+
+/* publish a frame that is scanned until replaced or released */
+bool scan57_publish_held(display_data_t* digits, display_data_t* mask)
+{
+    return publish(digits, mask, SCAN57_RETAIN_HELD);
+}
+
+/* stop scanning at the end of the current frame */
+void scan57_release(void)
+{
+    retain = 0;
+}
+
+/* true when no frame is being scanned nor waiting to be scanned */
+bool scan57_is_idle(void)
+{
+    return !scanning && !pending;
+}
+
+/* number of frames completed since scan57_init() */
+uint32_t scan57_get_frame_count(void)
+{
+    return frame_count;
+}
+
+/* end of a frame: digits off, pick up next frame if any */
+static void end_frame(void)
+{
+    /* disable all segment drive outputs - just in case */
+    hw_segment_disable_all();
+
+    /* update the TLC5929 to all outputs off (loaded at end of segment 7) */
+    hw_digit_driver_update();
+
+    frame_count += 1;
+
+    if (pending)
+    {
+        front ^= 1;
+        pending = false;
+    }
+    else if (retain == SCAN57_RETAIN_HELD)
+        ;   // scan the front frame again
+    else if (retain > 0)
+        retain -= 1;
+    else
+        scanning = false;
+
+    /* the next frame starts at the next tick: stream its first word now */
+    is_preloaded = scanning;
+    if (is_preloaded)
+        hw_digit_driver_stream(frames[front].words[0]);
+}
+
+/* advance the scan state machine - called once per SysTick */
+void scan57_tick(void)
+{
+    const uint16_t* outputs;
+    prof57_mark_t mark;
+
+    if (!scanning)
+    {
+        if (!pending)
+            return;
+
+        /* start scanning the published frame */
+        front ^= 1;
+        pending = false;
+        scanning = true;
+        segment = 0;
+        tick = 0;
+    }
+
+    outputs = frames[front].outputs;
+
+    /* start of a segment */
+    if (tick == 0)
+    {
+        if (segment == 0)
+        {
+            /* preload segment 0 digit outputs, unless end_frame() did.
+               The display was dark, so waiting for the word is fine */
+            if (!is_preloaded)
+                hw_digit_driver_stream(frames[front].words[0]);
+        }
+
+        /* disable all segment drive outputs */
+        hw_segment_disable_all();
+
+        /* drive previously streamed digit pattern to TLC5929 outputs */
+        hw_digit_driver_update();
+
+        /* enable the segment drive output - long enough to light the
+           segment if used, or just long enough to read the keyboard */
+        hw_segment_enable(segment);
+        read_tick = (outputs[segment] != 0) ? SEGMENT_ACTIVE_TICKS : 2;
+    }
+
+    /* start converting this segment's keyboard row one tick before the
+       end of the segment drive, so the DMA has the results by then */
+    if (tick == read_tick - 1)
+    {
+        PROF57_BEGIN(mark);
+        hw_start_keyboard_adc();
+        PROF57_END(mark, PROF57_KEYBOARD);
+    }
+
+    /* end of segment drive: hand the keyboard row to the debouncer */
+    if (tick == read_tick)
+    {
+        PROF57_BEGIN(mark);
+        int16_t columns = hw_get_keyboard_adc_columns();
+        if (columns < 0)
+            kbd57_fault();
+        else
+            kbd57_scan_row(segment + 1, columns);
+        PROF57_END(mark, PROF57_KEYBOARD);
+
+        /* turn off all segment outputs (takes a while for PMOS to turn off) */
+        hw_segment_disable_all();
+    }
+
+    /* start streaming the digit pattern for the next segment, or all
+       off - DMA shifts it out long before the next segment starts */
+    if (tick == SEGMENT_ACTIVE_TICKS)
+        hw_digit_driver_stream((segment < 7) ? frames[front].words[segment + 1] : WORD_OFF);
+
+    /* end of segment */
+    if (++tick == SEGMENT_TICKS)
+    {
+        tick = 0;
+        if (++segment == 8)
+        {
+            segment = 0;
+            end_frame();
+        }
+    }
+}
@@ -0,0 +1,84 @@
+#ifndef scan57_h
+#define scan57_h
+
+#include "mux57.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Interrupt driven display and keyboard scan for RCL-57
+ *
+ * hw_display_cycle() scans the display in the foreground, sleeping 6.4ms
+ * in __WFI() while no TMC1500 instructions execute. Here, the same scan
+ * is a state machine advanced by scan57_tick() from the SysTick interrupt,
+ * so the emulator runs instructions back-to-back while the display and
+ * keyboard are being scanned.
+ *
+ * Frames are double buffered: the ISR scans the 'front' frame while the
+ * emulator publishes the next one (on DISP) into the 'back' frame. A
+ * frame holds the 8 TLC5929 output words, one per segment, computed once
+ * when published. The ISR only starts a DMA transfer of the next word
+ * during each segment and pulses LATCH at the segment boundary, so
+ * refreshing the digit driver costs it a few register writes. When the front frame
+ * is done, the back frame (if any) is swapped in at the next tick.
+ *
+ * Otherwise the front frame is retained: it is scanned again, for up to
+ * SCAN57_RETAIN_FRAMES display cycles after it was last published, then
+ * the display goes dark, as on the original TI-57 while it is busy
+ * computing. Publishing the same frame again (the ROM issues DISP twice
+ * in a row, and keeps issuing it while polling the keyboard) only
+ * extends the retention: it returns at once instead of waiting for the
+ * back frame, and the keyboard is read from the retained frame's scan.
+ *
+ * Each frame also scans the keyboard: the row of each segment is
+ * converted by ADC and DMA while the segment is driven, and handed to the
+ * debouncer of kbd57.h at the end of the drive.
+ *
+ * Segment timing per frame is identical to hw_display_cycle():
+ *   SEGMENT_TICKS per segment, segment drive for SEGMENT_ACTIVE_TICKS
+ *   (or 2 ticks if no digit uses the segment), keyboard row converted
+ *   during the last tick of the drive, next digit word shifted in
+ *   SEGMENT_INACTIVE_TICKS before the end of the segment.
+ *
+ * scan57.c only touches the hardware through the hw_* functions of
+ * mux57.h, so it can be run on a host against stand-ins of those.
+ *
+ * The ISR owns the segment drivers, the digit driver (SPI) and the ADC
+ * while it scans, so scanning must be stopped (see scan57_release and
+ * scan57_is_idle) before code that drives them itself, such as
+ * hw_display_char_d12() or power save. UNI/O transfers need not stop it:
+ * their bits are timed by the TIM3 interrupt, which preempts SysTick.
+ */
+
+/** reset the scan state machine - no frame, display dark */
+void scan57_init(void);
+
+/** advance the scan state machine - call once per SysTick */
+void scan57_tick(void);
+
+/** display cycles a frame is scanned again after it was last published:
+    250 TMC1500 cycles, after which rcl57 blanks the display too */
+#define SCAN57_RETAIN_FRAMES (8)
+
+/** retention of frames that are scanned until replaced or released */
+#define SCAN57_RETAIN_HELD (0xff)
+
+/** publish a frame to be scanned next. Returns false (and does nothing)
+    if the previously published frame has not been picked up yet. A frame
+    identical to the last one published is not published again, only
+    retained for longer */
+bool scan57_publish(display_data_t* digits, display_data_t* mask);
+
+/** publish a frame that is scanned until replaced or released */
+bool scan57_publish_held(display_data_t* digits, display_data_t* mask);
+
+/** stop scanning at the end of the current frame */
+void scan57_release(void);
+
+/** true when no frame is being scanned nor waiting to be scanned */
+bool scan57_is_idle(void);
+
+/** number of frames completed since scan57_init() */
+uint32_t scan57_get_frame_count(void);
+
+#endif /* scan57_h */
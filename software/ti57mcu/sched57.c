@@ -0,0 +1,166 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+
+#include "sched57.h"
+#include "rcl57mcu.h"
+#include "hal57.h"
+#include "prof57.h"
+
+/* Time-sliced instruction scheduler for RCL-57 */
+/* https://hackaday.io/project/194963 */
+
+static sched57_speed_t profile = SCHED57_SPEED_UNTHROTTLED;
+
+/* budget = credited - charged. Only the ISR writes 'credited', only the
+   foreground writes 'charged'; both wrap around */
+static volatile uint32_t credited = 0;
+static uint32_t charged = 0;
+
+#if SCHED57_CLOCK_GOVERNOR
+/* core clock, and the time ('credited') since which a slower one is enough */
+static hal57_clock_t clock = HAL57_CLOCK_24MHZ;
+static bool is_slower_enough = false;
+static uint32_t slower_since = 0;
+#endif
+
+/* clock pinned by sched57_pin_clock */
+static bool is_pinned = false;
+static hal57_clock_t pinned_clock;
+
+/* duration of a cycle in the current activity, 0 if free */
+static uint32_t get_cycle_us(rcl57_t* rcl57)
+{
+    int goal_speed = rcl57_get_goal_speed(rcl57);
+
+    if (goal_speed > 0)
+        return SCHED57_CYCLE_US / goal_speed;
+    if (profile == SCHED57_SPEED_1X)
+        return SCHED57_CYCLE_US;
+    if (profile == SCHED57_SPEED_4X)
+        return SCHED57_CYCLE_US / 4;
+    return 0;
+}
+
+#if SCHED57_CLOCK_GOVERNOR
+/* the slowest clock that keeps up with a cycle duration. At 1x, a cycle
+   leaves 200us for the ~300 core cycles of ti57_next and the loop */
+static hal57_clock_t get_clock(uint32_t cycle_us)
+{
+    if (cycle_us == 0)
+        return HAL57_CLOCK_64MHZ;
+    if (cycle_us < SCHED57_CYCLE_US)
+        return HAL57_CLOCK_24MHZ;
+    return HAL57_CLOCK_8MHZ;
+}
+
+/* switch to a faster clock at once, to a slower one once it has been
+   enough for SCHED57_CLOCK_HOLD_US. A switch refused during a UNI/O
+   transfer is retried on the next instruction */
+static void govern(uint32_t cycle_us)
+{
+    hal57_clock_t goal = is_pinned ? pinned_clock : get_clock(cycle_us);
+
+    if ((goal >= clock) || is_pinned)
+    {
+        is_slower_enough = false;
+        if (goal == clock)
+            return;
+    }
+    else if (is_slower_enough == false)
+    {
+        is_slower_enough = true;
+        slower_since = credited;
+        return;
+    }
+    else if ((uint32_t)(credited - slower_since) < SCHED57_CLOCK_HOLD_US)
+        return;
+
+    if (hal57_set_clock(goal))
+    {
+        clock = goal;
+        is_slower_enough = false;
+    }
+}
+#endif
+
+/* reset the budget and select a speed profile */
+void sched57_init(sched57_speed_t speed)
+{
+    charged = credited;
+    profile = speed;
+}
+
+/* select a speed profile */
+void sched57_set_speed(sched57_speed_t speed)
+{
+    profile = speed;
+}
+
+/* current speed profile */
+sched57_speed_t sched57_get_speed(void)
+{
+    return profile;
+}
+
+/* add one SysTick period to the budget - call from the SysTick ISR */
+void sched57_tick(void)
+{
+    credited += SYSTICK_PERIOD_US;
+}
+
+/* sleep until there is budget for the next instruction */
+void sched57_wait(void)
+{
+    int32_t budget = (int32_t)(credited - charged);
+    prof57_mark_t mark;
+
+    /* do not let idle time build up into a burst */
+    if (budget > SCHED57_MAX_CREDIT_US)
+        charged = credited - SCHED57_MAX_CREDIT_US;
+
+    if ((int32_t)(credited - charged) > 0)
+        return;
+
+    PROF57_BEGIN(mark);
+    while ((int32_t)(credited - charged) <= 0)
+        hal57_wait_for_interrupt();
+    PROF57_END(mark, PROF57_IDLE);
+}
+
+/* keep the core clock at 'pinned' from now on */
+void sched57_pin_clock(hal57_clock_t pinned)
+{
+    pinned_clock = pinned;
+    is_pinned = true;
+}
+
+/* charge the cost of the instruction just executed */
+void sched57_charge(rcl57_t* rcl57, int cost)
+{
+    uint32_t cycle_us = get_cycle_us(rcl57);
+
+    charged += cost * cycle_us;
+#if SCHED57_CLOCK_GOVERNOR
+    govern(cycle_us);
+#endif
+}
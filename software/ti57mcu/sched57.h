@@ -0,0 +1,90 @@
+#ifndef sched57_h
+#define sched57_h
+
+#include "rcl57.h"
+#include "hal57.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Time-sliced instruction scheduler for RCL-57
+ *
+ * A TI-57 executes a TMC1500 cycle every 200us (5000 cycles per second),
+ * and the cost returned by ti57_next() is in such cycles (1, or 32 for
+ * DISP). The scheduler turns SysTick time into a budget of cycles: the
+ * ISR calls sched57_tick() every SYSTICK_PERIOD_US, and the main loop
+ * calls sched57_wait() before each ti57_next() and sched57_charge() with
+ * its cost after. While the budget is spent, sched57_wait() sleeps.
+ *
+ * The speed profile sets how fast a cycle is charged while the TI-57 is
+ * busy: 1x (200us per cycle, as the original), 4x (50us) or unthrottled
+ * (free - instructions run back-to-back). Some activities keep the goal
+ * speed given by rcl57_get_goal_speed() regardless of the profile, so
+ * that they look and feel like the original: waiting for a key in EVAL
+ * and LRN modes, PAUSE and SST trace in RUN mode (1x, or 2x with the
+ * short pause and faster trace options). DISP is also paced by the
+ * display scan itself (see scan57_publish).
+ *
+ * Budget is kept in microseconds, as the difference between the time
+ * credited by the ISR and the time charged by the main loop. Each side
+ * only writes its own counter, so no interrupt masking is needed. Unused
+ * budget is capped at SCHED57_MAX_CREDIT_US, so that time spent sleeping
+ * elsewhere (Delay, powersave) does not turn into a burst.
+ *
+ * The pace also sets the core clock (hal57_set_clock), when built with
+ * SCHED57_CLOCK_GOVERNOR: 8 MHz at the pace of an actual TI-57, which is
+ * also the pace of waiting for a key, 24 MHz at 2x and 4x, and 64 MHz
+ * while unthrottled. A faster clock is taken at once, a slower one only
+ * once it has been enough for SCHED57_CLOCK_HOLD_US, so that the short
+ * polls between two busy stretches do not bounce the clock (each switch
+ * holds the interrupts while the PLL locks). sched57_pin_clock keeps one
+ * clock instead, from the first byte a host sends to the command
+ * interface on (cmd57.h).
+ */
+
+/** speed profiles */
+typedef enum
+{
+    SCHED57_SPEED_1X,           // as the original TI-57
+    SCHED57_SPEED_4X,           // 4 times faster while busy
+    SCHED57_SPEED_UNTHROTTLED   // as fast as the MCU can go while busy
+} sched57_speed_t;
+
+/** duration of a TMC1500 cycle at 1x */
+#define SCHED57_CYCLE_US (200)
+
+/** unused budget cap: one display cycle */
+#define SCHED57_MAX_CREDIT_US (DISPLAY_PERIOD_US)
+
+/** core clock follows the pace */
+#ifndef SCHED57_CLOCK_GOVERNOR
+    #define SCHED57_CLOCK_GOVERNOR (1)
+#endif
+
+/** time a slower clock must be enough for before switching to it: 4 display cycles */
+#define SCHED57_CLOCK_HOLD_US (25000)
+
+/** reset the budget and select a speed profile */
+void sched57_init(sched57_speed_t speed);
+
+/** select a speed profile */
+void sched57_set_speed(sched57_speed_t speed);
+
+/** current speed profile */
+sched57_speed_t sched57_get_speed(void);
+
+/** add one SysTick period to the budget - call from the SysTick ISR */
+void sched57_tick(void);
+
+/** sleep until there is budget for the next instruction */
+void sched57_wait(void);
+
+/** keep the core clock at 'pinned' from now on, regardless of the pace
+    (switched by the next sched57_charge) */
+void sched57_pin_clock(hal57_clock_t pinned);
+
+/** charge the cost (as returned by ti57_next) of the instruction just
+    executed, and set the core clock for the pace of the next one */
+void sched57_charge(rcl57_t* rcl57, int cost);
+
+#endif /* sched57_h */
@@ -0,0 +1,591 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+
+#include "storage57.h"
+#include "hal57.h"
+#include "unio.h"
+#include "tele57.h"
+#include <string.h>
+
+#define INDEX_PAGES (STORAGE57_INDEX_SIZE / STORAGE57_PAGE_SIZE)
+#define BODY_PAGES (STORAGE57_BODY_SIZE / STORAGE57_PAGE_SIZE)
+#define SNAPSHOT_PAGES (STORAGE57_SNAPSHOT_SIZE / STORAGE57_PAGE_SIZE)
+
+/* snapshot layout */
+#define SNAP_MARKER 0       // STORAGE57_SNAPSHOT_MARKER
+#define SNAP_FLAGS 1        // mode (bits 0-1), activity (bits 2-4), COND (bit 5), is_hex (bit 6)
+#define SNAP_R5 2
+#define SNAP_RAB 3
+#define SNAP_PC 4           // pc then stack[0-2], lsb first
+#define SNAP_REGS 12        // A, B, C, D, X[0-7], Y[0-7]: 16 digits in 8 bytes each
+#define SNAP_CHECK (SNAP_REGS + 20 * 8)     // Fletcher-16 of the bytes before, lsb first
+
+/* storage state */
+typedef enum
+{
+    STORAGE_NONE,           // no valid EEPROM
+    STORAGE_LOADING,        // index being read
+    STORAGE_READY
+} storage_state_t;
+
+/* what the UNI/O request is doing */
+typedef enum
+{
+    REQUEST_NONE,
+    REQUEST_INDEX,          // reading the index
+    REQUEST_FETCH,          // reading the body of a cached slot
+    REQUEST_BODY,           // writing a page of the body of a cached slot
+    REQUEST_PAGE,           // writing a page of the index
+    REQUEST_SNAPSHOT,       // reading the snapshot
+    REQUEST_SNAPSHOT_PAGE   // writing a page of the snapshot
+} request_kind_t;
+
+/* snapshot shadow */
+typedef enum
+{
+    SNAPSHOT_UNREAD,
+    SNAPSHOT_READING,
+    SNAPSHOT_READ,
+    SNAPSHOT_FAILED         // contents unknown
+} snapshot_state_t;
+
+/* cached slot body */
+typedef struct
+{
+    int8_t slot;            // -1 if unused
+    bool is_valid;          // body read (or being read if false)
+    uint16_t dirty;         // bit p set: body page p to be written
+    uint32_t last_use;
+    uint8_t body[STORAGE57_BODY_SIZE];
+} cache_entry_t;
+
+static storage_state_t state = STORAGE_NONE;
+
+/* RAM shadow of the index, and its pages to be written */
+static uint8_t index_shadow[STORAGE57_INDEX_SIZE];
+static uint16_t index_dirty;
+
+/* most recently used slot bodies */
+static cache_entry_t cache[STORAGE57_CACHE_SLOTS];
+static uint32_t use_count;
+static bool is_fetch_failed;
+
+/* RAM shadow of the snapshot, and its pages to be written */
+static uint8_t snapshot_shadow[STORAGE57_SNAPSHOT_SIZE];
+static uint16_t snapshot_dirty;
+static snapshot_state_t snapshot_state;
+
+/* UNI/O request: one read or page write at a time */
+static unio_request_t request;
+static request_kind_t request_kind;
+static cache_entry_t* request_entry;
+static uint8_t request_page;
+
+/* offsets in the index of the directory entry and tail of a slot */
+#define DIR(slot) (STORAGE57_DIR_OFFSET - STORAGE57_INDEX_OFFSET + (slot) * STORAGE57_DIR_ENTRY_SIZE)
+#define TAIL(slot) (STORAGE57_TAIL_OFFSET - STORAGE57_INDEX_OFFSET + (slot) * STORAGE57_TAIL_SIZE)
+
+/* see: https://en.wikipedia.org/wiki/Fletcher%27s_checksum */
+uint16_t storage57_fletcher16(const uint8_t* data, int count)
+{
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+    int index;
+
+    for (index = 0; index < count; ++index)
+    {
+        sum1 = (sum1 + data[index]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+
+    return (sum2 << 8) | sum1;
+}
+
+/* copy bytes into a shadow, marking the pages that change in 'dirty'.
+   Shadows start on a page boundary */
+static void update(uint8_t* shadow, uint16_t* dirty, uint8_t offset, const uint8_t* bytes, uint8_t n)
+{
+    for (uint8_t i = 0; i < n; i++, offset++)
+    {
+        if (shadow[offset] != bytes[i])
+        {
+            shadow[offset] = bytes[i];
+            *dirty |= 1 << (offset / STORAGE57_PAGE_SIZE);
+        }
+    }
+}
+
+static void submit(request_kind_t kind, unio_op_t op, uint16_t address, uint8_t* buffer, uint16_t length)
+{
+    request_kind = kind;
+    request.dev_address = UNIO_EEPROM_ADDRESS;
+    request.op = op;
+    request.address = address;
+    request.buffer = buffer;
+    request.length = length;
+    request.done = NULL;
+    if (UNIO_submit(&request) == false)
+        request.status = UNIO_FAILED;   // the UNI/O queue is full
+}
+
+static uint16_t body_address(int8_t slot)
+{
+    return STORAGE57_BODY_OFFSET + slot * STORAGE57_BODY_SIZE;
+}
+
+static cache_entry_t* find(uint8_t slot)
+{
+    for (uint8_t i = 0; i < STORAGE57_CACHE_SLOTS; i++)
+    {
+        if (cache[i].slot == slot)
+        {
+            cache[i].last_use = ++use_count;
+            return &cache[i];
+        }
+    }
+    return NULL;
+}
+
+/* take an unused cache entry, or the least recently used one that has
+   no page left to write, for slot. Returns NULL if there is none */
+static cache_entry_t* allocate(uint8_t slot)
+{
+    cache_entry_t* entry = NULL;
+
+    for (uint8_t i = 0; i < STORAGE57_CACHE_SLOTS; i++)
+    {
+        cache_entry_t* e = &cache[i];
+        if (e->slot < 0)
+        {
+            entry = e;
+            break;
+        }
+        if ((e->dirty == 0) && e->is_valid &&
+                !((request.status == UNIO_PENDING) && (request_entry == e)) &&
+                ((entry == NULL) || (e->last_use < entry->last_use)))
+            entry = e;
+    }
+    if (entry != NULL)
+    {
+        entry->slot = slot;
+        entry->is_valid = false;
+        entry->dirty = 0;
+        entry->last_use = ++use_count;
+    }
+    return entry;
+}
+
+/* the cache entry of slot, once its body is read. Sleeps meanwhile */
+static cache_entry_t* wait_cached(uint8_t slot)
+{
+    cache_entry_t* entry;
+
+    is_fetch_failed = false;
+    while (state == STORAGE_READY)
+    {
+        entry = find(slot);
+        if (entry == NULL)
+            entry = allocate(slot);
+        if ((entry != NULL) && entry->is_valid)
+            return entry;
+        if (is_fetch_failed)
+            break;
+        storage57_poll();
+        hal57_wait_for_interrupt();
+    }
+    return NULL;
+}
+
+/* pack the 16 digits of a register into 8 bytes, and back */
+static void pack_reg(uint8_t* bytes, const ti57_reg_t reg)
+{
+    for (uint8_t i = 0; i < 8; i++)
+        bytes[i] = (reg[2 * i + 1] << 4) | reg[2 * i];
+}
+
+static void unpack_reg(ti57_reg_t reg, const uint8_t* bytes)
+{
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        reg[2 * i] = bytes[i] & 0x0f;
+        reg[2 * i + 1] = bytes[i] >> 4;
+    }
+}
+
+/* the registers of the snapshot, in order */
+static unsigned char* snapshot_reg(ti57_t* ti57, uint8_t i)
+{
+    switch (i)
+    {
+    case 0: return ti57->A;
+    case 1: return ti57->B;
+    case 2: return ti57->C;
+    case 3: return ti57->D;
+    default: return (i < 12) ? ti57->X[i - 4] : ti57->Y[i - 12];
+    }
+}
+
+void storage57_pack_state(uint8_t* bytes, ti57_t* ti57)
+{
+    uint16_t check;
+
+    memset(bytes, 0, STORAGE57_SNAPSHOT_SIZE);
+    bytes[SNAP_MARKER] = STORAGE57_SNAPSHOT_MARKER;
+    bytes[SNAP_FLAGS] = ti57->mode | (ti57->activity << 2) | (ti57->COND << 5) | (ti57->is_hex << 6);
+    bytes[SNAP_R5] = ti57->R5;
+    bytes[SNAP_RAB] = ti57->RAB;
+    bytes[SNAP_PC] = ti57->pc & 0xff;
+    bytes[SNAP_PC + 1] = ti57->pc >> 8;
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        bytes[SNAP_PC + 2 + 2 * i] = ti57->stack[i] & 0xff;
+        bytes[SNAP_PC + 3 + 2 * i] = ti57->stack[i] >> 8;
+    }
+    for (uint8_t i = 0; i < 20; i++)
+        pack_reg(&bytes[SNAP_REGS + 8 * i], snapshot_reg(ti57, i));
+    check = storage57_fletcher16(bytes, SNAP_CHECK);
+    bytes[SNAP_CHECK] = check & 0xff;
+    bytes[SNAP_CHECK + 1] = check >> 8;
+}
+
+bool storage57_unpack_state(ti57_t* ti57, const uint8_t* bytes)
+{
+    uint16_t check = bytes[SNAP_CHECK] | (bytes[SNAP_CHECK + 1] << 8);
+
+    if ((bytes[SNAP_MARKER] != STORAGE57_SNAPSHOT_MARKER) || (storage57_fletcher16(bytes, SNAP_CHECK) != check))
+        return false;
+
+    ti57->mode = (ti57_mode_t)(bytes[SNAP_FLAGS] & 0x03);
+    ti57->activity = (ti57_activity_t)((bytes[SNAP_FLAGS] >> 2) & 0x07);
+    ti57->COND = (bytes[SNAP_FLAGS] >> 5) & 1;
+    ti57->is_hex = (bytes[SNAP_FLAGS] >> 6) & 1;
+    ti57->R5 = bytes[SNAP_R5];
+    ti57->RAB = bytes[SNAP_RAB];
+    ti57->pc = bytes[SNAP_PC] | (bytes[SNAP_PC + 1] << 8);
+    for (uint8_t i = 0; i < 3; i++)
+        ti57->stack[i] = bytes[SNAP_PC + 2 + 2 * i] | (bytes[SNAP_PC + 3 + 2 * i] << 8);
+    for (uint8_t i = 0; i < 20; i++)
+        unpack_reg(snapshot_reg(ti57, i), &bytes[SNAP_REGS + 8 * i]);
+    ti57->is_key_pressed = false;
+    return true;
+}
+
+void storage57_init(bool is_valid)
+{
+    for (uint8_t i = 0; i < STORAGE57_CACHE_SLOTS; i++)
+        cache[i].slot = -1;
+    index_dirty = 0;
+    snapshot_dirty = 0;
+    snapshot_state = SNAPSHOT_UNREAD;
+    state = STORAGE_NONE;
+    if (is_valid == false)
+        return;
+
+    state = STORAGE_LOADING;
+    submit(REQUEST_INDEX, UNIO_OP_READ, STORAGE57_INDEX_OFFSET, index_shadow, STORAGE57_INDEX_SIZE);
+}
+
+void storage57_poll(void)
+{
+    int page;
+
+    if ((state == STORAGE_NONE) || (request.status == UNIO_PENDING))
+        return;
+
+    if (request_kind != REQUEST_NONE)
+        tele57_eeprom(request.op, request.address, request.length, request.status == UNIO_OK);
+
+    /* complete the transfer that ended. A failed page is written again */
+    switch (request_kind)
+    {
+    case REQUEST_INDEX:
+        state = (request.status == UNIO_OK) ? STORAGE_READY : STORAGE_NONE;
+        break;
+    case REQUEST_FETCH:
+        if (request.status == UNIO_OK)
+            request_entry->is_valid = true;
+        else
+        {
+            request_entry->slot = -1;
+            is_fetch_failed = true;
+        }
+        break;
+    case REQUEST_BODY:
+        if (request.status == UNIO_FAILED)
+            request_entry->dirty |= 1 << request_page;
+        break;
+    case REQUEST_PAGE:
+        if (request.status == UNIO_FAILED)
+            index_dirty |= 1 << request_page;
+        break;
+    case REQUEST_SNAPSHOT:
+        snapshot_state = (request.status == UNIO_OK) ? SNAPSHOT_READ : SNAPSHOT_FAILED;
+        break;
+    case REQUEST_SNAPSHOT_PAGE:
+        if (request.status == UNIO_FAILED)
+            snapshot_dirty |= 1 << request_page;
+        break;
+    default:
+        break;
+    }
+    request_kind = REQUEST_NONE;
+    request_entry = NULL;
+    if (state != STORAGE_READY)
+        return;
+
+    /* the snapshot, which the boot waits for */
+    if (snapshot_state == SNAPSHOT_UNREAD)
+    {
+        snapshot_state = SNAPSHOT_READING;
+        submit(REQUEST_SNAPSHOT, UNIO_OP_READ, STORAGE57_SNAPSHOT_OFFSET, snapshot_shadow, STORAGE57_SNAPSHOT_SIZE);
+        return;
+    }
+
+    /* fetches first, as the user waits for them */
+    for (uint8_t i = 0; i < STORAGE57_CACHE_SLOTS; i++)
+    {
+        cache_entry_t* e = &cache[i];
+        if ((e->slot >= 0) && !e->is_valid)
+        {
+            request_entry = e;
+            submit(REQUEST_FETCH, UNIO_OP_READ, body_address(e->slot), e->body, STORAGE57_BODY_SIZE);
+            return;
+        }
+    }
+
+    /* then bodies */
+    for (uint8_t i = 0; i < STORAGE57_CACHE_SLOTS; i++)
+    {
+        cache_entry_t* e = &cache[i];
+        for (page = 0; page < BODY_PAGES; page++)
+        {
+            if (e->dirty & (1 << page))
+            {
+                e->dirty &= ~(1 << page);
+                request_entry = e;
+                request_page = page;
+                submit(REQUEST_BODY, UNIO_OP_WRITE, body_address(e->slot) + page * STORAGE57_PAGE_SIZE,
+                       &e->body[page * STORAGE57_PAGE_SIZE], STORAGE57_PAGE_SIZE);
+                return;
+            }
+        }
+    }
+
+    /* last page first: tails, then directory */
+    for (page = INDEX_PAGES - 1; page >= 0; page--)
+    {
+        if (index_dirty & (1 << page))
+        {
+            index_dirty &= ~(1 << page);
+            request_page = page;
+            submit(REQUEST_PAGE, UNIO_OP_WRITE, STORAGE57_INDEX_OFFSET + page * STORAGE57_PAGE_SIZE,
+                   &index_shadow[page * STORAGE57_PAGE_SIZE], STORAGE57_PAGE_SIZE);
+            return;
+        }
+    }
+
+    /* snapshot, check bytes last */
+    for (page = 0; page < SNAPSHOT_PAGES; page++)
+    {
+        if (snapshot_dirty & (1 << page))
+        {
+            snapshot_dirty &= ~(1 << page);
+            request_page = page;
+            submit(REQUEST_SNAPSHOT_PAGE, UNIO_OP_WRITE, STORAGE57_SNAPSHOT_OFFSET + page * STORAGE57_PAGE_SIZE,
+                   &snapshot_shadow[page * STORAGE57_PAGE_SIZE], STORAGE57_PAGE_SIZE);
+            return;
+        }
+    }
+}
+
+void storage57_flush(void)
+{
+    while ((state == STORAGE_READY) && storage57_is_busy())
+    {
+        storage57_poll();
+        hal57_wait_for_interrupt();
+    }
+}
+
+bool storage57_is_ready(void)
+{
+    return state == STORAGE_READY;
+}
+
+bool storage57_is_busy(void)
+{
+    if ((request.status == UNIO_PENDING) || index_dirty || snapshot_dirty)
+        return true;
+    for (uint8_t i = 0; i < STORAGE57_CACHE_SLOTS; i++)
+    {
+        if (cache[i].dirty)
+            return true;
+    }
+    return false;
+}
+
+uint8_t storage57_get_slot_status(uint8_t slot)
+{
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return STAT_SLOT_VACANT;
+    return index_shadow[DIR(slot)];
+}
+
+uint16_t storage57_get_slot_hash(uint8_t slot)
+{
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return 0;
+    return index_shadow[DIR(slot) + 1] | (index_shadow[DIR(slot) + 2] << 8);
+}
+
+bool storage57_fetch_slot(uint8_t slot)
+{
+    cache_entry_t* entry;
+
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return false;
+
+    entry = find(slot);
+    if (entry == NULL)
+        entry = allocate(slot);
+    return (entry != NULL) && entry->is_valid;
+}
+
+bool storage57_load_slot(uint8_t slot, uint8_t* steps)
+{
+    cache_entry_t* entry;
+
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return false;
+
+    entry = wait_cached(slot);
+    if (entry == NULL)
+        return false;
+    memcpy(steps, entry->body, STORAGE57_BODY_SIZE);
+    memcpy(steps + STORAGE57_BODY_SIZE, &index_shadow[TAIL(slot)], STORAGE57_TAIL_SIZE);
+    return true;
+}
+
+bool storage57_save_slot(uint8_t slot, const uint8_t* steps, uint8_t status)
+{
+    cache_entry_t* entry;
+    uint16_t hash;
+    uint8_t dir[STORAGE57_DIR_ENTRY_SIZE];
+
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return false;
+
+    /* the body is compared with what the EEPROM holds */
+    entry = wait_cached(slot);
+    if (entry == NULL)
+        return false;
+
+    hash = storage57_fletcher16(steps, STORAGE57_STEPS);
+    dir[0] = status;
+    dir[1] = hash & 0xff;
+    dir[2] = hash >> 8;
+
+    update(entry->body, &entry->dirty, 0, steps, STORAGE57_BODY_SIZE);
+    update(index_shadow, &index_dirty, TAIL(slot), steps + STORAGE57_BODY_SIZE, STORAGE57_TAIL_SIZE);
+    update(index_shadow, &index_dirty, DIR(slot), dir, STORAGE57_DIR_ENTRY_SIZE);
+    return true;
+}
+
+bool storage57_recall_slot(uint8_t slot, ti57_t* ti57)
+{
+    cache_entry_t* entry;
+    uint8_t step;
+
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return false;
+
+    entry = wait_cached(slot);
+    if (entry == NULL)
+        return false;
+    for (step = 0; step < STORAGE57_BODY_SIZE; step++)
+        ti57_set_program_opcode(ti57, step, entry->body[step]);
+    for (step = 0; step < STORAGE57_TAIL_SIZE; step++)
+        ti57_set_program_opcode(ti57, STORAGE57_BODY_SIZE + step, index_shadow[TAIL(slot) + step]);
+    return true;
+}
+
+bool storage57_store_slot(uint8_t slot, ti57_t* ti57, uint8_t status)
+{
+    uint8_t steps[STORAGE57_STEPS];
+
+    ti57_get_program_opcodes(ti57, steps);
+    return storage57_save_slot(slot, steps, status);
+}
+
+void storage57_save_snapshot(ti57_t* ti57)
+{
+    uint8_t bytes[STORAGE57_SNAPSHOT_SIZE];
+
+    /* the shadow is only known once read, which the boot waits for */
+    if ((state != STORAGE_READY) || (snapshot_state == SNAPSHOT_UNREAD) || (snapshot_state == SNAPSHOT_READING))
+        return;
+
+    storage57_pack_state(bytes, ti57);
+    update(snapshot_shadow, &snapshot_dirty, 0, bytes, STORAGE57_SNAPSHOT_SIZE);
+    if (snapshot_state != SNAPSHOT_READ)
+    {
+        /* the EEPROM contents are unknown: write it all */
+        snapshot_dirty = (1 << SNAPSHOT_PAGES) - 1;
+        snapshot_state = SNAPSHOT_READ;
+    }
+}
+
+bool storage57_restore_snapshot(ti57_t* ti57)
+{
+    while ((state == STORAGE_LOADING) ||
+            ((state == STORAGE_READY) && (snapshot_state == SNAPSHOT_UNREAD || snapshot_state == SNAPSHOT_READING)))
+    {
+        storage57_poll();
+        hal57_wait_for_interrupt();
+    }
+    if (snapshot_state != SNAPSHOT_READ)
+        return false;
+    return storage57_unpack_state(ti57, snapshot_shadow);
+}
+
+void storage57_invalidate_snapshot(void)
+{
+    uint8_t marker = 0;
+
+    if ((state != STORAGE_READY) || (snapshot_state == SNAPSHOT_UNREAD) || (snapshot_state == SNAPSHOT_READING))
+        return;
+
+    update(snapshot_shadow, &snapshot_dirty, SNAP_MARKER, &marker, 1);
+    if (snapshot_state != SNAPSHOT_READ)
+    {
+        /* the EEPROM contents are unknown: overwrite the marker page */
+        snapshot_dirty |= 1 << (SNAP_MARKER / STORAGE57_PAGE_SIZE);
+    }
+}
+
+bool storage57_set_slot_status(uint8_t slot, uint8_t status)
+{
+    if ((state != STORAGE_READY) || (slot >= STORAGE57_SLOTS))
+        return false;
+    update(index_shadow, &index_dirty, DIR(slot), &status, 1);
+    return true;
+}
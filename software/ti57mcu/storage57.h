@@ -19,48 +19,170 @@ LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
 OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
 WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 
-#ifndef progman_h
-#define progman_h
+#ifndef storage57_h
+#define storage57_h
 
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "state57.h"
+
 
 /* TI-57 program storage using external EEPROM */
 
-/* The 11AA080 EEPROM provides 1024 bytes of storage. This storage
-   is used for both TI-57 "user program" storage, as well as nonvolatile
-   storage of RCL57 configuration values. The 1024 bytes of EEPROM are
-   used in the following fashion:
-   
-   OFFSET	LENGTH	DESCRIPTION
-   ------	------	-----------
-    000h	   1    LED brightness level (1-23)
-	001h	   3	unused
-	004h	  14h	Status bytes for slots 1-20
-	018h	  32h	Program Step bytes for slot #1
-	04Ah	  32h	Program Step bytes for slot #2
-	07Ch	  32h	Program Step bytes for slot #3
-	0AEh	  32h	Program Step bytes for slot #4
-	...
-	39Ch	  32h	Program Step bytes for slot #19
-	3CEh	  32h	Program Step bytes for slot #20
-	
-*/
-
-/** Program Slot status enum */
-typedef enum slot_status_e {
-    OPEN,  		// slot is available & has no content
-    OCCUPIED, // slot is occupied & unlocked
-    LOCKED    // slot is occupied & locked
-} slot_status_t;
-
-/** User Program structure */
-typedef struct user_program_s {
-	unsigned char step[50];			// the 50 program step bytes
-	slot_status_t status;			// the status for this slot
-	unsigned int hash				// the Fletcher hash for this slot
-} user_program_t;
-
-#endif	// progman.h
\ No newline at end of file
+/* The 11AA080 EEPROM provides 1024 bytes of storage, written in 16 byte
+   pages with a 5ms write cycle per page. This storage is used for both
+   TI-57 "user program" storage, as well as nonvolatile storage of RCL57
+   configuration values. Layout version 2 keeps every slot on its own
+   pages, so that a slot is saved with as few page writes as possible:
+
+   OFFSET   LENGTH  DESCRIPTION
+   ------   ------  -----------
+    000h      30h   Status area: journal of 3 status blocks (see addon57.h)
+    030h      2Dh   Directory: status, Fletcher-16 hash (lo, hi) of slots 1-15
+    060h      1Eh   Tails: program steps 48-49 of slots 1-15
+    080h      30h   Body: program steps 0-47 of slot #1 (3 pages)
+    0B0h      30h   Body: program steps 0-47 of slot #2
+    ...
+    320h      30h   Body: program steps 0-47 of slot #15
+    350h      B0h   Snapshot of the TI-57 state, saved at power save entry
+
+   A program step is a full byte (two 4-bit digits, as in the Y registers
+   of the TI-57), so steps are stored as is. 50 steps would take 4 pages
+   per slot; storing the 2 steps that overflow 3 pages in the shared tail
+   pages takes 15 slots to 0x350. Layout version 1 (24 byte status block,
+   then 20 slots of 50 bytes straddling pages) is converted by keeping its
+   settings.
+
+   Page alignment costs 5 of the 20 slots of version 1: 20 slots of 3
+   pages would end at 0x440, past the 1 KB. The directory and tail pages
+   have room for a 16th slot, at 0x350, but the 0x80 bytes left after it
+   could not hold the 174 byte snapshot. The snapshot, which lets the
+   calculator resume after power save, is kept instead of that slot.
+
+   The index (directory and tails, 5 pages) is shadowed in RAM, read in
+   the background at start, so the slot status and hashes are at hand at
+   once. Slot bodies are only read when a slot is fetched, loaded or
+   saved, into a cache of the STORAGE57_CACHE_SLOTS most recently used
+   slots. A save updates the cache and the index and marks the pages that
+   changed, which are then written in the background: bodies and tails
+   first, the directory last, so that a slot is only listed once its
+   steps are in place.
+
+   storage57_recall_slot and storage57_store_slot move a slot straight
+   between the cache and the Y registers of the emulator, one step at a
+   time in their nibble layout. A slot fetched when the user browses to
+   it (some 17ms of UNI/O at 32us per bit) is then recalled well within
+   a display frame.
+
+   The snapshot packs the whole TMC1500 state (registers A-D, X and Y,
+   program counter, subroutine stack, R5, RAB and flags) into 174 bytes,
+   checked by a Fletcher-16 sum. It is saved when the calculator enters
+   power save, writing only the pages that changed (none if the state is
+   unchanged), and restored at boot: the ROM then carries on from where it
+   was, instead of starting from its power up sequence. */
+
+#define STORAGE57_LAYOUT_VERSION (2)
+
+#define STORAGE57_PAGE_SIZE (16)
+#define STORAGE57_SLOTS (15)
+#define STORAGE57_STEPS (50)
+
+#define STORAGE57_STATUS_OFFSET (0x000)
+#define STORAGE57_STATUS_SIZE (0x30)
+#define STORAGE57_DIR_OFFSET (0x030)
+#define STORAGE57_DIR_ENTRY_SIZE (3)
+#define STORAGE57_TAIL_OFFSET (0x060)
+#define STORAGE57_TAIL_SIZE (2)
+#define STORAGE57_BODY_OFFSET (0x080)
+#define STORAGE57_BODY_SIZE (STORAGE57_STEPS - STORAGE57_TAIL_SIZE)
+#define STORAGE57_SNAPSHOT_OFFSET (0x350)
+#define STORAGE57_SNAPSHOT_SIZE (0xB0)
+#define STORAGE57_SNAPSHOT_MARKER (0x57)
+
+/* index shadowed in RAM: directory and tails */
+#define STORAGE57_INDEX_OFFSET STORAGE57_DIR_OFFSET
+#define STORAGE57_INDEX_SIZE (STORAGE57_BODY_OFFSET - STORAGE57_DIR_OFFSET)
+
+/* slot bodies cached in RAM */
+#define STORAGE57_CACHE_SLOTS (3)
+
+/* slot status, in the directory. An erased EEPROM has all slots vacant */
+#define STAT_SLOT_VACANT (0)
+#define STAT_SLOT_OCCUPIED (1)
+#define STAT_SLOT_LOCKED (128+1)
+
+/** start loading the index in the background, if the EEPROM status
+    block is valid */
+void storage57_init(bool is_valid);
+
+/** read the next fetched slot, or write the next changed page, once the
+    previous transfer is done - call from the main loop */
+void storage57_poll(void);
+
+/** sleep until all changed pages are written */
+void storage57_flush(void);
+
+/** true once the index is loaded */
+bool storage57_is_ready(void);
+
+/** true while changed pages are waiting to be written */
+bool storage57_is_busy(void);
+
+/** status of slot 0-14 */
+uint8_t storage57_get_slot_status(uint8_t slot);
+
+/** Fletcher-16 hash of the steps of slot 0-14 */
+uint16_t storage57_get_slot_hash(uint8_t slot);
+
+/** start reading slot 0-14 into the cache, e.g. when the user browses
+    to it. Returns true if it is cached already */
+bool storage57_fetch_slot(uint8_t slot);
+
+/** copy the 50 steps of slot 0-14, sleeping until the slot is cached.
+    Returns false if not ready, or if the EEPROM could not be read */
+bool storage57_load_slot(uint8_t slot, uint8_t* steps);
+
+/** save 50 steps into slot 0-14 with a status; only the pages that
+    changed are written. Sleeps until the slot is cached. Returns false
+    if not ready, or if the EEPROM could not be read */
+bool storage57_save_slot(uint8_t slot, const uint8_t* steps, uint8_t status);
+
+/** load slot 0-14 into the program steps of ti57, sleeping until the
+    slot is cached. Returns false if not ready, or if the EEPROM could
+    not be read */
+bool storage57_recall_slot(uint8_t slot, ti57_t* ti57);
+
+/** save the program steps of ti57 into slot 0-14 with a status, as
+    storage57_save_slot */
+bool storage57_store_slot(uint8_t slot, ti57_t* ti57, uint8_t status);
+
+/** pack the state of ti57 into STORAGE57_SNAPSHOT_SIZE bytes, in the
+    snapshot layout (also the state dump of cmd57.h) */
+void storage57_pack_state(uint8_t* bytes, ti57_t* ti57);
+
+/** unpack a state packed by storage57_pack_state into ti57. Returns
+    false, leaving ti57 unchanged, if its marker or check is wrong */
+bool storage57_unpack_state(ti57_t* ti57, const uint8_t* bytes);
+
+/** save the state of ti57 into the snapshot; only the pages that
+    changed are written */
+void storage57_save_snapshot(ti57_t* ti57);
+
+/** restore the state of ti57 from the snapshot, sleeping until it is
+    read. Returns false if there is no valid snapshot */
+bool storage57_restore_snapshot(ti57_t* ti57);
+
+/** clear the marker of the snapshot once the calculator runs again, so
+    that it is only valid while in power save and a later power up cold
+    starts. The page is written by storage57_poll */
+void storage57_invalidate_snapshot(void);
+
+/** change the status of slot 0-14 (lock, unlock, vacate) */
+bool storage57_set_slot_status(uint8_t slot, uint8_t status);
+
+/** Fletcher-16 checksum, used as a program "label" */
+uint16_t storage57_fletcher16(const uint8_t* data, int count);
+
+#endif /* storage57_h */
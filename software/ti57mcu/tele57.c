@@ -0,0 +1,223 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+#include "tele57.h"
+#include "rcl57mcu.h"
+#include "hal57.h"
+#include <string.h>
+
+#define TICKS_PER_MS (1000 / SYSTICK_PERIOD_US)
+
+/* ring buffer: bytes from 'tail' to 'head' are queued, the first
+   'in_flight' of them handed to the DMA. One byte is kept free so that
+   a full buffer is told apart from an empty one */
+static uint8_t ring[TELE57_BUFFER_SIZE];
+static uint8_t head;
+static uint8_t tail;
+static uint8_t in_flight;
+static uint16_t dropped;
+
+static volatile uint32_t ticks;
+static uint32_t cycles_ticks;
+static uint8_t last_display[12];
+
+static uint8_t get_free(void)
+{
+    return (uint8_t)(tail - head - 1);
+}
+
+/* write a record, which must fit */
+static void put_record(uint8_t type, const uint8_t* payload, uint8_t length)
+{
+    uint16_t ms = (uint16_t)(ticks / TICKS_PER_MS);
+    uint8_t header[4] = { type, (uint8_t)ms, (uint8_t)(ms >> 8), length };
+    uint8_t check = 0;
+
+    ring[head++] = TELE57_SYNC;
+    for (uint8_t i = 0; i < sizeof(header); i++)
+    {
+        check += header[i];
+        ring[head++] = header[i];
+    }
+    for (uint8_t i = 0; i < length; i++)
+    {
+        check += payload[i];
+        ring[head++] = payload[i];
+    }
+    ring[head++] = (uint8_t)-check;
+}
+
+/* queue a record after the count of the records dropped before it, or
+   count it as dropped too */
+static void queue(uint8_t type, const uint8_t* payload, uint8_t length)
+{
+    uint8_t count[2];
+    uint16_t needed = TELE57_OVERHEAD + length;
+
+    if (dropped != 0)
+        needed += TELE57_OVERHEAD + sizeof(count);
+    if (needed > get_free())
+    {
+        dropped++;
+        return;
+    }
+    if (dropped != 0)
+    {
+        count[0] = (uint8_t)dropped;
+        count[1] = (uint8_t)(dropped >> 8);
+        put_record(TELE57_DROPPED, count, sizeof(count));
+        dropped = 0;
+    }
+    put_record(type, payload, length);
+    tele57_poll();
+}
+
+void tele57_init(void)
+{
+    head = 0;
+    tail = 0;
+    in_flight = 0;
+    dropped = 0;
+    ticks = 0;
+    cycles_ticks = 0;
+    memset(last_display, 0xFF, sizeof(last_display));
+}
+
+void tele57_tick(void)
+{
+    ticks++;
+}
+
+/* hand the queued bytes up to the end of the ring buffer to the DMA */
+void tele57_poll(void)
+{
+    if (hal57_usart_busy())
+        return;
+
+    tail += in_flight;
+    if (head == tail)
+        in_flight = 0;
+    else
+    {
+        in_flight = (head > tail) ? (uint8_t)(head - tail) : (uint8_t)(TELE57_BUFFER_SIZE - tail);
+        hal57_usart_stream(&ring[tail], in_flight);
+    }
+}
+
+uint32_t tele57_get_time(void)
+{
+    return ticks / TICKS_PER_MS;
+}
+
+void tele57_text(const char* text)
+{
+    size_t length = strlen(text);
+
+    queue(TELE57_TEXT, (const uint8_t*)text, (length > TELE57_MAX_PAYLOAD) ? TELE57_MAX_PAYLOAD : (uint8_t)length);
+}
+
+void tele57_key(uint8_t scancode, bool is_press)
+{
+    uint8_t payload[2] = { scancode, is_press ? 1 : 0 };
+
+    queue(TELE57_KEY, payload, sizeof(payload));
+}
+
+/* the TI-57 registers hold the leftmost digit in nibble 11 */
+void tele57_display(const uint8_t digits[16], const uint8_t mask[16])
+{
+    uint8_t payload[12];
+
+    for (uint8_t i = 0; i < 12; i++)
+        payload[i] = (uint8_t)((mask[11 - i] << 4) | (digits[11 - i] & 0x0F));
+    if (memcmp(payload, last_display, sizeof(payload)) == 0)
+        return;
+    memcpy(last_display, payload, sizeof(payload));
+    queue(TELE57_DISPLAY, payload, sizeof(payload));
+}
+
+void tele57_cycles(uint32_t cycles)
+{
+    uint8_t payload[4] = { (uint8_t)cycles, (uint8_t)(cycles >> 8), (uint8_t)(cycles >> 16), (uint8_t)(cycles >> 24) };
+
+    if ((ticks - cycles_ticks) < (TELE57_CYCLES_PERIOD_MS * TICKS_PER_MS))
+        return;
+    cycles_ticks = ticks;
+    queue(TELE57_CYCLES, payload, sizeof(payload));
+}
+
+void tele57_eeprom(uint8_t op, uint16_t address, uint16_t length, bool is_ok)
+{
+    uint8_t payload[5] = { op, (uint8_t)address, (uint8_t)(address >> 8), (uint8_t)length, is_ok ? 1 : 0 };
+
+    queue(TELE57_EEPROM, payload, sizeof(payload));
+}
+
+bool tele57_has_room(uint8_t length)
+{
+    uint16_t needed = TELE57_OVERHEAD + length;
+
+    if (dropped != 0)
+        needed += TELE57_OVERHEAD + 2;
+    return needed <= get_free();
+}
+
+void tele57_block(uint8_t type, uint8_t offset, const uint8_t* bytes, uint8_t n)
+{
+    uint8_t payload[1 + TELE57_MAX_PAYLOAD];
+
+    if (n > TELE57_MAX_PAYLOAD)
+        n = TELE57_MAX_PAYLOAD;
+    payload[0] = offset;
+    memcpy(&payload[1], bytes, n);
+    queue(type, payload, 1 + n);
+}
+
+/* write n 32 bit words into bytes, lsb first */
+static void put_words(uint8_t* bytes, const uint32_t* words, uint8_t n)
+{
+    for (uint8_t i = 0; i < n; i++)
+    {
+        bytes[4 * i] = (uint8_t)words[i];
+        bytes[4 * i + 1] = (uint8_t)(words[i] >> 8);
+        bytes[4 * i + 2] = (uint8_t)(words[i] >> 16);
+        bytes[4 * i + 3] = (uint8_t)(words[i] >> 24);
+    }
+}
+
+void tele57_profile(uint32_t cycles, uint32_t disps, uint32_t ms)
+{
+    uint32_t counts[3] = { cycles, disps, ms };
+    uint8_t payload[sizeof(counts)];
+
+    put_words(payload, counts, 3);
+    queue(TELE57_PROFILE, payload, sizeof(payload));
+}
+
+void tele57_section(uint8_t section, uint32_t frames, uint32_t min, uint32_t max, uint32_t total)
+{
+    uint32_t counts[4] = { frames, min, max, total };
+    uint8_t payload[1 + sizeof(counts)];
+
+    payload[0] = section;
+    put_words(&payload[1], counts, 4);
+    queue(TELE57_SECTION, payload, sizeof(payload));
+}
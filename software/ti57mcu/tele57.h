@@ -0,0 +1,148 @@
+/* Copyright (C) 2024 by Tom LeMense <https:github.com/tomcircuit>
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be
+included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE
+LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
+
+#ifndef tele57_h
+#define tele57_h
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/* Telemetry over USART1 */
+
+/* Diagnostics are sent as compact binary records. A record is queued in
+   a RAM ring buffer and sent by DMA (hal57_usart_stream), so queueing it
+   takes a few microseconds instead of the 43us per character of a
+   blocking write at 230400 bps, and telemetry can stay on without
+   perturbing the emulation. A record that does not fit in the buffer is
+   dropped and counted, and the count is sent once there is room again.
+   Records are queued from the foreground only.
+
+   Record layout:
+
+   OFFSET   LENGTH  DESCRIPTION
+   ------   ------  -----------
+     0        1     TELE57_SYNC
+     1        1     type
+     2        2     time in ms since reset, lsb first (wraps after 65s)
+     4        1     payload length n
+     5        n     payload
+    5+n       1     check: the bytes from type to check sum to 0 (mod 256)
+
+   TYPE             PAYLOAD
+   ----             -------
+   TELE57_TEXT      ASCII text (status messages)
+   TELE57_KEY       scancode, 1 = press or 0 = release (KBD57_FAULT: ADC fault)
+   TELE57_DISPLAY   12 digits, leftmost first: mask << 4 | digit (see mux57.h)
+   TELE57_CYCLES    TMC1500 cycles executed, 32 bits lsb first
+   TELE57_EEPROM    unio_op_t, address (16 bits lsb first), length, 1 = ok or 0 = failed
+   TELE57_DROPPED   records dropped, 16 bits lsb first
+   TELE57_STATE     offset, then bytes of a state dump (storage57_pack_state)
+   TELE57_PROGRAM   first step, then program steps
+   TELE57_PROFILE   TMC1500 cycles, DISPs and ms profiled, 32 bits each lsb first
+   TELE57_SECTION   prof57_section_t, then frames, min, max and total MCU
+                    cycles per frame (prof57.h), 32 bits each lsb first
+
+   The host decoder (teledec57.c) hunts for TELE57_SYNC, and when a check
+   fails it hunts again from the byte after that TELE57_SYNC. */
+
+#define TELE57_SYNC (0xA5)
+
+#define TELE57_TEXT (1)
+#define TELE57_KEY (2)
+#define TELE57_DISPLAY (3)
+#define TELE57_CYCLES (4)
+#define TELE57_EEPROM (5)
+#define TELE57_DROPPED (6)
+#define TELE57_STATE (7)
+#define TELE57_PROGRAM (8)
+#define TELE57_PROFILE (9)
+#define TELE57_SECTION (10)
+
+#define TELE57_OVERHEAD (6)
+#define TELE57_MAX_PAYLOAD (32)
+
+/* ring buffer size: 256, so that its 8 bit indices wrap around by themselves */
+#define TELE57_BUFFER_SIZE (256)
+
+/* period of the TELE57_CYCLES records */
+#define TELE57_CYCLES_PERIOD_MS (1000)
+
+/** empty the buffer and reset the time */
+void tele57_init(void);
+
+/** advance the time by one SysTick period - call from the SysTick ISR */
+void tele57_tick(void);
+
+/** start sending the queued records, if the previous DMA transfer is
+    done. Records start it themselves, this sends what is left after the
+    end of the ring buffer */
+void tele57_poll(void);
+
+/** time in ms since tele57_init, as stamped on the records (unwrapped) */
+uint32_t tele57_get_time(void);
+
+/** queue a text (at most TELE57_MAX_PAYLOAD characters are sent) */
+void tele57_text(const char* text);
+
+/** queue a key press or release */
+void tele57_key(uint8_t scancode, bool is_press);
+
+/** queue the display digits and masks, if they changed since the last time */
+void tele57_display(const uint8_t digits[16], const uint8_t mask[16]);
+
+/** queue the cycle count, if TELE57_CYCLES_PERIOD_MS has elapsed since the last time */
+void tele57_cycles(uint32_t cycles);
+
+/** queue an EEPROM transfer */
+void tele57_eeprom(uint8_t op, uint16_t address, uint16_t length, bool is_ok);
+
+/** true if a record with a payload of 'length' bytes can be queued now */
+bool tele57_has_room(uint8_t length);
+
+/** queue a block of a dump, as a TELE57_STATE or TELE57_PROGRAM record
+    (n at most TELE57_MAX_PAYLOAD) */
+void tele57_block(uint8_t type, uint8_t offset, const uint8_t* bytes, uint8_t n);
+
+/** queue the counts of a profile (cmd57.h "prof stop") */
+void tele57_profile(uint32_t cycles, uint32_t disps, uint32_t ms);
+
+/** queue the cycle counts of a profiled section (prof57.h) */
+void tele57_section(uint8_t section, uint32_t frames, uint32_t min, uint32_t max, uint32_t total);
+
+/** host decoder state (teledec57.c) */
+typedef struct
+{
+    uint8_t record[TELE57_OVERHEAD + 255];
+    int count;              // bytes of the record received
+    uint32_t time;          // ms, unwrapped
+    bool has_cycles;
+    uint32_t cycles;        // last TELE57_CYCLES count, and its time
+    uint32_t cycles_time;
+    uint32_t frame_total;   // MCU cycles of the frames of the last profile
+} teledec57_t;
+
+/** decode the next byte of the stream. Returns true when it completes a
+    record, written as a line of text into line */
+bool teledec57_feed(teledec57_t* dec, uint8_t byte, char* line, size_t size);
+
+#endif /* tele57_h */
@@ -0,0 +1,204 @@
+/**
+ * Decodes the telemetry records of tele57.h into lines of text.
+ *
+ * Usage, with the USART1 TXD of the debug header on a serial adapter set
+ * to 230400 bps, raw:
+ *   stty -F /dev/ttyUSB0 230400 raw
+ *   teledec57 < /dev/ttyUSB0
+ *
+ * Build on the host from the software directory:
+ *   gcc -std=gnu11 -Iti57mcu -o teledec57 ti57mcu/teledec57.c
+ *
+ * The board simulator links teledec57_feed() to print the USART output,
+ * without main().
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "prof57.h"
+#include "tele57.h"
+
+/** unio_op_t names. */
+static const char *OPS[] = {
+    "read", "write", "read status", "write status", "enable write", "disable write",
+    "erase all", "set all", "await write"
+};
+
+/** prof57_section_t names. */
+static const char *SECTIONS[PROF57_SECTION_COUNT] = {
+    "frame", "emulation", "scan", "keyboard", "unio", "systick", "idle"
+};
+
+/** A 32 bit count, lsb first. */
+static uint32_t get_word(const uint8_t *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/** Formats the display as mux57_display_to_str() would. */
+static void format_display(const uint8_t *payload, char *str)
+{
+    static const char DIGITS[] = "0123456789AbCdEF";
+    int k = 0;
+
+    for (int i = 0; i < 12; i++) {
+        int mask = payload[i] >> 4, digit = payload[i] & 0x0f;
+        if (mask & 0x8) {
+            str[k++] = ' ';
+        } else if (mask & 0x1) {
+            str[k++] = '-';
+        } else {
+            str[k++] = DIGITS[digit];
+        }
+        if (mask & 0x2) str[k++] = '.';
+    }
+    str[k] = 0;
+}
+
+static void format_record(teledec57_t *dec, char *line, size_t size)
+{
+    const uint8_t *r = dec->record;
+    const uint8_t *payload = r + 5;
+    int type = r[1], length = r[4];
+    char str[32];
+
+    // The time is 16 bits of ms: unwrapped, records being less than 65s apart.
+    dec->time += (uint16_t)((r[2] | r[3] << 8) - dec->time);
+    int n = snprintf(line, size, "%9.3f s  ", dec->time / 1000.0);
+    line += n;
+    size -= n;
+
+    switch (type) {
+    case TELE57_TEXT:
+        snprintf(line, size, "text     %.*s", length, (const char *)payload);
+        break;
+    case TELE57_KEY:
+        if (length < 2) goto bad;
+        if (payload[0] == 0xff) {
+            snprintf(line, size, "key      ADC fault");
+        } else {
+            snprintf(line, size, "key      %02X %s", payload[0], payload[1] ? "press" : "release");
+        }
+        break;
+    case TELE57_DISPLAY:
+        if (length < 12) goto bad;
+        format_display(payload, str);
+        snprintf(line, size, "display  [%s]", str);
+        break;
+    case TELE57_CYCLES: {
+        if (length < 4) goto bad;
+        uint32_t cycles = payload[0] | payload[1] << 8 | payload[2] << 16 | (uint32_t)payload[3] << 24;
+        if (dec->has_cycles && dec->time > dec->cycles_time) {
+            snprintf(line, size, "cycles   %lu (%.0f/s)", (unsigned long)cycles,
+                     (double)(cycles - dec->cycles) * 1000 / (dec->time - dec->cycles_time));
+        } else {
+            snprintf(line, size, "cycles   %lu", (unsigned long)cycles);
+        }
+        dec->has_cycles = true;
+        dec->cycles = cycles;
+        dec->cycles_time = dec->time;
+        break;
+    }
+    case TELE57_EEPROM:
+        if (length < 5) goto bad;
+        snprintf(line, size, "eeprom   %s 0x%03X %d %s",
+                 payload[0] < sizeof(OPS) / sizeof(OPS[0]) ? OPS[payload[0]] : "?",
+                 payload[1] | payload[2] << 8, payload[3], payload[4] ? "ok" : "failed");
+        break;
+    case TELE57_DROPPED:
+        if (length < 2) goto bad;
+        snprintf(line, size, "dropped  %d records", payload[0] | payload[1] << 8);
+        break;
+    case TELE57_STATE:
+    case TELE57_PROGRAM:
+        if (length < 1) goto bad;
+        // The offset of a state dump is in bytes, that of a program in steps.
+        if (type == TELE57_STATE) {
+            n = snprintf(line, size, "state    %02X ", payload[0]);
+        } else {
+            n = snprintf(line, size, "program  %02d ", payload[0]);
+        }
+        for (int i = 1; i < length && n + 3 < (int)size; i++) {
+            n += snprintf(line + n, size - n, "%02X", payload[i]);
+        }
+        break;
+    case TELE57_PROFILE: {
+        if (length < 12) goto bad;
+        uint32_t counts[3] = {get_word(payload), get_word(payload + 4), get_word(payload + 8)};
+        snprintf(line, size, "profile  %lu cycles, %lu disps in %lu ms (%.0f cycles/s)",
+                 (unsigned long)counts[0], (unsigned long)counts[1], (unsigned long)counts[2],
+                 counts[2] ? (double)counts[0] * 1000 / counts[2] : 0.0);
+        break;
+    }
+    case TELE57_SECTION: {
+        if (length < 17 || payload[0] >= PROF57_SECTION_COUNT) goto bad;
+        uint32_t frames = get_word(payload + 1), total = get_word(payload + 13);
+        // The whole frame comes first, and is the reference of the shares.
+        if (payload[0] == PROF57_FRAME) dec->frame_total = total;
+        snprintf(line, size, "section  %-9s cycles/frame min %lu avg %lu max %lu, %.1f%%",
+                 SECTIONS[payload[0]], (unsigned long)get_word(payload + 5),
+                 (unsigned long)(frames ? total / frames : 0), (unsigned long)get_word(payload + 9),
+                 dec->frame_total ? 100.0 * total / dec->frame_total : 0.0);
+        break;
+    }
+    default:
+    bad:
+        snprintf(line, size, "unknown  type %d, %d bytes", type, length);
+        break;
+    }
+}
+
+/** Drops the bytes before the next sync byte at or after 'from'. */
+static void resync(teledec57_t *dec, int from)
+{
+    int i = from;
+
+    while (i < dec->count && dec->record[i] != TELE57_SYNC) {
+        i++;
+    }
+    memmove(dec->record, dec->record + i, dec->count - i);
+    dec->count -= i;
+}
+
+bool teledec57_feed(teledec57_t *dec, uint8_t byte, char *line, size_t size)
+{
+    // Hunt for the sync byte.
+    if (dec->count == 0 && byte != TELE57_SYNC) return false;
+    dec->record[dec->count++] = byte;
+
+    for (;;) {
+        if (dec->count < TELE57_OVERHEAD) return false;
+        int length = TELE57_OVERHEAD + dec->record[4];
+        if (dec->count < length) return false;
+
+        uint8_t check = 0;
+        for (int i = 1; i < length; i++) {
+            check += dec->record[i];
+        }
+        if (check == 0) {
+            format_record(dec, line, size);
+            resync(dec, length);
+            return true;
+        }
+        // Not a record: hunt again from the byte after its sync byte.
+        resync(dec, 1);
+    }
+}
+
+#ifndef HAL57_SIM
+int main(void)
+{
+    teledec57_t dec = {0};
+    char line[128];
+    int c;
+
+    while ((c = getchar()) != EOF) {
+        if (teledec57_feed(&dec, (uint8_t)c, line, sizeof(line))) {
+            printf("%s\n", line);
+            fflush(stdout);
+        }
+    }
+    return 0;
+}
+#endif
@@ -27,10 +27,10 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 #include <stddef.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include "stm32f10x.h"
+#include "hal57.h"
 
 /* Functions to access Microchip UNI/O devices connected to any open-drain
-   capable GPIO pin of an STM32F103, such as the 11AA02E48 eeprom chip.
+   capable GPIO pin (through hal57.h), such as the 11AA02E48 eeprom chip.
    Multiple UNI/O devices may be connected to this pin, provided they
    have different addresses. The 11AA161 2048-uint8_t EEPROM has address
    0xa1, and so may be connected along with the 11AA02E48 if the
@@ -66,18 +66,15 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 /* Additional margin to all the times defined above to ensure compliance (e.g. fast HSI) */
 #define UNIO_MARGIN_US (5u)
 
-/* macros for UNIO pin maniuplation - here, B0 is assumed */
-#define UNIO_LOW  do { GPIOB->BRR = GPIO_Pin_0; } while (0)
-#define UNIO_HIGH do { GPIOB->BSRR = GPIO_Pin_0; } while (0)
-#define UNIO_INP (GPIOB->IDR & GPIO_IDR_IDR0)
+/* macros for UNIO pin maniuplation - B0 on PCB V2, see hal57.h */
+#define UNIO_LOW  hal57_unio_set(false)
+#define UNIO_HIGH hal57_unio_set(true)
+#define UNIO_INP  hal57_unio_get()
 
-/* macros for GPT bit timing */
-#define GPT_START do { TIM3->CR1 |= TIM_CR1_CEN; } while (0)
-#define GPT_STOP  do { TIM3->CR1 &= ~(TIM_CR1_CEN); } while (0)
-#define GPT_RELOAD(val) do { TIM3->ARR = (val); } while (0)
-#define GPT_UPDATE do { TIM3->EGR |= TIM_EGR_UG ; } while (0)
-#define GPT_DELAY do { __NOP(); } while (TIM3->CR1 & TIM_CR1_CEN)
-#define GPT_RUNNING (TIM3->CR1 & TIM_CR1_CEN)
+/* macros for the bit timing alarms - TIM3 compare interrupt, 1us per tick */
+#define GPT_ALARM_START(us) hal57_timer_alarm_start(us)
+#define GPT_ALARM_NEXT(us)  hal57_timer_alarm_next(us)
+#define GPT_ALARM_STOP      hal57_timer_alarm_stop()
 
 /* UNIO bus timing constants - all derived from UNIO_BIT_US */
 #define UNIO_BIT_US (32u)
@@ -85,34 +82,85 @@ WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.  */
 #define UNIO_QUARTER_BIT_US (UNIO_BIT_US / 4u)
 #define UNIO_THREE_QUARTER_BIT_US (UNIO_HALF_BIT_US + UNIO_QUARTER_BIT_US)
 
-/* Put the UNIO bus to sleep. This assumes that both TIM3 and GPIOx
-   have already been enabled and initialized */
+/* Low time actually driven for the start header, well above UNIO_THDR_US */
+#define UNIO_HEADER_LOW_US (70u)
+
+/* While a write cycle is in progress (5ms max), the status register is
+   read every UNIO_POLL_US, at most UNIO_POLL_LIMIT times */
+#define UNIO_POLL_US (500u)
+#define UNIO_POLL_LIMIT (40u)
+
+/* Number of requests that may be queued - a power of 2 */
+#define UNIO_QUEUE_SIZE (4u)
+
+/* The bus is clocked by an asynchronous engine: every quarter bit, the
+   TIM3 compare interrupt drives or samples the bus and schedules the
+   next compare, so that UNI/O transfers overlap with the emulation and
+   the display scan. TIM3 has a higher priority than SysTick, which it
+   preempts, so the bit timing does not depend on the scan ISR.
+
+   Each request is a complete operation: the engine sets the write enable
+   bit before any write, splits writes at page boundaries and polls the
+   status register until each write cycle is over. After a failed command
+   the next one is preceded by a standby pulse. */
+typedef enum
+{
+    UNIO_OP_READ,           // read 'length' bytes at 'address' into 'buffer'
+    UNIO_OP_WRITE,          // write 'length' bytes of 'buffer' at 'address'
+    UNIO_OP_READ_STATUS,    // read the status register into buffer[0]
+    UNIO_OP_WRITE_STATUS,   // write buffer[0] into the status register
+    UNIO_OP_ENABLE_WRITE,   // set the write enable bit
+    UNIO_OP_DISABLE_WRITE,  // clear the write enable bit
+    UNIO_OP_ERASE_ALL,      // clear the whole device to 0x00
+    UNIO_OP_SET_ALL,        // set the whole device to 0xFF
+    UNIO_OP_AWAIT_WRITE     // wait for the write cycle in progress to end
+} unio_op_t;
+
+typedef enum
+{
+    UNIO_OK,
+    UNIO_FAILED,            // NoSAK, or write cycle never ended
+    UNIO_PENDING            // queued or running
+} unio_status_t;
+
+/* A request is owned by the caller, and must stay in place (with its
+   buffer) until its status is no longer UNIO_PENDING */
+typedef struct unio_request_s
+{
+    uint8_t dev_address;
+    unio_op_t op;
+    uint16_t address;
+    uint8_t* buffer;
+    uint16_t length;        // at least 1 for UNIO_OP_READ and UNIO_OP_WRITE
+    void (*done)(struct unio_request_s* request);   // called from the TIM3 ISR, or NULL
+    volatile unio_status_t status;
+} unio_request_t;
+
+/* Reset the engine and empty the queue. This does NOT init the MCU TIM3
+   and GPIO resources! The next command is preceded by a standby pulse */
 void UNIO_init();
 
-/* All the following calls return true for success and false for
-   failure. */
+/* Queue a request, from the main loop only. Returns false if the queue
+   is full. The request status is UNIO_PENDING until it is done, then
+   its done() callback is called from the TIM3 ISR */
+bool UNIO_submit(unio_request_t* request);
+
+/* true while requests are queued or running */
+bool UNIO_is_busy(void);
+
+/* TIM3 compare interrupt: clocks the engine */
+void TIM3_IRQHandler(void);
+
+/* The following calls queue a request and sleep until it is done. They
+   return true for success and false for failure. */
 
 /* Read from memory into the buffer, starting at 'address' in the
    device, for 'length' uint8_ts.  Note that on failure the buffer may
    still have been overwritten. */
 bool UNIO_read(uint8_t unio_address, uint8_t* buffer, uint16_t address, uint16_t length);
 
-/* Write data to memory.  The write must not overlap a page
-   boundary; pages are 16 uint8_ts long, starting at zero.  Will return
-   false if this condition is not met, or if there is a problem
-   communicating with the device.  If the write enable bit is not
-   set, this call will appear to succeed but will do nothing.
-
-   This call returns as soon as the data has been sent to the
-   device.  The write proceeds in the background.  You must check
-   the status register to find out when the write has completed,
-   before setting the write enable bit and writing more data.  Call
-   await_write_complete() if you want to block until the write is
-   finished. */
-bool UNIO_start_write(uint8_t unio_address, const uint8_t* buffer, uint16_t address, uint16_t length);
-
-/* Set the write enable bit.  This must be done before EVERY write;
-   the bit is cleared on a successful write. */
+/* Set the write enable bit.  The engine does it before every write,
+   so this is mostly useful to check that the device answers. */
 bool UNIO_enable_write(uint8_t unio_address);
 
 /* Clear the write enable bit. */
@@ -125,35 +173,28 @@ bool UNIO_disable_write(uint8_t unio_address);
    0x08 - block protect 1 */
 bool UNIO_read_status(uint8_t unio_address, uint8_t* status);
 
-/* Write to the status register.  Bits are as shown above; only bits
-   BP0 and BP1 may be written.  Values that may be written are:
+/* Write to the status register, and wait for the write to complete.
+   Only bits BP0 and BP1 may be written.  Values that may be written are:
    0x00 - entire device may be written
    0x04 - upper quarter of device is write-protected
    0x08 - upper half of device is write-protected
-   0x0c - whole device is write-protected
-
-   The write enable bit must be set before a write to the status
-   register will succeed.  The bit will be cleared on a successful
-   write.  You must wait for the write in progress bit to be clear
-   before continuing (call await_write_complete()).  */
+   0x0c - whole device is write-protected */
 bool UNIO_write_status(uint8_t unio_address, uint8_t status);
 
 /* Wait until there is no write operation in progress. */
 bool UNIO_await_write_complete(uint8_t unio_address);
 
-/* Write to the device, dealing properly with setting the write
-   enable bit, avoiding writing over page boundaries, and waiting
-   for the write to complete.  Note that this function may take a
-   long time to complete - approximately 5ms per 16 uint8_ts or part
+/* Write to the device, page by page, waiting for the write to complete.
+   Note that this takes approximately 5ms per 16 uint8_ts or part
    thereof.  Will NOT alter the write-protect bits, so will not
    write to write-protected parts of the device - although the
    return code will not indicate that this has failed. */
 bool UNIO_simple_write(uint8_t unio_address, const uint8_t* buffer, uint16_t address, uint16_t length);
 
-/* Bulk erase the EERPOM.  Must enable writes prior to issuing this command */
+/* Bulk erase the EEPROM, and wait for the erase to complete. */
 bool UNIO_erase_all(uint8_t dev_address);
 
-/* Bulk set the EERPOM to 0xFF.  Must enable writes prior to issuing this command */
+/* Bulk set the EEPROM to 0xFF, and wait for the set to complete. */
 bool UNIO_set_all(uint8_t dev_address);
 
 
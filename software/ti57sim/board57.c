@@ -0,0 +1,444 @@
+/**
+ * Model of the RCL-57 retrofit PCB V2, behind the hal57.h functions.
+ *
+ * - Segment drivers: 8 PMOS high side switches, one per segment line,
+ *   turned on by driving their gate (PA5-PA12) low.
+ * - Digit driver: a TLC5929 with a 17 bit shift register (bit 16 selects
+ *   the control register on LATCH) and 16 constant current outputs, fed
+ *   by SPI1 either polled or by DMA. OUT0
+ *   sinks digit 12 (leftmost), OUT11 digit 1. Digit 12 can also be sunk
+ *   directly by PB4.
+ * - Keypad: each key connects a segment line (row) to a column input K1-K5,
+ *   so a column reads high only while the segment line of a pressed key
+ *   is driven.
+ * - TIM3: a 1us counter whose compare interrupt (TIM3_IRQHandler) is
+ *   raised at the time set by the firmware, preempting SysTick.
+ * - Clock tree: 8 MHz on HSI, or 24 and 64 MHz on the PLL, which takes
+ *   SIM57_PLL_LOCK_US to lock.
+ * - STOP mode: the clocks stop until a key pulls a column input high
+ *   (EXTI), then the clock tree is restarted.
+ *
+ * The display is reconstructed the way the eye sees it: for each digit and
+ * segment, the time both the segment line and the digit sink are on is
+ * integrated over a frame window, and segments lit long enough count as
+ * lit. The decoded display is printed when it changes and is stable for 2
+ * windows.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hal57.h"
+#include "sim57.h"
+
+/** Minimum lit time, in a frame window, for a segment to be seen. */
+#define LIT_THRESHOLD SIM57_US(50)
+
+/** ADC readings of a column with its key closed and open. */
+#define ADC_CLOSED 4000
+#define ADC_OPEN 40
+
+/** Segments (E F B G C A D in TMC1500 order, bits 0-6) of the characters. */
+static const struct {
+    char c;
+    const char *segments;
+} CHARACTERS[] = {
+    {' ', ""}, {'0', "ABCDEF"}, {'1', "BC"}, {'2', "ABDEG"}, {'3', "ABCDG"},
+    {'4', "BCFG"}, {'5', "ACDFG"}, {'6', "ACDEFG"}, {'7', "ABC"}, {'8', "ABCDEFG"},
+    {'9', "ABCDFG"}, {'A', "ABCEFG"}, {'b', "CDEFG"}, {'C', "ADEF"}, {'d', "BCDEG"},
+    {'E', "ADEFG"}, {'F', "AEFG"}, {'G', "ACDEF"}, {'H', "BCEFG"}, {'J', "BCDE"},
+    {'L', "DEF"}, {'n', "CEG"}, {'o', "CDEG"}, {'P', "ABEFG"}, {'r', "EG"},
+    {'t', "DEFG"}, {'U', "BCDEF"}, {'Y', "BCDFG"}, {'"', "BF"}, {']', "ABCD"},
+    {'-', "G"},
+};
+
+/* Segment drivers and digit driver. */
+static uint8_t segments;        // bit s set: segment line s driven
+static uint32_t tlc_shift;      // 17 bit shift register
+static uint16_t tlc_outputs;    // bit i set: OUTi sinks
+static uint16_t tlc_control;
+static bool is_d12_direct;
+
+/* SPI1 DMA: bytes are shifted in one SPI byte time apart. */
+static const uint8_t *dma_bytes;
+static int dma_count;
+static uint64_t dma_start;
+
+/* Keypad. */
+static uint8_t keys[8];         // bit c set: key at row r+1, col c+1 pressed
+
+/* ADC1 scan with DMA: results stored when the scan completes. */
+static volatile uint16_t *adc_target;
+static uint8_t adc_inputs;
+static uint64_t adc_end;
+static bool is_adc_pending;
+
+/* UNI/O pin and TIM3 compare. */
+static bool unio_master;
+static uint64_t alarm_time;
+static bool is_alarm_running;
+
+/* Core clock. */
+static hal57_clock_t core_clock = HAL57_CLOCK_24MHZ;
+static const uint64_t CLOCK_MHZ[] = {8, 24, 64};
+static const uint64_t ADC_PRESCALER[] = {2, 2, 6};
+
+/* Display. */
+static uint64_t lit[12][8];     // lit time per digit (0 = digit 12) and segment
+static uint64_t lit_total;      // over the run, for the energy estimate
+static uint64_t last_change;
+static char window_display[32];
+static char shown_display[32];
+
+static void spend(uint64_t cycles)
+{
+    sim57_spend(SIM57_FIRMWARE, SIM57_CYCLES(cycles));
+}
+
+/** Duration of an ADC1 scan at the core clock of the moment. */
+static uint64_t adc_scan_time(void)
+{
+    uint64_t sample = (core_clock == HAL57_CLOCK_8MHZ) ? SIM57_ADC_SAMPLE_8MHZ_HALVES
+                                                       : SIM57_ADC_SAMPLE_HALVES;
+    uint64_t adc_clock = SIM57_TICKS_PER_US * ADC_PRESCALER[core_clock] / CLOCK_MHZ[core_clock];
+    return SIM57_ADC_SCAN_HALVES(sample) * adc_clock / 2;
+}
+
+/** Shifts in the streamed bytes whose transfer is complete. */
+static void dma_update(void)
+{
+    uint64_t byte_time = SIM57_PERIPHERAL(SIM57_SPI_BYTE_CYCLES);
+
+    while (dma_count > 0 && sim57_now() >= dma_start + byte_time) {
+        tlc_shift = ((tlc_shift << 8) | *dma_bytes++) & 0x1ffff;
+        dma_count--;
+        dma_start += byte_time;
+    }
+}
+
+/** Integrates the lit time since the last change of segments or digits. */
+static void integrate(void)
+{
+    uint64_t now = sim57_now();
+    uint64_t dt = now - last_change;
+    uint16_t sinks = tlc_outputs | (is_d12_direct ? 1 : 0);
+
+    last_change = now;
+    if (!segments || !sinks) return;
+    for (int d = 0; d < 12; d++) {
+        if (!(sinks & (1 << d))) continue;
+        for (int s = 0; s < 8; s++) {
+            if (segments & (1 << s)) {
+                lit[d][s] += dt;
+                lit_total += dt;
+            }
+        }
+    }
+}
+
+static char decode(int pattern)
+{
+    for (size_t i = 0; i < sizeof(CHARACTERS) / sizeof(CHARACTERS[0]); i++) {
+        int p = 0;
+        for (const char *c = CHARACTERS[i].segments; *c; c++) {
+            p |= 1 << (strchr("EFBGCAD", *c) - "EFBGCAD");
+        }
+        if (p == pattern) return CHARACTERS[i].c;
+    }
+    return '?';
+}
+
+void board57_init(void)
+{
+    segments = 0;
+    tlc_shift = 0;
+    tlc_outputs = 0;
+    tlc_control = 0;
+    is_d12_direct = false;
+    dma_count = 0;
+    memset(keys, 0, sizeof(keys));
+    unio_master = true;
+    memset(lit, 0, sizeof(lit));
+    last_change = sim57_now();
+    strcpy(shown_display, "            ");
+    strcpy(window_display, shown_display);
+}
+
+void board57_set_key(int row, int col, bool is_pressed)
+{
+    if (is_pressed) {
+        keys[row - 1] |= 1 << (col - 1);
+    } else {
+        keys[row - 1] &= ~(1 << (col - 1));
+    }
+}
+
+void board57_frame(void)
+{
+    char display[32];
+    int k = 0;
+
+    integrate();
+    for (int d = 0; d < 12; d++) {
+        int pattern = 0;
+        for (int s = 0; s < 7; s++) {
+            if (lit[d][s] >= LIT_THRESHOLD) pattern |= 1 << s;
+        }
+        display[k++] = decode(pattern);
+        if (lit[d][7] >= LIT_THRESHOLD) display[k++] = '.';
+    }
+    display[k] = 0;
+    memset(lit, 0, sizeof(lit));
+
+    if (strcmp(display, window_display) == 0 && strcmp(display, shown_display) != 0) {
+        strcpy(shown_display, display);
+        sim57_print("display", "[%s]", display);
+    }
+    strcpy(window_display, display);
+}
+
+/** Keypad column inputs K1-K5 (bits 0-4) given the segment lines driven. */
+static uint8_t columns(void)
+{
+    uint8_t k = 0;
+
+    for (int r = 0; r < 8; r++) {
+        if (segments & (1 << r)) k |= keys[r];
+    }
+    return k;
+}
+
+bool board57_is_column_high(void)
+{
+    return columns() != 0;
+}
+
+uint64_t board57_get_lit_time(void)
+{
+    integrate();
+    return lit_total;
+}
+
+/**
+ * hal57.h
+ */
+
+void hal57_init(void)
+{
+    // As after InitGPIO(): segment gates high, LATCH low, UNI/O low, D12 floating.
+    integrate();
+    segments = 0;
+    is_d12_direct = false;
+    hal57_unio_set(false);
+    spend(2000);
+}
+
+/** From HSI, as after STOP mode, back to the core clock (the PLL lock time is charged at that clock). */
+static void restart_clock(void)
+{
+    sim57_set_cpu_mhz(CLOCK_MHZ[core_clock]);
+    if (core_clock != HAL57_CLOCK_8MHZ) {
+        sim57_spend(SIM57_FIRMWARE, SIM57_US(SIM57_PLL_LOCK_US));
+    }
+    spend(SIM57_CLOCK_SWITCH_CYCLES);
+}
+
+bool hal57_set_clock(hal57_clock_t clock)
+{
+    spend(SIM57_GPIO_CYCLES);
+    if (is_alarm_running || hal57_usart_busy()) return false;
+
+    sim57_enable_interrupts(false);
+    while (hal57_digit_driver_busy()) {
+        continue;
+    }
+    while (is_adc_pending && sim57_now() < adc_end) {
+        spend(SIM57_POLL_CYCLES);
+    }
+    spend(SIM57_CLOCK_SWITCH_CYCLES);
+    core_clock = clock;
+    restart_clock();
+    sim57_enable_interrupts(true);
+    return true;
+}
+
+void hal57_systick_config(uint32_t period_us)
+{
+    spend(SIM57_GPIO_CYCLES);
+    sim57_systick_config(period_us);
+}
+
+void hal57_wait_for_interrupt(void)
+{
+    sim57_sleep();
+}
+
+void hal57_cycle_counter(bool on)
+{
+    spend(2 * SIM57_GPIO_CYCLES);
+    sim57_cycle_counter(on);
+}
+
+uint32_t hal57_cycle_count(void)
+{
+    spend(2);
+    return sim57_cycle_count();
+}
+
+void hal57_debug_pin(bool on)
+{
+    spend(SIM57_GPIO_CYCLES);
+    sim57_debug_pin(on);
+}
+
+void hal57_direct_d12(bool on)
+{
+    spend(SIM57_GPIO_CYCLES);
+    integrate();
+    is_d12_direct = on;
+}
+
+void hal57_segment_disable_all(void)
+{
+    spend(SIM57_GPIO_CYCLES);
+    integrate();
+    segments = 0;
+}
+
+void hal57_segment_enable_all(void)
+{
+    spend(SIM57_GPIO_CYCLES);
+    integrate();
+    segments = 0xff;
+}
+
+void hal57_segment_enable(uint8_t s)
+{
+    spend(SIM57_GPIO_CYCLES);
+    integrate();
+    segments |= 1 << (s & 7);
+}
+
+void hal57_digit_driver_shift(uint8_t b)
+{
+    dma_update();
+    sim57_spend(SIM57_FIRMWARE, SIM57_PERIPHERAL(SIM57_SPI_BYTE_CYCLES));
+    spend(SIM57_SPI_POLL_CYCLES);
+    tlc_shift = ((tlc_shift << 8) | b) & 0x1ffff;
+}
+
+void hal57_digit_driver_stream(const uint8_t *bytes, uint8_t n)
+{
+    spend(SIM57_DMA_START_CYCLES);
+    dma_update();
+    dma_bytes = bytes;
+    dma_count = n;
+    dma_start = sim57_now();
+}
+
+bool hal57_digit_driver_busy(void)
+{
+    spend(SIM57_POLL_CYCLES);
+    dma_update();
+    return dma_count > 0;
+}
+
+void hal57_digit_driver_latch(void)
+{
+    while (hal57_digit_driver_busy()) {
+        continue;
+    }
+    spend(2 * SIM57_GPIO_CYCLES);
+    if (tlc_shift & 0x10000) {
+        tlc_control = tlc_shift & 0xffff;
+    } else {
+        integrate();
+        tlc_outputs = tlc_shift & 0xffff;
+    }
+}
+
+bool hal57_keyboard_adc(uint16_t k[5])
+{
+    spend(SIM57_ADC_SETUP_CYCLES);
+    sim57_spend(SIM57_FIRMWARE, adc_scan_time());
+    uint8_t inputs = columns();
+    for (int c = 0; c < 5; c++) {
+        k[c] = (inputs & (1 << c)) ? ADC_CLOSED : ADC_OPEN;
+    }
+    return true;
+}
+
+void hal57_keyboard_adc_start(volatile uint16_t k[5])
+{
+    spend(SIM57_DMA_START_CYCLES);
+    // The columns are sampled at the start: the segment stays driven.
+    adc_target = k;
+    adc_inputs = columns();
+    adc_end = sim57_now() + adc_scan_time();
+    is_adc_pending = true;
+}
+
+bool hal57_keyboard_adc_done(void)
+{
+    spend(SIM57_GPIO_CYCLES);
+    if (is_adc_pending && sim57_now() >= adc_end) {
+        for (int c = 0; c < 5; c++) {
+            adc_target[c] = (adc_inputs & (1 << c)) ? ADC_CLOSED : ADC_OPEN;
+        }
+        is_adc_pending = false;
+    }
+    return !is_adc_pending;
+}
+
+uint8_t hal57_keyboard_inputs(void)
+{
+    spend(SIM57_GPIO_CYCLES);
+    return columns();
+}
+
+void hal57_unio_set(bool high)
+{
+    spend(SIM57_GPIO_CYCLES);
+    if (high == unio_master) return;
+    unio_master = high;
+    eeprom57_master(high);
+}
+
+bool hal57_unio_get(void)
+{
+    spend(SIM57_GPIO_CYCLES);
+    return unio_master && eeprom57_level();
+}
+
+void hal57_timer_alarm_start(uint16_t us)
+{
+    spend(4 * SIM57_GPIO_CYCLES);
+    alarm_time = sim57_now() + SIM57_US(us);
+    is_alarm_running = true;
+    sim57_tim3_alarm(alarm_time);
+}
+
+void hal57_timer_alarm_next(uint16_t us)
+{
+    spend(2 * SIM57_GPIO_CYCLES);
+    alarm_time += SIM57_US(us);
+    sim57_tim3_alarm(alarm_time);
+}
+
+void hal57_timer_alarm_stop(void)
+{
+    spend(3 * SIM57_GPIO_CYCLES);
+    is_alarm_running = false;
+    sim57_tim3_alarm(0);
+}
+
+void hal57_stop_until_key(void)
+{
+    // Column inputs, EXTI and SysTick set up.
+    spend(12 * SIM57_GPIO_CYCLES);
+    if (columns() == 0) {
+        sim57_stop();
+        restart_clock();
+    }
+    spend(8 * SIM57_GPIO_CYCLES);
+}
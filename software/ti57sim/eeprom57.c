@@ -0,0 +1,391 @@
+/**
+ * Bit level model of the Microchip 11AA080 UNI/O serial EEPROM.
+ *
+ * 1024 bytes, 16 byte pages, 5ms write cycle. The bus is open drain: it is
+ * low when either the master or the EEPROM pulls it low.
+ *
+ * UNI/O is Manchester coded: each bit has a transition in its middle, high
+ * to low for 0 and low to high for 1. Bytes are followed by a MAK (1) or
+ * NoMAK (0) bit from the master and a SAK (1) or NoSAK (no transition)
+ * bit from the slave, so each byte takes 10 bit periods. A command starts
+ * with:
+ *   - a standby pulse (bus high for at least 600us) after power up or an
+ *     error, or the bus high for at least 10us after the previous command
+ *   - the header: bus low for at least 5us, then 0x55 with MAK and NoSAK
+ *   - the device address (0xa0), the command and its parameters
+ * The bit period T is measured on the header: the first falling edge comes
+ * T/2 after the rising edge that ends the low pulse. The model then tracks
+ * the bit slots from there, resynchronizing on the middle transition of
+ * every bit the master sends.
+ *
+ * Time is the simulator's virtual time. The model is lazy: it catches up
+ * with the bit slots that elapsed whenever the master drives or reads the
+ * bus.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sim57.h"
+
+#define SIZE 1024
+#define PAGE_SIZE 16
+#define DEVICE_ADDRESS 0xa0
+
+#define T_STBY SIM57_US(600)
+#define T_SS SIM57_US(10)
+#define T_HDR SIM57_US(5)
+#define T_WC SIM57_US(5000)
+#define T_MIN SIM57_US(10)   // 100 kbit/s
+#define T_MAX SIM57_US(100)  // 10 kbit/s
+
+#define CMD_READ 0x03
+#define CMD_WRITE 0x6c
+#define CMD_WREN 0x96
+#define CMD_WRDI 0x91
+#define CMD_RDSR 0x05
+#define CMD_WRSR 0x6e
+#define CMD_ERAL 0x6d
+#define CMD_SETAL 0x67
+
+#define STATUS_WIP 0x01
+#define STATUS_WEL 0x02
+#define STATUS_BP 0x0c
+
+typedef enum state_e {
+    NEED_STANDBY,  // after power up or an error: waits for a standby pulse
+    IDLE,          // after a command
+    HEADER_LOW,    // low pulse of the header
+    HEADER_HIGH,   // waits for the first falling edge of the header
+    SLOTS          // header and command bytes, bit slot by bit slot
+} state_t;
+
+static unsigned char memory[SIZE];
+static const char *path;
+
+static state_t state = NEED_STANDBY;
+static bool master = true;       // master drive, true = released
+static bool was_high;            // the bus went high since power up
+static uint64_t high_time;       // time the bus went high
+static uint64_t low_time;        // time the header low pulse started
+
+/* Bit slots: 10 per byte, the header being byte 0. */
+static uint64_t period;
+static uint64_t slot_start;
+static int slot;
+static bool is_bit_seen;         // middle transition of a master bit seen
+static int bit;
+static int shift;                // byte being received
+static bool is_sending;          // the EEPROM sends the current byte
+static int out;                  // byte being sent
+static bool is_acked;            // the EEPROM sends SAK for the current byte
+static bool is_last_byte;        // the master sent NoMAK
+
+/* Command. */
+static int command;
+static int address;
+static unsigned char page[PAGE_SIZE];
+static bool is_page_written[PAGE_SIZE];
+static int status_bp;
+static bool is_write_enabled;
+static uint64_t write_end;
+
+static unsigned long command_count;
+static unsigned long error_count;
+
+static void save(void)
+{
+    if (!path) return;
+    FILE *f = fopen(path, "wb");
+    if (!f || fwrite(memory, 1, SIZE, f) != SIZE) {
+        perror(path);
+    }
+    if (f) fclose(f);
+}
+
+static bool is_busy(void)
+{
+    return sim57_now() < write_end;
+}
+
+static int get_status(void)
+{
+    return (is_busy() ? STATUS_WIP : 0) | (is_write_enabled ? STATUS_WEL : 0) | status_bp;
+}
+
+static bool is_protected(int a)
+{
+    switch (status_bp) {
+    case 0x04: return a >= SIZE * 3 / 4;
+    case 0x08: return a >= SIZE / 2;
+    case 0x0c: return true;
+    default: return false;
+    }
+}
+
+static void start_write_cycle(void)
+{
+    write_end = sim57_now() + T_WC;
+    is_write_enabled = false;
+    save();
+}
+
+static void error(void)
+{
+    state = NEED_STANDBY;
+    error_count++;
+}
+
+/** Executes the command the master just ended with NoMAK. */
+static void execute(int byte_count)
+{
+    switch (command) {
+    case CMD_WREN:
+        is_write_enabled = true;
+        break;
+    case CMD_WRDI:
+        is_write_enabled = false;
+        break;
+    case CMD_WRITE:
+        if (!is_write_enabled || byte_count < 6) break;
+        for (int i = 0; i < PAGE_SIZE; i++) {
+            int a = (address & ~(PAGE_SIZE - 1)) | i;
+            if (is_page_written[i] && !is_protected(a)) memory[a] = page[i];
+        }
+        start_write_cycle();
+        break;
+    case CMD_WRSR:
+        if (!is_write_enabled || byte_count < 4) break;
+        status_bp = shift & STATUS_BP;
+        start_write_cycle();
+        break;
+    case CMD_ERAL:
+    case CMD_SETAL:
+        if (!is_write_enabled || status_bp) break;
+        memset(memory, command == CMD_ERAL ? 0x00 : 0xff, SIZE);
+        start_write_cycle();
+        break;
+    }
+    command_count++;
+}
+
+/** Handles a complete byte received from (or sent to) the master. */
+static bool end_byte(int b, bool mak)
+{
+    if (b == 0) {
+        // Header: NoSAK.
+        return shift == 0x55 && mak;
+    }
+    if (b == 1) {
+        return shift == DEVICE_ADDRESS;
+    }
+    if (b == 2) {
+        command = shift;
+        if (is_busy() && command != CMD_RDSR) return false;
+        switch (command) {
+        case CMD_READ: case CMD_WRITE: case CMD_WREN: case CMD_WRDI:
+        case CMD_RDSR: case CMD_WRSR: case CMD_ERAL: case CMD_SETAL:
+            break;
+        default:
+            return false;
+        }
+        memset(is_page_written, 0, sizeof(is_page_written));
+        // Commands without parameters must end here.
+        if ((command == CMD_WREN || command == CMD_WRDI || command == CMD_ERAL ||
+             command == CMD_SETAL) && mak) {
+            return false;
+        }
+        return true;
+    }
+    switch (command) {
+    case CMD_READ:
+    case CMD_WRITE:
+        if (b == 3) {
+            address = shift << 8;
+        } else if (b == 4) {
+            address = (address | shift) & (SIZE - 1);
+        } else if (command == CMD_READ) {
+            address = (address + 1) & (SIZE - 1);
+        } else {
+            page[address & (PAGE_SIZE - 1)] = shift;
+            is_page_written[address & (PAGE_SIZE - 1)] = true;
+            address = (address & ~(PAGE_SIZE - 1)) | ((address + 1) & (PAGE_SIZE - 1));
+        }
+        return true;
+    case CMD_RDSR:
+        return true;
+    case CMD_WRSR:
+        return b == 3 && !mak;
+    default:
+        return false;
+    }
+}
+
+static bool is_master_slot(void)
+{
+    int pos = slot % 10;
+    return pos == 8 || (pos < 8 && !is_sending);
+}
+
+/** Closes the current bit slot. */
+static void end_slot(void)
+{
+    int b = slot / 10, pos = slot % 10;
+
+    if (is_master_slot() && !is_bit_seen) {
+        // The master did not send a bit: give up on the command.
+        error();
+        return;
+    }
+    if (pos < 8) {
+        shift = ((shift << 1) | bit) & 0xff;
+    } else if (pos == 8) {
+        is_last_byte = !bit;
+        if (!end_byte(b, bit)) {
+            error();
+            return;
+        }
+        is_acked = b > 0;
+    } else {
+        if (is_last_byte) {
+            execute(b + 1);
+            state = IDLE;
+            high_time = slot_start + period;
+            return;
+        }
+        // Next byte: sent by the EEPROM for READ data and RDSR.
+        is_sending = (command == CMD_READ && b >= 4) || (command == CMD_RDSR && b >= 2);
+        if (is_sending) {
+            out = command == CMD_READ ? memory[address] : get_status();
+        }
+    }
+    slot++;
+    slot_start += period;
+    is_bit_seen = false;
+}
+
+/** Catches up with the bit slots that elapsed. */
+static void update(void)
+{
+    uint64_t now = sim57_now();
+
+    while (state == SLOTS && now >= slot_start + period) {
+        end_slot();
+    }
+}
+
+static void start_slots(uint64_t t0, uint64_t t)
+{
+    period = 2 * (t - t0);
+    if (period < T_MIN || period > T_MAX) {
+        error();
+        return;
+    }
+    state = SLOTS;
+    slot = 0;
+    slot_start = t0;
+    is_bit_seen = true;  // header bit 0: this falling edge
+    bit = 0;
+    shift = 0;
+    is_sending = false;
+    is_acked = false;
+    is_last_byte = false;
+    command = -1;
+}
+
+void eeprom57_init(const char *file_path)
+{
+    FILE *f;
+
+    path = file_path;
+    memset(memory, 0xff, SIZE);
+    if (path && (f = fopen(path, "rb"))) {
+        if (fread(memory, 1, SIZE, f) != SIZE) {
+            fprintf(stderr, "ti57sim: %s is not a 1024 byte EEPROM image\n", path);
+        }
+        fclose(f);
+    }
+}
+
+void eeprom57_master(bool level)
+{
+    uint64_t t = sim57_now();
+
+    update();
+    if (level == master) return;
+    master = level;
+
+    switch (state) {
+    case NEED_STANDBY:
+        if (!level && was_high && t - high_time >= T_STBY) {
+            state = HEADER_LOW;
+            low_time = t;
+        }
+        break;
+    case IDLE:
+        if (level) {
+            high_time = t;
+        } else if (t - high_time >= T_SS) {
+            state = HEADER_LOW;
+            low_time = t;
+        } else {
+            error();
+        }
+        break;
+    case HEADER_LOW:
+        if (level && t - low_time >= T_HDR) {
+            state = HEADER_HIGH;
+            high_time = t;
+        } else {
+            error();
+        }
+        break;
+    case HEADER_HIGH:
+        if (!level) {
+            start_slots(high_time, t);
+        }
+        break;
+    case SLOTS:
+        if (is_master_slot() && !is_bit_seen) {
+            uint64_t phase = t - slot_start;
+            if (phase >= period / 4 && phase <= period * 3 / 4) {
+                // Middle of the bit: resynchronize.
+                bit = level;
+                is_bit_seen = true;
+                slot_start = t - period / 2;
+            }
+        }
+        break;
+    }
+    // Waiting for a standby pulse, possibly after an error on this edge.
+    if (level && state == NEED_STANDBY) {
+        was_high = true;
+        high_time = t;
+    }
+}
+
+bool eeprom57_level(void)
+{
+    int v;
+
+    update();
+    if (state != SLOTS) return true;
+
+    int pos = slot % 10;
+    if (pos < 8 && is_sending) {
+        v = (out >> (7 - pos)) & 1;
+    } else if (pos == 9 && is_acked) {
+        v = 1;
+    } else {
+        return true;
+    }
+    bool is_first_half = sim57_now() - slot_start < period / 2;
+    return is_first_half ? !v : v;
+}
+
+void eeprom57_get_stats(unsigned long *commands, unsigned long *errors)
+{
+    update();
+    *commands = command_count;
+    *errors = error_count;
+}
@@ -0,0 +1,586 @@
+/**
+ * Virtual clock, SysTick, cycle accounting and command line of the RCL-57
+ * board simulator.
+ *
+ * Usage:
+ *   ti57sim [-t ms] [-k keys] [-c script] [-p] [-e eeprom] [-n cycles] [-l loops.csv] [-q]
+ *
+ *   -t ms       virtual time to run (default 5000)
+ *   -k keys     key presses, as a comma separated list of ms:scancode[:hold]
+ *               with the scancode in hex (row, col) and hold in ms (default
+ *               100). For example "2500:72,2800:85" presses 1 then =. Holds
+ *               may overlap, for chords.
+ *   -c script   command lines for USART1 RXD (cmd57.h), one per line, each
+ *               preceded by the ms at which the host starts sending it, for
+ *               example "3000 dump". Text after '#' is a comment.
+ *   -p          opens a pseudo terminal for USART1, prints its name, and
+ *               runs in real time: a host tool can then send commands and
+ *               read the telemetry records, as on the debug header
+ *   -e eeprom   file holding the 11AA080 contents, created if needed and
+ *               updated on every write (default: erased, not saved)
+ *   -n cycles   modeled cost of ti57_next() in MCU cycles (default 300)
+ *   -l file     writes the timing of every firmware loop as CSV, in us
+ *   -q          does not print the display
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sim57.h"
+
+/** The firmware entry point (main() of main.c, see hal57.h) and ISRs. */
+int hal57_firmware_main();
+void SysTick_Handler(void);
+void TIM3_IRQHandler(void);
+void USART1_IRQHandler(void);
+
+typedef struct key_event_s {
+    uint64_t time;
+    int row;
+    int col;
+    bool is_press;
+} key_event_t;
+
+#define MAX_KEY_EVENTS 256
+
+static const char *ACCOUNT_NAMES[SIM57_ACCOUNT_COUNT] = {
+    "emulation", "firmware", "isr", "sleep", "stop"
+};
+
+/* Clock. */
+static uint64_t now;
+static uint64_t end_time;
+static bool is_polling;
+static bool is_masked;
+
+/* Core clock. */
+static uint64_t cpu_mhz = 24;
+static uint64_t clock_time[SIM57_MAX_MHZ + 1];
+static unsigned long clock_switches;
+
+/* DWT cycle counter, in MCU cycles x SIM57_TICKS_PER_US. */
+static bool is_cycle_counting;
+static uint64_t cycle_counter;
+
+/* SysTick. */
+static uint64_t systick_period;
+static uint64_t next_tick;
+static bool in_isr;
+static unsigned long isr_count;
+static unsigned long isr_overruns;
+static uint64_t isr_max;
+
+/* TIM3 compare interrupt, which preempts SysTick. */
+static uint64_t tim3_alarm;
+static bool in_tim3;
+static unsigned long tim3_count;
+static unsigned long tim3_late;
+static uint64_t tim3_total;
+static uint64_t tim3_max;
+
+/* USART1 interrupt, which preempts SysTick. */
+static bool in_usart;
+static unsigned long usart_count;
+static uint64_t usart_total;
+static uint64_t usart_max;
+
+/* Real time pacing, with -p. */
+static bool is_real_time;
+static uint64_t next_pace;
+static struct timespec start_wall;
+
+/* Accounting, in virtual time, MCU cycles (x SIM57_TICKS_PER_US) and charge (uA x ticks). */
+static uint64_t accounts[SIM57_ACCOUNT_COUNT];
+static uint64_t account_cycles[SIM57_ACCOUNT_COUNT];
+static double charge;
+static uint64_t loop_accounts[SIM57_ACCOUNT_COUNT];
+static uint64_t next_cycles = SIM57_DEFAULT_NEXT_CYCLES;
+static bool debug_pin;
+static bool in_loop;
+static uint64_t loop_start;
+static unsigned long loop_count;
+static unsigned long sleeping_loop_count;
+static uint64_t loop_min = UINT64_MAX;
+static uint64_t loop_max;
+static uint64_t loop_total;
+static FILE *loop_file;
+
+/* Input and display. */
+static key_event_t key_events[MAX_KEY_EVENTS];
+static int key_event_count;
+static int next_key_event;
+static uint64_t next_frame;
+static bool is_quiet;
+
+static double to_ms(uint64_t t)
+{
+    return (double)t / SIM57_TICKS_PER_US / 1000;
+}
+
+static double to_us(uint64_t t)
+{
+    return (double)t / SIM57_TICKS_PER_US;
+}
+
+/** Supply current of the MCU, in uA. */
+static uint64_t get_current(sim57_account_t account)
+{
+    switch (account) {
+    case SIM57_SLEEP:
+        return SIM57_SLEEP_UA(cpu_mhz);
+    case SIM57_STOP:
+        return SIM57_STOP_UA;
+    default:
+        return SIM57_RUN_UA(cpu_mhz);
+    }
+}
+
+static void report(void)
+{
+    double total = (double)now;
+
+    usart57_poll(true);
+    printf("\n%.3f ms simulated\n", to_ms(now));
+    printf("clock:");
+    for (int mhz = 0; mhz <= SIM57_MAX_MHZ; mhz++) {
+        if (clock_time[mhz]) printf(" %d MHz %.1f%%", mhz, 100 * clock_time[mhz] / total);
+    }
+    printf(", %lu switches\n", clock_switches);
+    for (int i = 0; i < SIM57_ACCOUNT_COUNT; i++) {
+        printf("  %-10s %10.0f cycles  %5.1f%%\n", ACCOUNT_NAMES[i],
+               (double)account_cycles[i] / SIM57_TICKS_PER_US, total ? 100 * accounts[i] / total : 0);
+    }
+    if (loop_count) {
+        printf("firmware loops: %lu (%.0f/s, %lu waiting for the display scan)\n",
+               loop_count, loop_count / (to_ms(loop_total) / 1000), sleeping_loop_count);
+        printf("  us/loop: min %.2f, avg %.2f, max %.2f\n",
+               to_us(loop_min), to_us(loop_total) / loop_count, to_us(loop_max));
+    }
+    if (isr_count) {
+        printf("systick: %lu interrupts, avg %.2f us, max %.2f us, %lu overruns\n",
+               isr_count, to_us(accounts[SIM57_ISR] - tim3_total - usart_total) / isr_count, to_us(isr_max),
+               isr_overruns);
+    }
+    if (tim3_count) {
+        printf("tim3: %lu interrupts, avg %.2f us, max %.2f us, %lu late\n",
+               tim3_count, to_us(tim3_total) / tim3_count, to_us(tim3_max), tim3_late);
+    }
+    unsigned long received, overruns;
+    usart57_get_stats(&received, &overruns);
+    if (usart_count || overruns) {
+        printf("usart: %lu interrupts, avg %.2f us, max %.2f us, %lu bytes received, %lu overruns\n",
+               usart_count, usart_count ? to_us(usart_total) / usart_count : 0, to_us(usart_max),
+               received, overruns);
+    }
+    unsigned long commands, errors;
+    eeprom57_get_stats(&commands, &errors);
+    printf("eeprom: %lu commands, %lu rejected\n", commands, errors);
+
+    // Charge in uA x ticks, averaged over the run.
+    double mcu = charge, display = (double)board57_get_lit_time() * SIM57_SEGMENT_UA;
+    if (total) {
+        double ma = (mcu + display) / total / 1000;
+        printf("energy: %.3f mA average (mcu %.3f, display %.3f), %.2f mWh per hour at 3.3 V\n",
+               ma, mcu / total / 1000, display / total / 1000, ma * 3.3);
+    }
+}
+
+static void finish(void)
+{
+    report();
+    if (loop_file) fclose(loop_file);
+    exit(0);
+}
+
+static void run_tim3(void)
+{
+    uint64_t start = now;
+
+    in_tim3 = true;
+    tim3_alarm = 0;
+    sim57_spend(SIM57_ISR, SIM57_CYCLES(SIM57_ISR_CYCLES));
+    TIM3_IRQHandler();
+    in_tim3 = false;
+
+    tim3_count++;
+    tim3_total += now - start;
+    if (now - start > tim3_max) tim3_max = now - start;
+    // A compare time already passed is only matched when the counter wraps.
+    if (tim3_alarm && tim3_alarm <= now) tim3_late++;
+}
+
+static void run_usart(void)
+{
+    uint64_t start = now;
+    uint64_t preempted = tim3_total;
+
+    in_usart = true;
+    sim57_spend(SIM57_ISR, SIM57_CYCLES(SIM57_ISR_CYCLES));
+    USART1_IRQHandler();
+    in_usart = false;
+
+    uint64_t duration = now - start - (tim3_total - preempted);
+    usart_count++;
+    usart_total += duration;
+    if (duration > usart_max) usart_max = duration;
+}
+
+static void run_isr(void)
+{
+    uint64_t start = now;
+    uint64_t preempted = tim3_total + usart_total;
+
+    in_isr = true;
+    sim57_spend(SIM57_ISR, SIM57_CYCLES(SIM57_ISR_CYCLES));
+    SysTick_Handler();
+    in_isr = false;
+
+    // The TIM3 and USART1 interrupts that preempted the handler are not its own time.
+    uint64_t duration = now - start - (tim3_total + usart_total - preempted);
+    isr_count++;
+    if (duration > isr_max) isr_max = duration;
+
+    // As on the Cortex-M3, periods that elapse during the ISR are lost.
+    next_tick += systick_period;
+    while (systick_period && next_tick <= now) {
+        next_tick += systick_period;
+        isr_overruns++;
+    }
+}
+
+static bool is_tim3_due(void)
+{
+    return !in_tim3 && tim3_alarm && now >= tim3_alarm;
+}
+
+static bool is_usart_due(void)
+{
+    return !in_tim3 && !in_usart && usart57_is_rx_pending();
+}
+
+/** Sleeps until the wall clock catches up with the virtual time, then reads the pseudo terminal. */
+static void pace(void)
+{
+    struct timespec wall;
+
+    clock_gettime(CLOCK_MONOTONIC, &wall);
+    double ahead = to_ms(now) / 1000 - ((wall.tv_sec - start_wall.tv_sec) +
+                                        (wall.tv_nsec - start_wall.tv_nsec) / 1e9);
+    if (ahead > 0) {
+        struct timespec delay = {(time_t)ahead, (long)((ahead - (time_t)ahead) * 1e9)};
+        nanosleep(&delay, NULL);
+    }
+    usart57_read_pty();
+}
+
+/** Runs whatever fell due: end of run, key events, frame window, TIM3, USART1, SysTick. */
+static void poll(void)
+{
+    // TIM3 preempts SysTick_Handler(), USART1_IRQHandler() and whatever model event is running.
+    if (is_masked) return;
+    if (is_tim3_due()) {
+        run_tim3();
+    }
+    // USART1 preempts SysTick_Handler().
+    if (is_usart_due()) {
+        run_usart();
+    }
+    if (is_polling) return;
+    is_polling = true;
+    for (;;) {
+        if (now >= end_time) {
+            finish();
+        }
+        if (is_tim3_due()) {
+            run_tim3();
+            continue;
+        }
+        if (next_key_event < key_event_count && now >= key_events[next_key_event].time) {
+            key_event_t *event = &key_events[next_key_event++];
+            board57_set_key(event->row, event->col, event->is_press);
+            continue;
+        }
+        if (is_real_time && now >= next_pace) {
+            pace();
+            next_pace += SIM57_US(1000);
+            continue;
+        }
+        if (now >= next_frame) {
+            if (!is_quiet) board57_frame();
+            next_frame += SIM57_US(SIM57_FRAME_US);
+            continue;
+        }
+        if (!in_isr && !in_tim3 && systick_period && now >= next_tick) {
+            run_isr();
+            continue;
+        }
+        break;
+    }
+    usart57_poll(false);
+    is_polling = false;
+}
+
+uint64_t sim57_now(void)
+{
+    return now;
+}
+
+void sim57_spend(sim57_account_t account, uint64_t ticks)
+{
+    if (in_isr || in_tim3 || in_usart) account = SIM57_ISR;
+    do {
+        // Stop at the next SysTick, TIM3 compare or received byte, so that the interrupts are taken on time.
+        uint64_t step = ticks;
+        uint64_t rx = usart57_next_rx();
+        if (!is_masked && !in_tim3 && !in_usart && rx > now && rx - now < step) {
+            step = rx - now;
+        }
+        if (!is_masked && !in_isr && !in_tim3 && systick_period && next_tick > now &&
+            next_tick - now < step) {
+            step = next_tick - now;
+        }
+        if (!is_masked && !in_tim3 && tim3_alarm > now && tim3_alarm - now < step) {
+            step = tim3_alarm - now;
+        }
+        accounts[account] += step;
+        account_cycles[account] += step * cpu_mhz;
+        charge += (double)step * get_current(account);
+        clock_time[cpu_mhz] += step;
+        // The core clock stops in STOP mode; in WFI the counter runs, as with DBG_SLEEP.
+        if (is_cycle_counting && account != SIM57_STOP) cycle_counter += step * cpu_mhz;
+        loop_accounts[account] += step;
+        now += step;
+        ticks -= step;
+        poll();
+    } while (ticks > 0);
+}
+
+uint64_t sim57_get_cpu_mhz(void)
+{
+    return cpu_mhz;
+}
+
+void sim57_set_cpu_mhz(uint64_t mhz)
+{
+    if (mhz == cpu_mhz) return;
+    if (mhz == 0 || mhz > SIM57_MAX_MHZ || SIM57_TICKS_PER_US % mhz != 0) {
+        fprintf(stderr, "ti57sim: no exact %llu MHz clock\n", (unsigned long long)mhz);
+        exit(1);
+    }
+    cpu_mhz = mhz;
+    clock_switches++;
+}
+
+void sim57_cycle_counter(bool on)
+{
+    is_cycle_counting = on;
+}
+
+uint32_t sim57_cycle_count(void)
+{
+    return (uint32_t)(cycle_counter / SIM57_TICKS_PER_US);
+}
+
+void sim57_enable_interrupts(bool is_enabled)
+{
+    is_masked = !is_enabled;
+    if (is_enabled) poll();
+}
+
+void sim57_sleep(void)
+{
+    uint64_t wake = systick_period ? next_tick : UINT64_MAX;
+
+    if (in_isr || in_tim3 || in_usart) {
+        fprintf(stderr, "ti57sim: WFI in an interrupt handler\n");
+        exit(1);
+    }
+    if (tim3_alarm && tim3_alarm < wake) wake = tim3_alarm;
+    if (wake == UINT64_MAX) {
+        fprintf(stderr, "ti57sim: WFI with SysTick and TIM3 stopped at %.3f ms\n", to_ms(now));
+        exit(1);
+    }
+    sim57_spend(SIM57_SLEEP, wake > now ? wake - now : 0);
+}
+
+void sim57_stop(void)
+{
+    uint64_t period = systick_period;
+
+    if (in_isr || in_tim3 || in_usart) {
+        fprintf(stderr, "ti57sim: STOP in an interrupt handler\n");
+        exit(1);
+    }
+    // SysTick is held; the run ends in STOP mode if no key wakes it.
+    systick_period = 0;
+    while (!board57_is_column_high()) {
+        uint64_t wake = next_key_event < key_event_count ? key_events[next_key_event].time : end_time;
+        sim57_spend(SIM57_STOP, wake > now ? wake - now : 0);
+    }
+    systick_period = period;
+    next_tick = now + systick_period;
+}
+
+void sim57_tim3_alarm(uint64_t time)
+{
+    tim3_alarm = time;
+}
+
+void sim57_systick_config(uint32_t period_us)
+{
+    systick_period = SIM57_US(period_us);
+    next_tick = now + systick_period;
+}
+
+void sim57_debug_pin(bool on)
+{
+    if (on == debug_pin) return;
+    debug_pin = on;
+
+    if (!on) {
+        // The debug pin brackets ti57_next(): charge its modeled cost.
+        sim57_spend(SIM57_EMULATION, SIM57_CYCLES(next_cycles));
+        return;
+    }
+
+    // Rising edge: end of the previous loop, start of the next one.
+    if (in_loop) {
+        uint64_t duration = now - loop_start;
+        loop_count++;
+        loop_total += duration;
+        if (duration < loop_min) loop_min = duration;
+        if (duration > loop_max) loop_max = duration;
+        if (loop_accounts[SIM57_SLEEP]) sleeping_loop_count++;
+        if (loop_file) {
+            fprintf(loop_file, "%lu,%.3f,%.3f", loop_count, to_us(loop_start), to_us(duration));
+            for (int i = 0; i < SIM57_ACCOUNT_COUNT; i++) {
+                fprintf(loop_file, ",%.3f", to_us(loop_accounts[i]));
+            }
+            fprintf(loop_file, "\n");
+        }
+    }
+    in_loop = true;
+    loop_start = now;
+    memset(loop_accounts, 0, sizeof(loop_accounts));
+}
+
+void sim57_print(const char *source, const char *fmt, ...)
+{
+    va_list args;
+
+    printf("%10.3f ms  %-7s ", to_ms(now), source);
+    va_start(args, fmt);
+    vprintf(fmt, args);
+    va_end(args);
+    printf("\n");
+}
+
+static int compare_key_events(const void *a, const void *b)
+{
+    uint64_t ta = ((const key_event_t *)a)->time, tb = ((const key_event_t *)b)->time;
+    return ta < tb ? -1 : ta > tb;
+}
+
+/** Parses "ms:scancode[:hold],..." into press and release events. */
+static bool parse_keys(const char *str)
+{
+    while (*str) {
+        unsigned long ms, hold = 100;
+        unsigned int scancode;
+        int n;
+
+        if (sscanf(str, "%lu:%x%n", &ms, &scancode, &n) != 2) return false;
+        str += n;
+        if (*str == ':') {
+            if (sscanf(str + 1, "%lu%n", &hold, &n) != 1) return false;
+            str += n + 1;
+        }
+        if (*str == ',') str++;
+
+        int row = scancode >> 4, col = scancode & 0xf;
+        if (row < 1 || row > 8 || col < 1 || col > 5) return false;
+        if (key_event_count + 2 > MAX_KEY_EVENTS) return false;
+        key_events[key_event_count++] = (key_event_t){SIM57_US(ms * 1000), row, col, true};
+        key_events[key_event_count++] = (key_event_t){SIM57_US((ms + hold) * 1000), row, col, false};
+    }
+    qsort(key_events, key_event_count, sizeof(key_event_t), compare_key_events);
+    return true;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: ti57sim [-t ms] [-k ms:scancode[:hold],...] [-c script] [-p] "
+                    "[-e eeprom] [-n cycles] [-l loops.csv] [-q]\n");
+    exit(2);
+}
+
+#undef main
+int main(int argc, char **argv)
+{
+    unsigned long run_ms = 5000;
+    const char *eeprom_path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        if (arg[0] != '-' || arg[1] == 0 || arg[2] != 0) usage();
+        if (arg[1] == 'q') {
+            is_quiet = true;
+            continue;
+        }
+        if (arg[1] == 'p') {
+            const char *name = usart57_open_pty();
+            if (!name) return 1;
+            setvbuf(stdout, NULL, _IOLBF, 0);
+            printf("usart on %s\n", name);
+            is_real_time = true;
+            continue;
+        }
+        if (i + 1 >= argc) usage();
+        const char *value = argv[++i];
+        switch (arg[1]) {
+        case 't':
+            run_ms = strtoul(value, NULL, 10);
+            break;
+        case 'k':
+            if (!parse_keys(value)) usage();
+            break;
+        case 'c':
+            if (!usart57_load_script(value)) return 1;
+            break;
+        case 'e':
+            eeprom_path = value;
+            break;
+        case 'n':
+            next_cycles = strtoul(value, NULL, 10);
+            break;
+        case 'l':
+            loop_file = fopen(value, "w");
+            if (!loop_file) {
+                perror(value);
+                return 1;
+            }
+            fprintf(loop_file, "loop,start_us,us");
+            for (int j = 0; j < SIM57_ACCOUNT_COUNT; j++) {
+                fprintf(loop_file, ",%s", ACCOUNT_NAMES[j]);
+            }
+            fprintf(loop_file, "\n");
+            break;
+        default:
+            usage();
+        }
+    }
+
+    end_time = SIM57_US(run_ms * 1000);
+    next_frame = SIM57_US(SIM57_FRAME_US);
+    clock_gettime(CLOCK_MONOTONIC, &start_wall);
+    board57_init();
+    eeprom57_init(eeprom_path);
+
+    hal57_firmware_main();
+
+    finish();
+    return 0;
+}
@@ -0,0 +1,214 @@
+#ifndef sim57_h
+#define sim57_h
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * Host-side simulator of the RCL-57 retrofit PCB V2
+ *
+ * The firmware of ../ti57mcu is compiled unchanged for the host, with
+ * hal57.h implemented by board57.c against models of the board. Time is
+ * virtual: it only advances when the firmware spends modeled MCU cycles
+ * (peripheral transfers, timer polls, instruction execution) or sleeps
+ * in hal57_wait_for_interrupt(). SysTick_Handler() is called from the
+ * virtual clock whenever a SysTick period elapses outside of it, and
+ * TIM3_IRQHandler() when the TIM3 compare time is reached, and
+ * USART1_IRQHandler() when a byte is received, preempting SysTick_Handler()
+ * as their higher priorities do on the MCU.
+ *
+ * The core clock changes with hal57_set_clock(), so MCU cycles are
+ * converted to time at the clock of the moment.
+ *
+ * Every cycle is accounted to one of the sim57_account_t buckets, and
+ * per firmware loop (delimited by the rising edges of the debug pin,
+ * which brackets ti57_next() in main.c) for the timing report.
+ */
+
+/** Virtual time unit: 1/576 us, so that 8, 24, 36, 48, 64 and 72 MHz cycles are exact. */
+#define SIM57_TICKS_PER_US 576ULL
+
+/** Converts MCU cycles (at the current core clock) or microseconds to virtual time. */
+#define SIM57_CYCLES(n) ((uint64_t)(n) * (SIM57_TICKS_PER_US / sim57_get_cpu_mhz()))
+#define SIM57_US(n) ((uint64_t)(n) * SIM57_TICKS_PER_US)
+
+/**
+ * Converts peripheral time, given in cycles at 24 MHz, to virtual time.
+ * hal57_set_clock() retimes SPI1 so that its transfers take about as long
+ * at any core clock. ADC1 is not: its scan is timed by the ADC clock.
+ */
+#define SIM57_PERIPHERAL(n) ((uint64_t)(n) * (SIM57_TICKS_PER_US / 24))
+
+/**
+ * Modeled cost of the board primitives, in MCU cycles. Flash wait states
+ * are neglected: the prefetch buffer hides most of them.
+ */
+
+/** A call that writes or reads a GPIO register. */
+#define SIM57_GPIO_CYCLES 6
+
+/** One iteration of a timer polling loop. */
+#define SIM57_POLL_CYCLES 8
+
+/** One SPI1 byte, at 24 MHz: APB2 / 8, 8 bits. */
+#define SIM57_SPI_BYTE_CYCLES (8 * 8)
+
+/** The BSY polling of a byte shifted without DMA. */
+#define SIM57_SPI_POLL_CYCLES 12
+
+/** Reloading and starting a DMA channel. */
+#define SIM57_DMA_START_CYCLES 16
+
+/**
+ * ADC1 sample time in half ADC clocks, as set by hal57_set_clock(): 41.5
+ * cycles, 13.5 at 8 MHz. The ADC clock is 4, 12 or 10.7 MHz.
+ */
+#define SIM57_ADC_SAMPLE_HALVES 83
+#define SIM57_ADC_SAMPLE_8MHZ_HALVES 27
+
+/** A scan: 5 conversions of the sample time + 12.5 ADC clocks, in half clocks. */
+#define SIM57_ADC_SCAN_HALVES(sample) (5 * ((sample) + 25))
+
+/** Setup of a conversion waited for. */
+#define SIM57_ADC_SETUP_CYCLES 40
+
+/** Cortex-M3 exception entry and exit. */
+#define SIM57_ISR_CYCLES 24
+
+/** Register writes of a clock switch, and retiming of the peripherals. */
+#define SIM57_CLOCK_SWITCH_CYCLES 60
+
+/** Time for the PLL to lock. */
+#define SIM57_PLL_LOCK_US 200
+
+/** Highest core clock. */
+#define SIM57_MAX_MHZ 72
+
+/** Display frame window: a TI-57 display cycle. */
+#define SIM57_FRAME_US 6400
+
+/** Default modeled cost of ti57_next(), see -n. */
+#define SIM57_DEFAULT_NEXT_CYCLES 300
+
+/** Where the cycles go. */
+typedef enum sim57_account_e {
+    SIM57_EMULATION,  // ti57_next(), as modeled by -n
+    SIM57_FIRMWARE,   // foreground peripheral access and busy waits
+    SIM57_ISR,        // SysTick_Handler(), TIM3_IRQHandler() and USART1_IRQHandler(), including their peripheral access
+    SIM57_SLEEP,      // hal57_wait_for_interrupt()
+    SIM57_STOP,       // hal57_stop_until_key()
+    SIM57_ACCOUNT_COUNT
+} sim57_account_t;
+
+/**
+ * Supply current model, for the energy estimate: typical STM32F103
+ * currents with the peripherals clocked, as linear fits of the datasheet
+ * figures from 8 to 72 MHz (13 mA running and 5 mA sleeping at 24 MHz),
+ * and the current of one lit LED segment, as set by the TLC5929 or the
+ * digit 12 direct drive. The rest of the board is neglected.
+ */
+#define SIM57_RUN_UA(mhz) (1500 + 480 * (mhz))     // running: emulation, firmware and interrupts
+#define SIM57_SLEEP_UA(mhz) (300 + 196 * (mhz))    // WFI
+#define SIM57_STOP_UA 14                           // STOP mode, regulator in low power mode
+#define SIM57_SEGMENT_UA 5000
+
+/** Current virtual time. */
+uint64_t sim57_now(void);
+
+/** Spends 'ticks' of virtual time, running any interrupt and model event that falls due. */
+void sim57_spend(sim57_account_t account, uint64_t ticks);
+
+/** Current core clock, in MHz (24 after reset). */
+uint64_t sim57_get_cpu_mhz(void);
+
+/** Changes the core clock. */
+void sim57_set_cpu_mhz(uint64_t mhz);
+
+/** Starts (true) or stops (false) the cycle counter, which counts the MCU cycles at the clock of the moment, except in STOP mode. */
+void sim57_cycle_counter(bool on);
+
+/** Reads the cycle counter (32 bits, wrapping). */
+uint32_t sim57_cycle_count(void);
+
+/** Masks (false) or unmasks the interrupts. A SysTick period that elapsed while masked is taken on unmasking. */
+void sim57_enable_interrupts(bool is_enabled);
+
+/** Sleeps until the next SysTick, TIM3 or USART1 interrupt. */
+void sim57_sleep(void);
+
+/** Stops the clocks (and SysTick) until a key closes a driven column. */
+void sim57_stop(void);
+
+/** Sets the SysTick period (0 to stop). */
+void sim57_systick_config(uint32_t period_us);
+
+/** Raises the TIM3 compare interrupt at virtual time 'time' (0: never). */
+void sim57_tim3_alarm(uint64_t time);
+
+/** Called on the edges of the debug pin. */
+void sim57_debug_pin(bool on);
+
+/** Prints a timestamped line from one of the models. */
+void sim57_print(const char *source, const char *fmt, ...);
+
+/**
+ * Board model (board57.c).
+ */
+
+/** Initializes the board: segments off, TLC5929 cleared, no key pressed. */
+void board57_init(void);
+
+/** Presses or releases the key at row 1..8, col 1..5. */
+void board57_set_key(int row, int col, bool is_pressed);
+
+/** Closes the display frame window, printing the display if it changed. */
+void board57_frame(void);
+
+/** True if a column input is high: a pressed key on a driven segment line. */
+bool board57_is_column_high(void);
+
+/** Total lit time of the LED segments (one per digit and segment lit). */
+uint64_t board57_get_lit_time(void);
+
+/**
+ * 11AA080 UNI/O EEPROM model (eeprom57.c).
+ */
+
+/** Loads the EEPROM contents from 'path' (or erased if it does not exist). */
+void eeprom57_init(const char *path);
+
+/** Called when the master changes its drive of the bus (true = released). */
+void eeprom57_master(bool level);
+
+/** Level the EEPROM drives on the bus now (true = released). */
+bool eeprom57_level(void);
+
+/** Number of commands completed and rejected. */
+void eeprom57_get_stats(unsigned long *commands, unsigned long *errors);
+
+/**
+ * USART1 (usart57.c).
+ */
+
+/** Sends the streamed bytes whose time has come (all of them, if 'force'), printing the records they complete. */
+void usart57_poll(bool force);
+
+/** True if a received byte waits in the data register, with the reception enabled. */
+bool usart57_is_rx_pending(void);
+
+/** Time at which the next byte on its way is received (UINT64_MAX: none). */
+uint64_t usart57_next_rx(void);
+
+/** Number of bytes received, and lost to overruns. */
+void usart57_get_stats(unsigned long *received, unsigned long *overruns);
+
+/** Loads the -c script of "ms command" lines. */
+bool usart57_load_script(const char *path);
+
+/** Opens the pseudo terminal of -p. Returns the name of its slave side, or NULL. */
+const char *usart57_open_pty(void);
+
+/** Queues the bytes written to the pseudo terminal, as received from now on. */
+void usart57_read_pty(void);
+
+#endif  /* !sim57_h */
@@ -0,0 +1,238 @@
+/**
+ * USART1 of the board: transmission fed by DMA behind hal57_usart_stream(),
+ * and reception behind hal57_usart_rx_start() and hal57_usart_receive().
+ *
+ * Each character takes 10 bit times at 230400 bit/s, in either direction.
+ * The bytes sent are the telemetry records of tele57.h, which are decoded
+ * by teledec57_feed() and printed as they complete, and also written to
+ * the pseudo terminal of -p. The bytes received come from the -c script
+ * and from the pseudo terminal. They arrive in the data register one
+ * character time apart, and a byte arriving while the previous one has
+ * not been read yet is lost (overrun), as when the interrupts are masked
+ * for a clock switch. Bytes arriving before the reception is enabled are
+ * lost too.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "hal57.h"
+#include "sim57.h"
+#include "tele57.h"
+
+/** One character: start bit, 8 data bits and stop bit at 230400 bit/s. */
+#define CHAR_TIME (SIM57_US(10 * 1000000ULL) / 230400)
+
+#define MAX_SCRIPT_LINES 256
+#define RX_QUEUE_SIZE 4096
+
+typedef struct script_line_s {
+    uint64_t time;
+    char *text;
+} script_line_t;
+
+/* Transmission. */
+static const uint8_t *dma_bytes;
+static int dma_count;
+static uint64_t next_end;       // end of the character being sent
+static teledec57_t decoder;
+
+/* Reception: bytes on their way, and the data register. */
+static uint8_t rx_queue[RX_QUEUE_SIZE];
+static int rx_head;
+static int rx_count;
+static uint64_t rx_next_time;   // arrival of the first byte on its way
+static bool is_rx_on;
+static bool is_rx_full;
+static uint8_t rx_data;
+static unsigned long rx_received;
+static unsigned long rx_overruns;
+
+static script_line_t script[MAX_SCRIPT_LINES];
+static int script_count;
+static int next_script_line;
+
+static int pty_fd = -1;
+
+/** Queues bytes to be received, the first one a character time after 'start' at the earliest. */
+static void send_to_rx(const uint8_t *bytes, int n, uint64_t start)
+{
+    for (int i = 0; i < n && rx_count < RX_QUEUE_SIZE; i++) {
+        if (rx_count == 0 && rx_next_time < start + CHAR_TIME) rx_next_time = start + CHAR_TIME;
+        rx_queue[(rx_head + rx_count++) % RX_QUEUE_SIZE] = bytes[i];
+    }
+}
+
+/** Moves the bytes that arrived by now to the data register. */
+static void receive(void)
+{
+    uint64_t now = sim57_now();
+
+    while (next_script_line < script_count && now >= script[next_script_line].time) {
+        script_line_t *line = &script[next_script_line++];
+        send_to_rx((const uint8_t *)line->text, strlen(line->text), line->time);
+        send_to_rx((const uint8_t *)"\n", 1, line->time);
+    }
+    while (rx_count > 0 && now >= rx_next_time) {
+        if (is_rx_on) {
+            if (is_rx_full) {
+                rx_overruns++;
+            } else {
+                rx_data = rx_queue[rx_head];
+                is_rx_full = true;
+                rx_received++;
+            }
+        }
+        rx_head = (rx_head + 1) % RX_QUEUE_SIZE;
+        rx_count--;
+        rx_next_time += CHAR_TIME;
+    }
+}
+
+void usart57_poll(bool force)
+{
+    char line[128];
+
+    while (dma_count > 0 && (force || sim57_now() >= next_end)) {
+        if (pty_fd >= 0 && write(pty_fd, dma_bytes, 1) < 0) {
+            // Nobody reads the terminal: the byte is lost, as on an unconnected TXD.
+        }
+        if (teledec57_feed(&decoder, *dma_bytes++, line, sizeof(line))) {
+            sim57_print("usart", "%s", line);
+        }
+        dma_count--;
+        next_end += CHAR_TIME;
+    }
+}
+
+bool usart57_is_rx_pending(void)
+{
+    receive();
+    return is_rx_full;
+}
+
+uint64_t usart57_next_rx(void)
+{
+    if (next_script_line < script_count &&
+        (rx_count == 0 || script[next_script_line].time < rx_next_time)) {
+        return script[next_script_line].time;
+    }
+    return rx_count > 0 ? rx_next_time : UINT64_MAX;
+}
+
+void usart57_get_stats(unsigned long *received, unsigned long *overruns)
+{
+    *received = rx_received;
+    *overruns = rx_overruns;
+}
+
+static int compare_script_lines(const void *a, const void *b)
+{
+    uint64_t ta = ((const script_line_t *)a)->time, tb = ((const script_line_t *)b)->time;
+    return ta < tb ? -1 : ta > tb;
+}
+
+bool usart57_load_script(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char text[256];
+
+    if (!f) {
+        perror(path);
+        return false;
+    }
+    while (fgets(text, sizeof(text), f)) {
+        unsigned long ms;
+        int n;
+
+        text[strcspn(text, "#\r\n")] = 0;
+        if (sscanf(text, "%lu %n", &ms, &n) != 1) continue;
+        if (script_count == MAX_SCRIPT_LINES) {
+            fprintf(stderr, "%s: more than %d lines\n", path, MAX_SCRIPT_LINES);
+            fclose(f);
+            return false;
+        }
+        script[script_count++] = (script_line_t){SIM57_US(ms * 1000), strdup(text + n)};
+    }
+    fclose(f);
+    // Stable for equal times, so that lines sent at the same ms keep their order.
+    for (int i = 1; i < script_count; i++) {
+        for (int j = i; j > 0 && compare_script_lines(&script[j - 1], &script[j]) > 0; j--) {
+            script_line_t line = script[j];
+            script[j] = script[j - 1];
+            script[j - 1] = line;
+        }
+    }
+    return true;
+}
+
+const char *usart57_open_pty(void)
+{
+    struct termios tio;
+
+    pty_fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (pty_fd < 0 || grantpt(pty_fd) < 0 || unlockpt(pty_fd) < 0) {
+        perror("ti57sim: pty");
+        return NULL;
+    }
+    // Raw bytes both ways: the records are binary.
+    if (tcgetattr(pty_fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(pty_fd, TCSANOW, &tio);
+    }
+    fcntl(pty_fd, F_SETFL, fcntl(pty_fd, F_GETFL) | O_NONBLOCK);
+    return ptsname(pty_fd);
+}
+
+void usart57_read_pty(void)
+{
+    uint8_t bytes[256];
+    ssize_t n;
+
+    if (pty_fd < 0) return;
+    // EAGAIN: nothing to read, EIO: the terminal is not open on the other side.
+    while ((n = read(pty_fd, bytes, sizeof(bytes))) > 0) {
+        send_to_rx(bytes, n, sim57_now());
+    }
+}
+
+void hal57_usart_stream(const uint8_t *bytes, uint16_t n)
+{
+    uint64_t now = sim57_now();
+
+    sim57_spend(SIM57_FIRMWARE, SIM57_CYCLES(SIM57_DMA_START_CYCLES));
+    usart57_poll(false);
+    dma_bytes = bytes;
+    dma_count = n;
+    // The first byte goes to the shift register at once, or after the one being sent.
+    next_end = (next_end > now ? next_end : now) + CHAR_TIME;
+}
+
+bool hal57_usart_busy(void)
+{
+    sim57_spend(SIM57_FIRMWARE, SIM57_CYCLES(SIM57_POLL_CYCLES));
+    usart57_poll(false);
+    return dma_count > 0;
+}
+
+void hal57_usart_rx_start(void)
+{
+    sim57_spend(SIM57_FIRMWARE, SIM57_CYCLES(4 * SIM57_GPIO_CYCLES));
+    is_rx_on = true;
+}
+
+bool hal57_usart_receive(uint8_t *byte)
+{
+    sim57_spend(SIM57_FIRMWARE, SIM57_CYCLES(SIM57_GPIO_CYCLES));
+    receive();
+    if (!is_rx_full) return false;
+    *byte = rx_data;
+    is_rx_full = false;
+    return true;
+}